@@ -10,19 +10,35 @@
 #include "GordianEngine/GlobalLibraries/Public/GlobalObjectLibrary.h"
 
 #include "GordianEngine/ActorComponents/Public/SimpleSpriteComponent.h"
+#include "GordianEngine/ActorComponents/Public/TransformComponent.h"
+#include "GordianEngine/World/Public/World.h"
 
 using namespace Gordian;
 
 AActor::AActor(const std::string& InName, OObject* InOwningObject)
 	: Parent(InName, InOwningObject)
-	, _ActorComponents{}
 	, _bIsTicking(false)
+	, _ActorComponents{}
+	, _RegisteredWorld(nullptr)
 {
 }
 
 AActor::~AActor()
 {
+	// Leave the tick lists before anything is torn down, so nothing ticks a half destroyed actor
+	if (_RegisteredWorld != nullptr)
+	{
+		_RegisteredWorld->UnregisterActorFromWorld(this);
+	}
 
+	// Only destroy components this actor created, others are owned elsewhere
+	for (OActorComponent* ActorComponent : _ActorComponents)
+	{
+		if (ActorComponent->GetOwningObject() == this)
+		{
+			FGlobalObjectLibrary::DestroyObject(ActorComponent);
+		}
+	}
 }
 
 void AActor::Initialize()
@@ -52,17 +68,73 @@ void AActor::BeginPlay()
 	check(SetFlagIfNotSet(EObjectFlags::HasCompleteBeginPlay));
 }
 
+void AActor::SetIsTicking(bool bInIsTicking)
+{
+	if (_bIsTicking == bInIsTicking)
+	{
+		return;
+	}
+
+	_bIsTicking = bInIsTicking;
+
+	if (_RegisteredWorld != nullptr)
+	{
+		if (_bIsTicking)
+		{
+			_RegisteredWorld->GetTickManager().RegisterActor(this);
+		}
+		else
+		{
+			_RegisteredWorld->GetTickManager().UnregisterActor(this);
+		}
+	}
+}
+
 bool AActor::AddComponent(OActorComponent* ComponentToAdd)
 {
 	_ActorComponents.push_back(ComponentToAdd);
 
 	ComponentToAdd->Initialize(this);
 
+	if (_RegisteredWorld != nullptr)
+	{
+		if (ComponentToAdd->IsTicking())
+		{
+			_RegisteredWorld->GetTickManager().RegisterComponent(ComponentToAdd);
+		}
+
+		OTransformComponent* TransformComponent = Cast<OTransformComponent>(ComponentToAdd);
+		if (TransformComponent != nullptr)
+		{
+			TransformComponent->RegisterWithBuffer(_RegisteredWorld->GetTransformBuffer());
+		}
+	}
+
 	return true;
 }
 
+OTransformComponent* AActor::GetTransformComponent() const
+{
+	for (OActorComponent* ActorComponent : _ActorComponents)
+	{
+		OTransformComponent* TransformComponent = Cast<OTransformComponent>(ActorComponent);
+		if (TransformComponent != nullptr)
+		{
+			return TransformComponent;
+		}
+	}
+
+	return nullptr;
+}
+
 void AActor::Render(sf::Time BlendTime, sf::RenderTarget& Target, sf::RenderStates States) const
 {
+	const OTransformComponent* TransformComponent = GetTransformComponent();
+	if (TransformComponent != nullptr)
+	{
+		States.transform *= TransformComponent->GetRenderTransform();
+	}
+
 	for (const OActorComponent* ActorComponent : _ActorComponents)
 	{
 		const OSimpleSpriteComponent* RenderComponent = Cast<OSimpleSpriteComponent>(ActorComponent);
@@ -73,6 +145,26 @@ void AActor::Render(sf::Time BlendTime, sf::RenderTarget& Target, sf::RenderStat
 	}
 }
 
+void AActor::QueueRender(sf::Time BlendTime, FSpriteBatch& SpriteBatch, const sf::Transform& ParentTransform) const
+{
+	sf::Transform ActorTransform = ParentTransform;
+
+	const OTransformComponent* TransformComponent = GetTransformComponent();
+	if (TransformComponent != nullptr)
+	{
+		ActorTransform *= TransformComponent->GetRenderTransform();
+	}
+
+	for (const OActorComponent* ActorComponent : _ActorComponents)
+	{
+		const OSimpleSpriteComponent* RenderComponent = Cast<OSimpleSpriteComponent>(ActorComponent);
+		if (RenderComponent != nullptr)
+		{
+			RenderComponent->QueueRender(BlendTime, SpriteBatch, ActorTransform);
+		}
+	}
+}
+
 
 RCLASS_INITIALIZE(AActor)
 RCLASS_BEGIN_MEMBER_LIST()
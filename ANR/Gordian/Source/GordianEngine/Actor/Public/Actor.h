@@ -4,19 +4,27 @@
 
 #include "GordianEngine/Core/Public/Object.h"
 #include "GordianEngine/Core/Public/Renderable.h"
+#include "GordianEngine/Core/Public/Tickable.h"
 
 namespace Gordian
 {
 
+class FSpriteBatch;
 class OActorComponent;
+class OTransformComponent;
+class OWorld;
 
 /// Component based entity that exists in the world
 ///
 /// Long term goal to support networking
 class AActor : public OObject
 			 , public IRenderable
+			 , public ITickable
 {
 	REFLECT_CLASS(OObject)
+
+	friend OWorld;
+
 public:
 
 	AActor(const std::string& InName, OObject* InOwningObject);
@@ -28,16 +36,34 @@ public:
 	// Starts up this actor.
 	// This is not called until this actor
 	virtual void BeginPlay();
-	// Tick this actor.
-	virtual void Tick(const sf::Time& DeltaTime) {};
+	// Tick this actor. Only called while this actor is ticking.
+	virtual void Tick(const sf::Time& DeltaTime) override {};
+
+	// Starts or stops ticking this actor. Actors do not tick until asked to.
+	void SetIsTicking(bool bInIsTicking);
+	inline bool IsTicking() const
+	{
+		return _bIsTicking;
+	}
+
+	// The world this actor was registered with, if any
+	inline OWorld* GetRegisteredWorld() const
+	{
+		return _RegisteredWorld;
+	}
 	// Destroys this actor.
 	void Destroy() {};
 
 	// Adds the passed component to this actor, removing
 	bool AddComponent(OActorComponent* ComponentToAdd);
 
-	// Temp ease of use to render
+	// Returns the first transform component on this actor, if it has one
+	OTransformComponent* GetTransformComponent() const;
+
+	// Temp ease of use to render. Sprites are drawn relative to the actor's transform component.
 	virtual void Render(sf::Time BlendTime, sf::RenderTarget& Target, sf::RenderStates States) const override;
+	// Queues this actor's sprites to be drawn in batches by the world
+	virtual void QueueRender(sf::Time BlendTime, FSpriteBatch& SpriteBatch, const sf::Transform& ParentTransform) const;
 
 protected:
 
@@ -53,10 +79,12 @@ protected:
 
 private:
 
-	// Eventually we should use this to prevent iterating over non-ticking actors
+	// Only ticking actors are registered with the world's tick manager
 	bool _bIsTicking;
 
 	std::vector<OActorComponent*> _ActorComponents;
+
+	OWorld* _RegisteredWorld;
 };
 
 
@@ -3,6 +3,7 @@
 #pragma once
 
 #include "GordianEngine/Core/Public/Object.h"
+#include "GordianEngine/Core/Public/Tickable.h"
 
 namespace Gordian
 {
@@ -11,26 +12,36 @@ class AActor;
 
 // A component that extends the functionality of an Actor
 class OActorComponent : public OObject
+					  , public ITickable
 {
 	REFLECT_CLASS(OObject)
 
 public:
 
 	OActorComponent(const std::string& InName, OObject* InOwningObject);
+	virtual ~OActorComponent() override;
 
 	/// Called when this component is added to an actor. Should be used
-	///	  to set up the component
+	///	  to set up the component. Components tick after their owning actor by default.
 	virtual void Initialize(AActor* ActorInitializingFrom);
 	/// Called when the owning object begins play.
 	virtual void OnBeginPlay();
 
-	virtual void Tick(const sf::Time& DeltaTime) {};
+	// Only called while this component is ticking.
+	virtual void Tick(const sf::Time& DeltaTime) override {};
+
+	// Starts or stops ticking this component
+	void SetIsTicking(bool bInIsTicking);
+	inline bool IsTicking() const
+	{
+		return _bIsTicking;
+	}
 
 	AActor* GetOwningActor() const;
 
 private:
 	
-	// todo: use _bIsTicking to prevent iterating over non-ticking components
+	// Only ticking components are registered with the world's tick manager
 	bool _bIsTicking;
 
 };
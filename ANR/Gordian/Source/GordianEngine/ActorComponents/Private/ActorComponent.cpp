@@ -5,6 +5,7 @@
 
 #include "GordianEngine/Actor/Public/Actor.h"
 #include "GordianEngine/GlobalLibraries/Public/GlobalObjectLibrary.h"
+#include "GordianEngine/World/Public/World.h"
 
 using namespace Gordian;
 
@@ -15,10 +16,23 @@ OActorComponent::OActorComponent(const std::string& InName, OObject* InOwningObj
 
 }
 
+OActorComponent::~OActorComponent()
+{
+	// Leave the tick lists while we are still a whole component
+	const AActor* OwningActor = GetOwningActor();
+	OWorld* RegisteredWorld = OwningActor != nullptr ? OwningActor->GetRegisteredWorld() : nullptr;
+	if (RegisteredWorld != nullptr)
+	{
+		RegisteredWorld->GetTickManager().UnregisterComponent(this);
+	}
+}
+
 void OActorComponent::Initialize(AActor* ActorInitializingFrom)
 {
 	// Sanity check to avoid bad owning trees
 	check(ActorInitializingFrom == GetOwningActor());
+
+	AddTickPrerequisite(ActorInitializingFrom);
 }
 
 void OActorComponent::OnBeginPlay()
@@ -28,6 +42,31 @@ void OActorComponent::OnBeginPlay()
 	check(SetFlagIfNotSet(EObjectFlags::HasCompleteBeginPlay));
 }
 
+void OActorComponent::SetIsTicking(bool bInIsTicking)
+{
+	if (_bIsTicking == bInIsTicking)
+	{
+		return;
+	}
+
+	_bIsTicking = bInIsTicking;
+
+	// Components are registered along with their actor, so only act if that already happened
+	const AActor* OwningActor = GetOwningActor();
+	OWorld* RegisteredWorld = OwningActor != nullptr ? OwningActor->GetRegisteredWorld() : nullptr;
+	if (RegisteredWorld != nullptr)
+	{
+		if (_bIsTicking)
+		{
+			RegisteredWorld->GetTickManager().RegisterComponent(this);
+		}
+		else
+		{
+			RegisteredWorld->GetTickManager().UnregisterComponent(this);
+		}
+	}
+}
+
 AActor* OActorComponent::GetOwningActor() const
 {
 	OObject* Owner = GetOwningObject();
@@ -38,6 +77,8 @@ AActor* OActorComponent::GetOwningActor() const
 		{
 			return PossibleOwningActor;
 		}
+
+		Owner = Owner->GetOwningObject();
 	}
 
 	return nullptr;
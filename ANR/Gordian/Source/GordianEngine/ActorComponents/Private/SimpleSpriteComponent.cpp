@@ -2,6 +2,8 @@
 
 #include "GordianEngine/ActorComponents/Public/SimpleSpriteComponent.h"
 #include "GordianEngine/Core/Public/Gordian.h"
+#include "GordianEngine/Rendering/Public/SpriteBatch.h"
+#include "GordianEngine/Rendering/Public/TextureAtlas.h"
 
 #include "SFML/Graphics/Rect.hpp"
 
@@ -12,6 +14,7 @@ OSimpleSpriteComponent::OSimpleSpriteComponent(const std::string& InName, OObjec
 	, _SpriteToRender()
 	, _TextureToRender()
 	, _FileToLoadTextureFrom("BAD_TEXT")
+	, _RenderLayer(0)
 {
 
 }
@@ -23,10 +26,54 @@ void OSimpleSpriteComponent::Initialize(AActor* ActorInitializingFrom)
 
 void OSimpleSpriteComponent::Render(sf::Time BlendTime, sf::RenderTarget& Target, sf::RenderStates States) const
 {
-	// We should get the position first
-	// Then offset it by the movement component's offset for the given blend time
-
+	// States already carries the actor's blended transform
 	Target.draw(_SpriteToRender, States);
 }
 
-RCLASS_INITIALIZE_EMPTY(OSimpleSpriteComponent)
+void OSimpleSpriteComponent::QueueRender(sf::Time BlendTime, FSpriteBatch& SpriteBatch, const sf::Transform& ParentTransform) const
+{
+	SpriteBatch.Submit(_SpriteToRender, ParentTransform, _RenderLayer);
+}
+
+bool OSimpleSpriteComponent::LoadTexture(const std::string& FilePath)
+{
+	// The sprite keeps drawing the old texture if the new one fails to load
+	FTextureHandle LoadedTexture = FTextureCache::Get().Load(FilePath);
+	if (LoadedTexture == nullptr)
+	{
+		return false;
+	}
+
+	_FileToLoadTextureFrom = FilePath;
+	_TextureToRender = LoadedTexture;
+	_SpriteToRender.setTexture(*_TextureToRender);
+	return true;
+}
+
+bool OSimpleSpriteComponent::StreamTexture(const std::string& FilePath, const sf::IntRect& TextureRect)
+{
+	FTextureHandle StreamedTexture = FTextureCache::Get().LoadAsync(FilePath);
+	if (StreamedTexture == nullptr)
+	{
+		return false;
+	}
+
+	_FileToLoadTextureFrom = FilePath;
+	_TextureToRender = StreamedTexture;
+	_SpriteToRender.setTexture(*_TextureToRender);
+	_SpriteToRender.setTextureRect(TextureRect);
+	return true;
+}
+
+void OSimpleSpriteComponent::SetAtlasRegion(const FAtlasRegion& Region)
+{
+	check(Region.Texture != nullptr);
+	_TextureToRender.reset();
+	_SpriteToRender.setTexture(*Region.Texture);
+	_SpriteToRender.setTextureRect(Region.TextureRect);
+}
+
+RCLASS_INITIALIZE(OSimpleSpriteComponent)
+RCLASS_BEGIN_MEMBER_LIST()
+RCLASS_MEMBER_ADD(_RenderLayer)
+RCLASS_END_INIT()
@@ -0,0 +1,109 @@
+// Gordian by Daniel Luna (2019)
+
+#include "GordianEngine/ActorComponents/Public/TransformComponent.h"
+#include "GordianEngine/Core/Public/Gordian.h"
+
+#include "GordianEngine/World/Public/TransformBuffer.h"
+
+using namespace Gordian;
+
+OTransformComponent::OTransformComponent(const std::string& InName, OObject* InOwningObject)
+	: Parent(InName, InOwningObject)
+	, _TransformBuffer(nullptr)
+	, _TransformSlot(-1)
+	, _PositionX(0.f)
+	, _PositionY(0.f)
+	, _Rotation(0.f)
+{
+
+}
+
+OTransformComponent::~OTransformComponent()
+{
+	if (_TransformBuffer != nullptr)
+	{
+		_TransformBuffer->Release(_TransformSlot);
+	}
+}
+
+void OTransformComponent::Initialize()
+{
+	OObject::Initialize();
+
+	if (_TransformBuffer != nullptr)
+	{
+		_TransformBuffer->SetPosition(_TransformSlot, GetPosition());
+		_TransformBuffer->SetRotation(_TransformSlot, _Rotation);
+		_TransformBuffer->Teleport(_TransformSlot);
+	}
+}
+
+void OTransformComponent::SetPosition(const sf::Vector2f& InPosition)
+{
+	_PositionX = InPosition.x;
+	_PositionY = InPosition.y;
+
+	if (_TransformBuffer != nullptr)
+	{
+		_TransformBuffer->SetPosition(_TransformSlot, InPosition);
+	}
+}
+
+sf::Vector2f OTransformComponent::GetPosition() const
+{
+	return sf::Vector2f(_PositionX, _PositionY);
+}
+
+void OTransformComponent::SetRotation(float InRotation)
+{
+	_Rotation = InRotation;
+
+	if (_TransformBuffer != nullptr)
+	{
+		_TransformBuffer->SetRotation(_TransformSlot, InRotation);
+	}
+}
+
+float OTransformComponent::GetRotation() const
+{
+	return _Rotation;
+}
+
+void OTransformComponent::Teleport()
+{
+	if (_TransformBuffer != nullptr)
+	{
+		_TransformBuffer->Teleport(_TransformSlot);
+	}
+}
+
+sf::Transform OTransformComponent::GetRenderTransform() const
+{
+	if (_TransformBuffer != nullptr)
+	{
+		return _TransformBuffer->GetRenderTransform(_TransformSlot);
+	}
+
+	sf::Transform RenderTransform;
+	RenderTransform.translate(_PositionX, _PositionY);
+	RenderTransform.rotate(_Rotation);
+	return RenderTransform;
+}
+
+void OTransformComponent::RegisterWithBuffer(FTransformBuffer& TransformBuffer)
+{
+	if (_TransformBuffer != nullptr)
+	{
+		return;
+	}
+
+	_TransformBuffer = &TransformBuffer;
+	_TransformSlot = TransformBuffer.Allocate(GetPosition(), _Rotation);
+}
+
+RCLASS_INITIALIZE(OTransformComponent)
+RCLASS_BEGIN_MEMBER_LIST()
+RCLASS_MEMBER_ADD(_PositionX)
+RCLASS_MEMBER_ADD(_PositionY)
+RCLASS_MEMBER_ADD(_Rotation)
+RCLASS_END_INIT()
@@ -4,14 +4,18 @@
 
 #include "SFML/Graphics/Sprite.hpp"
 #include "SFML/Graphics/Texture.hpp"
+#include "SFML/Graphics/Transform.hpp"
 
 #include "GordianEngine/Actor/Public/ActorComponent.h"
 #include "GordianEngine/Core/Public/Renderable.h"
+#include "GordianEngine/Rendering/Public/TextureCache.h"
 
 namespace Gordian
 {
 
 class AActor;
+class FSpriteBatch;
+struct FAtlasRegion;
 
 
 // Proof of concept for a renderable component that draws a sfml sprite
@@ -32,13 +36,40 @@ public:
 
 	virtual void Render(sf::Time BlendTime, sf::RenderTarget& Target, sf::RenderStates States) const override;
 
+	// Queues this sprite to be drawn with every other sprite sharing its texture
+	void QueueRender(sf::Time BlendTime, FSpriteBatch& SpriteBatch, const sf::Transform& ParentTransform) const;
+
+	// Draws the texture at FilePath, loaded through the texture cache.
+	//	Returns false if it could not be loaded.
+	bool LoadTexture(const std::string& FilePath);
+
+	// Draws TextureRect of the texture at FilePath, which is decoded in the background.
+	//	A placeholder fills TextureRect until the texture is ready.
+	bool StreamTexture(const std::string& FilePath, const sf::IntRect& TextureRect);
+
+	// Draws from an atlas page instead of this component's own texture
+	void SetAtlasRegion(const FAtlasRegion& Region);
+
+	// Sprites on higher layers are drawn over lower ones
+	inline void SetRenderLayer(int InRenderLayer)
+	{
+		_RenderLayer = InRenderLayer;
+	}
+	inline int GetRenderLayer() const
+	{
+		return _RenderLayer;
+	}
+
 protected:
 
 	sf::Sprite _SpriteToRender;
 
-	sf::Texture _TextureToRender;
+	// Shared with every other sprite drawing the same file
+	FTextureHandle _TextureToRender;
 
 	std::string _FileToLoadTextureFrom;
+
+	int _RenderLayer;
 };
 
 
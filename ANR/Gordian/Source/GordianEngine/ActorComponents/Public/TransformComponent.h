@@ -0,0 +1,62 @@
+// Gordian by Daniel Luna (2019)
+
+#pragma once
+
+#include "SFML/Graphics/Transform.hpp"
+#include "SFML/System/Vector2.hpp"
+
+#include "GordianEngine/Actor/Public/ActorComponent.h"
+
+namespace Gordian
+{
+
+class FTransformBuffer;
+
+
+// Places its actor in the world. Rendering blends between where the actor was on the
+//	last two ticks, so motion stays smooth when frames come faster than ticks.
+// Once the actor is registered, its world's FTransformBuffer blends the transform. The
+//	current position and rotation are kept here too, so they are saved with the actor.
+class OTransformComponent : public OActorComponent
+{
+	REFLECT_CLASS(OActorComponent)
+
+public:
+
+	OTransformComponent(const std::string& InName, OObject* InOwningObject);
+	virtual ~OTransformComponent() override;
+
+	// Loaded transforms start where they were saved, without blending from wherever the buffer had them
+	virtual void Initialize() override;
+	using Parent::Initialize;
+
+	void SetPosition(const sf::Vector2f& InPosition);
+	sf::Vector2f GetPosition() const;
+
+	// In degrees
+	void SetRotation(float InRotation);
+	float GetRotation() const;
+
+	// Jumps straight to the current position and rotation, instead of blending there from the last tick
+	void Teleport();
+
+	// Where to draw this actor this frame
+	sf::Transform GetRenderTransform() const;
+
+	// Moves this transform into TransformBuffer. Does nothing if it is already in one.
+	void RegisterWithBuffer(FTransformBuffer& TransformBuffer);
+
+private:
+
+	// Set once registered with a world's buffer
+	FTransformBuffer* _TransformBuffer;
+	sf::Int32 _TransformSlot;
+
+	// Current state, mirrored into the buffer whenever it changes
+	float _PositionX;
+	float _PositionY;
+	float _Rotation;
+};
+
+
+};
@@ -14,10 +14,7 @@ Gordian::TCircularBuffer<T>::TCircularBuffer(size_t InBufferSize)
 	EntityCount = 0;
 	BufferOffset = 0;
 	BufferSize = InBufferSize;
-	if (BufferSize > 0)
-	{
-		Buffer = new T[BufferSize];
-	}
+	Buffer = BufferSize > 0 ? new T[BufferSize] : nullptr;
 }
 
 template<typename T>
@@ -212,6 +209,6 @@ const T* Gordian::TCircularBuffer<T>::Back() const
 		return nullptr;
 	}
 
-	const size_t FinalPosition = (BufferOffset + EntityCount) % BufferSize;
+	const size_t FinalPosition = (BufferOffset + EntityCount - 1) % BufferSize;
 	return &Buffer[FinalPosition];
 }
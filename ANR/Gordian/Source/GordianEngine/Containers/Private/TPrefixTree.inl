@@ -4,662 +4,682 @@
 #include "GordianEngine/Debug/Public/Logging.h"
 
 #include <algorithm>
+#include <utility>
 
 DECLARE_LOG_CATEGORY_STATIC(LogPrefixTree, Log, Log)
 
 namespace Gordian
 {
 
-//--------------------------------------------------------------------------
-// PrefixTreeNode
-//--------------------------------------------------------------------------
+template<typename T>
+Gordian::TPrefixTree<T>::TPrefixTree()
+	: _Nodes{}
+	, _Values{}
+	, _KeyPool()
+	, _ReserveSize(0)
+	, _NumWords(0)
+{
+}
 
 template<typename T>
-Gordian::TPrefixTreeNode<T>::TPrefixTreeNode()
+Gordian::TPrefixTree<T>::TPrefixTree(size_t InReserveSize)
+	: TPrefixTree()
 {
-	Initialize(false);
+	Reserve(InReserveSize);
 }
 
 template<typename T>
-void Gordian::TPrefixTreeNode<T>::Initialize(bool bInIsActive)
+Gordian::TPrefixTree<T>::TPrefixTree(const TPrefixTree& Other)
+	: TPrefixTree()
 {
-	bIsActive = bInIsActive;
-	WordValue.Clear();
-	DivergingSubKey = "";
-	CachedFullKey = "";
-	bIsActive ? ParentNode : NextUnusedNode = nullptr;
-	ChildrenNodes.clear();
-	CachedDescendantWords.clear();
+	*this = Other;
 }
 
 template<typename T>
-bool Gordian::TPrefixTreeNode<T>::IsFullWord() const
+Gordian::TPrefixTree<T>::TPrefixTree(TPrefixTree&& Other)
+	: TPrefixTree()
 {
-	return WordValue.IsSet();
+	*this = std::move(Other);
 }
 
 template<typename T>
-bool Gordian::TPrefixTreeNode<T>::HasMatchingKey(const KeyType& TestKey) const
+Gordian::TPrefixTree<T>& Gordian::TPrefixTree<T>::operator=(const TPrefixTree& Other)
 {
-	if (TestKey.length() <= CachedFullKey.length())
+	if (this == &Other)
 	{
-		return false;
+		return *this;
 	}
 
-	for (size_t i = 0; i < CachedFullKey.length(); ++i)
-	{
-		if (TestKey[i] != CachedFullKey[i])
-		{
-			return false;
-		}
-	}
-	
-	return true;
+	_Nodes = Other._Nodes;
+	_Values = Other._Values;
+	_KeyPool = Other._KeyPool;
+	_ReserveSize = Other._ReserveSize;
+	_NumWords = Other._NumWords;
+
+	// Copying a vector does not copy its capacity, and AddNode relies on the reserved space being there
+	_Nodes.reserve(_ReserveSize);
+	_Values.reserve(_ReserveSize);
+	return *this;
 }
 
 template<typename T>
-bool Gordian::TPrefixTreeNode<T>::HasMatchingDivergingKey(const KeyType& TestDivergingSubKey) const
+Gordian::TPrefixTree<T>& Gordian::TPrefixTree<T>::operator=(TPrefixTree&& Other)
 {
-	if (TestDivergingSubKey.length() < DivergingSubKey.length())
+	if (this == &Other)
 	{
-		return false;
+		return *this;
 	}
 
-	for (size_t i = 0; i < DivergingSubKey.length(); ++i)
-	{
-		if (TestDivergingSubKey[i] != DivergingSubKey[i])
-		{
-			return false;
-		}
-	}
+	_Nodes = std::move(Other._Nodes);
+	_Values = std::move(Other._Values);
+	_KeyPool = std::move(Other._KeyPool);
+	_ReserveSize = Other._ReserveSize;
+	_NumWords = Other._NumWords;
 
-	return true;
+	// Leave Other as a freshly constructed, empty tree
+	Other._Nodes.clear();
+	Other._Values.clear();
+	Other._KeyPool.clear();
+	Other._ReserveSize = 0;
+	Other._NumWords = 0;
+	return *this;
 }
 
 template<typename T>
-const Gordian::TPrefixTreeNode<T>* Gordian::TPrefixTreeNode<T>::Find(const KeyType& InDivergingSubKey) const
+inline size_t Gordian::TPrefixTree<T>::MinCapacity() const
 {
-	if (InDivergingSubKey.length() == 0)
-	{
-		return this;
-	}
+	// The first word always requires exactly one node, on top of the root.
+	// Worst case, each additional word requires a new split to be made.
+	// When a split is made, one node becomes 3 (preexisting word -> split + preexisting suffix + new word suffix)
+	// i.e. ReserveSize = 2 * WordCount 
 
-	const std::map<CharType, TPrefixTreeNode<T>*>::const_iterator ExistingChildNode = ChildrenNodes.find(InDivergingSubKey[0]);
-	if (ExistingChildNode != ChildrenNodes.cend())
+	if (_Nodes.size() <= 1)
 	{
-		check(ExistingChildNode->second != nullptr);
-		TPrefixTreeNode<T>& RelatedChildNode = *ExistingChildNode->second;
-
-		if (RelatedChildNode.HasMatchingDivergingKey(InDivergingSubKey))
-		{
-			const KeyType& NewDivergingSubKey = InDivergingSubKey.substr(RelatedChildNode.DivergingSubKey.length());
-			return RelatedChildNode.Find(NewDivergingSubKey);
-		}
+		return _ReserveSize / 2;
 	}
 
-	return nullptr;
+	check(_ReserveSize >= _Nodes.size());
+	const size_t UnusedNodeCount = _ReserveSize - _Nodes.size();
+	return _NumWords + UnusedNodeCount / 2;
 }
 
 template<typename T>
-bool Gordian::TPrefixTreeNode<T>::AddWord(const KeyType& InWordDivergingSubKey,
-										  const T& InWordValue,
-										  TPrefixTreeNode<T>*& InOutNextFreeNode,
-										  size_t& OutNodesAdded)
+inline size_t Gordian::TPrefixTree<T>::MaxCapacity() const
 {
-	if (InWordDivergingSubKey.length() == 0)
-	{
-		if (IsFullWord())
-		{
-			GE_LOG(LogPrefixTree, Display, "Tried to add a node that already exists (%s)", CachedFullKey.c_str());
-			return false;
-		}
-
-		GE_LOG(LogPrefixTree, Verbose, "...Marking existing node (%s) as full word.", CachedFullKey.c_str());
-		WordValue.Set(InWordValue);
-		return true;
-	}
-
-	if (InOutNextFreeNode == nullptr)
-	{
-		GE_LOG(LogPrefixTree, Warning, "Could not add to prefix tree, not enough free nodes!");
-		return false;
-	}
+	// Best case, each word requires no splits - i.e. they all uniquely branch from the root
+	// When no split is made, only one node is added
+	// i.e. ReserveSize = WordCount + 1
 
-	if (GE_IS_LOG_ACTIVE(LogPrefixTree, Verbose))
+	if (_ReserveSize == 0)
 	{
-		std::string LogFormat = "Children:";
-		if (ChildrenNodes.size() == 0)
-		{
-			LogFormat.append("None");
-		}
-		else
-		{
-			for (auto const& Pair : ChildrenNodes)
-			{
-				LogFormat.append("(");
-				LogFormat.push_back(Pair.first);
-				LogFormat.append(",");
-				LogFormat.append(Pair.second->DivergingSubKey);
-				LogFormat.append(") ");
-			}
-		}
-
-		GE_LOG(LogPrefixTree, Verbose, "%s", LogFormat.c_str());
+		return 0;
 	}
 
+	check(_ReserveSize >= _Nodes.size());
+	const size_t NumUsedNodes = std::max<size_t>(_Nodes.size(), 1);
+	return _NumWords + _ReserveSize - NumUsedNodes;
+}
 
-	const std::map<CharType, TPrefixTreeNode<T>*>::const_iterator ExistingChildNode = ChildrenNodes.find(InWordDivergingSubKey[0]);
-	if (ExistingChildNode == ChildrenNodes.cend())
-	{
-		// No child exists with a matching next character
-		TPrefixTreeNode<T>& NewChildNode = GetNextFreeNode(InOutNextFreeNode);
-		++OutNodesAdded;
+template<typename T>
+inline size_t Gordian::TPrefixTree<T>::Num() const
+{
+	return _NumWords;
+}
 
-		NewChildNode.ParentNode = this;
-		NewChildNode.DivergingSubKey = InWordDivergingSubKey;
-		NewChildNode.CachedFullKey = CachedFullKey;
-		NewChildNode.CachedFullKey.append(InWordDivergingSubKey);
-		NewChildNode.WordValue.Set(InWordValue);
+template<typename T>
+bool Gordian::TPrefixTree<T>::Reserve(size_t SizeInWords)
+{
+	return ResizeTree(GetMaxNodesRequired(SizeInWords));
+}
 
-		ChildrenNodes.emplace(NewChildNode.DivergingSubKey[0], &NewChildNode);
-		CachedDescendantWords.insert(NewChildNode.CachedFullKey);
+template<typename T>
+inline bool Gordian::TPrefixTree<T>::Insert(KeyViewType Key, const T& Value)
+{
+	return Insert_Internal(Key, Value, true);
+}
 
-		GE_LOG(LogPrefixTree,
-			   Verbose,
-			   "...Tree ends without matching child node, adding leaf node. [DivergingSubKey - %s, CachedFullKey - %s]",
-			   NewChildNode.DivergingSubKey.c_str(), 
-			   NewChildNode.CachedFullKey.c_str());
+template<typename T>
+inline bool Gordian::TPrefixTree<T>::InsertRigid(KeyViewType Key,
+												 const T& Value)
+{
+	return Insert_Internal(Key, Value, false);
+}
 
-		return true;
-	}
-	
-	// If we get here, there is an existing competing node
-	check(ExistingChildNode->second != nullptr);
-	TPrefixTreeNode<T>& RelatedChildNode = *ExistingChildNode->second;
+template<typename T>
+bool Gordian::TPrefixTree<T>::Contains(KeyViewType Key) const
+{
+	return Find(Key) != nullptr;
+}
 
-	// If the existing child node has a matching diverging key...
-	if (RelatedChildNode.HasMatchingDivergingKey(InWordDivergingSubKey))
+template<typename T>
+const T* Gordian::TPrefixTree<T>::Find(KeyViewType Key) const
+{
+	const IndexType NodeIndex = FindNode(Key);
+	if (NodeIndex == k_InvalidIndex || _Nodes[NodeIndex].ValueIndex == k_InvalidIndex)
 	{
-		//...Simply pass the call along!
-		GE_LOG(LogPrefixTree, 
-			   Verbose, 
-			   "...Passing call to child node (%s) with matching diverging key (%s)...", 
-			   RelatedChildNode.DivergingSubKey.c_str(),
-			   InWordDivergingSubKey.c_str());
-
-		const KeyType& NewWordDivergingSubKey = InWordDivergingSubKey.substr(RelatedChildNode.DivergingSubKey.length());
-		return RelatedChildNode.AddWord(NewWordDivergingSubKey, InWordValue, InOutNextFreeNode, OutNodesAdded);
+		return nullptr;
 	}
-	else
-	{
-		//...Split the child node so both sub-trees can exist...
-		GE_LOG(LogPrefixTree,
-			   Verbose,
-			   "...Splitting node so the existing key (%s) can exist side by side with the new competing key (%s)...",
-			   RelatedChildNode.DivergingSubKey.c_str(),
-			   InWordDivergingSubKey.c_str());
-
-		const CharType ChildKey = InWordDivergingSubKey[0];
 
-		if (RelatedChildNode.SplitNode(InWordDivergingSubKey, InOutNextFreeNode, OutNodesAdded))
-		{
-			//...Then we can pass the call to the intermediate node
-			// Note we have to regrab the node because it has been altered by the SpliteNode call
-			TPrefixTreeNode<T>& NewIntermediateNode = *ChildrenNodes[ChildKey];
-
-			const KeyType& NewWordDivergingSubKey = InWordDivergingSubKey.substr(NewIntermediateNode.DivergingSubKey.length());
-			return NewIntermediateNode.AddWord(NewWordDivergingSubKey, InWordValue, InOutNextFreeNode, OutNodesAdded);
-		}
-		else
-		{
-			GE_LOG(LogPrefixTree,
-					Warning,
-					"Failed to split child (%s) with diverging sub-key (%s)!",
-					RelatedChildNode.CachedFullKey.c_str(),
-					InWordDivergingSubKey.c_str());
+	return &_Values[_Nodes[NodeIndex].ValueIndex];
+}
 
-			return false;
-		}
-	}
+template<typename T>
+T* Gordian::TPrefixTree<T>::Find(KeyViewType Key)
+{
+	return const_cast<T*>(static_cast<const TPrefixTree<T>*>(this)->Find(Key));
 }
 
 template<typename T>
-bool Gordian::TPrefixTreeNode<T>::SplitNode(const KeyType& SplitSubKey,
-											TPrefixTreeNode<T>*& InOutNextFreeNode,
-											size_t& OutNodesAdded)
+const T& Gordian::TPrefixTree<T>::At(KeyViewType Key) const
 {
-	check(DivergingSubKey.length() > 0);
-	if (SplitSubKey.length() == 0)
-	{
-		GE_LOG(LogPrefixTree, Warning, "Tried to split a node with an empty SplitKey (Full Key: %s)", CachedFullKey.c_str());
-		return false;
-	}
+	const T* FindResult = Find(Key);
+	check(FindResult != nullptr);
+	return *FindResult;
+}
 
-	if (HasMatchingDivergingKey(SplitSubKey))
+template<typename T>
+bool Gordian::TPrefixTree<T>::AddRank(KeyViewType Key, RankType Amount)
+{
+	const IndexType NodeIndex = FindNode(Key);
+	if (NodeIndex == k_InvalidIndex || _Nodes[NodeIndex].ValueIndex == k_InvalidIndex)
 	{
-		GE_LOG(LogPrefixTree, Warning, "Tried to split a node (%s) with an compatible SplitKey (%s)", CachedFullKey.c_str(), SplitSubKey.c_str());
 		return false;
 	}
 
-	if (InOutNextFreeNode == nullptr)
-	{
-		GE_LOG(LogPrefixTree, Warning, "Could not split prefix tree, not enough free nodes!");
-		return false;
-	}
+	const RankType NewRank = _Nodes[NodeIndex].Rank + Amount;
+	_Nodes[NodeIndex].Rank = NewRank;
 
-	KeyType MatchingSubString = "";
-	const size_t SmallerDivergingSubKeyLength = std::min(DivergingSubKey.length(), SplitSubKey.length());
-	for (size_t i = 0; i < SmallerDivergingSubKeyLength; ++i)
+	// Ranks only go up, so ancestors just need to know about the new rank
+	for (IndexType AncestorIndex = NodeIndex; AncestorIndex != k_InvalidIndex; AncestorIndex = _Nodes[AncestorIndex].Parent)
 	{
-		if (DivergingSubKey[i] != SplitSubKey[i])
+		FNode& Ancestor = _Nodes[AncestorIndex];
+		if (Ancestor.MaxRank >= NewRank)
 		{
 			break;
 		}
-
-		MatchingSubString.push_back(SplitSubKey[i]);
-	}
-
-	if (MatchingSubString.length() == 0)
-	{
-		GE_LOG(LogPrefixTree, Warning, "Tried to split a node (%s) with a non-competing SplitKey (%s)", DivergingSubKey.c_str(), SplitSubKey.c_str());
-		return false;
+		Ancestor.MaxRank = NewRank;
 	}
-	
-	// Create new node at split
-	TPrefixTreeNode<T>& NewChildNode = GetNextFreeNode(InOutNextFreeNode);
-	++OutNodesAdded;
-	
-	check(ParentNode != nullptr);
-	// Replace parent's child reference to be the new intermediate node
-	ParentNode->ChildrenNodes[DivergingSubKey[0]] = &NewChildNode;
-	NewChildNode.ParentNode = ParentNode;
-
-	NewChildNode.DivergingSubKey = MatchingSubString;
-	NewChildNode.CachedFullKey = ParentNode->CachedFullKey;
-	NewChildNode.CachedFullKey.append(NewChildNode.DivergingSubKey);
-
-	NewChildNode.CachedDescendantWords = CachedDescendantWords;
-
-	const KeyType& ContestedSubString = DivergingSubKey.substr(MatchingSubString.length());
-
-	// Update this node to be a child of new intermediate node
-	NewChildNode.ChildrenNodes[ContestedSubString[0]] = this;
-	ParentNode = &NewChildNode;
-
-	DivergingSubKey = ContestedSubString;
 
 	return true;
 }
 
 template<typename T>
-bool Gordian::TPrefixTreeNode<T>::DeepCopy(TPrefixTreeNode<T>& InDestination, TPrefixTreeNode<T>*& OutNextFreeNode) const
+template<typename VisitorT>
+size_t Gordian::TPrefixTree<T>::ForEachWithPrefix(KeyViewType Prefix, size_t MaxResults, VisitorT&& Visitor) const
 {
-	if (!bIsActive)
+	const IndexType StartIndex = FindPrefixNode(Prefix);
+	if (StartIndex == k_InvalidIndex)
 	{
-		GE_LOG(LogPrefixTree, Error, "Tried to copy a node that is currently not active");
-		return false;
+		return 0;
 	}
 
-	if (InDestination.ChildrenNodes.size() > 0)
+	// Walks the subtree in preorder, which is key order since children are sorted
+	size_t NumVisited = 0;
+	IndexType NodeIndex = StartIndex;
+	while (NumVisited < MaxResults)
 	{
-		GE_LOG(LogPrefixTree, Error, "Tried to copy a node into another node with existing children");
-		return false;
-	}
+		const FNode& Node = _Nodes[NodeIndex];
+		if (Node.ValueIndex != k_InvalidIndex)
+		{
+			++NumVisited;
+			if (!Visitor(GetKey(Node), _Values[Node.ValueIndex]))
+			{
+				break;
+			}
+		}
 
-	InDestination.bIsActive = bIsActive;
-	InDestination.CachedDescendantWords = CachedDescendantWords;
-	InDestination.CachedFullKey = CachedFullKey;
-	InDestination.DivergingSubKey = DivergingSubKey;
-	InDestination.WordValue = WordValue;
+		if (Node.FirstChild != k_InvalidIndex)
+		{
+			NodeIndex = Node.FirstChild;
+			continue;
+		}
 
-	for (const std::pair<CharType, TPrefixTreeNode<T>*>& KeyValuePair : ChildrenNodes)
-	{
-		const CharType& ChildKey = KeyValuePair.first;
-		check(KeyValuePair.second != nullptr);
-		const TPrefixTreeNode<T>& ChildNode = *KeyValuePair.second;
-		Gordian::TPrefixTreeNode<T>& NewChildAllocation = GetNextFreeNode(OutNextFreeNode);
+		// Climb until there is a sibling to move on to, without leaving the subtree
+		while (NodeIndex != StartIndex && _Nodes[NodeIndex].NextSibling == k_InvalidIndex)
+		{
+			NodeIndex = _Nodes[NodeIndex].Parent;
+		}
 
-		NewChildAllocation.ParentNode = &InDestination;
-		
-		ChildNode.DeepCopy(NewChildAllocation, OutNextFreeNode);
+		if (NodeIndex == StartIndex)
+		{
+			break;
+		}
 
-		InDestination.ChildrenNodes.emplace(ChildKey, &NewChildAllocation);
+		NodeIndex = _Nodes[NodeIndex].NextSibling;
 	}
 
-	return true;
+	return NumVisited;
 }
 
 template<typename T>
-TPrefixTreeNode<T>& Gordian::TPrefixTreeNode<T>::GetNextFreeNode(TPrefixTreeNode<T>*& InOutNextFreeNode) const
+template<typename VisitorT>
+size_t Gordian::TPrefixTree<T>::ForEachTopRankedWithPrefix(KeyViewType Prefix, size_t MaxResults, VisitorT&& Visitor) const
 {
-	check(InOutNextFreeNode != nullptr);
-	TPrefixTreeNode<T>* NewChildNode = InOutNextFreeNode;
-	InOutNextFreeNode = InOutNextFreeNode->NextUnusedNode;
+	const IndexType StartIndex = FindPrefixNode(Prefix);
+	if (StartIndex == k_InvalidIndex || MaxResults == 0)
+	{
+		return 0;
+	}
 
-	// Safety initialization
-	NewChildNode->Initialize(true);
+	// Subtrees are queued by the best rank beneath them, and words by their own rank.
+	//	A subtree's key comes before all of its words' keys, so popping ties in key order
+	//	means no word is visited while a subtree that should come first is still queued.
+	struct FQueuedNode
+	{
+		RankType Rank;
+		IndexType NodeIndex;
+		bool bIsWord;
+	};
 
-	return *NewChildNode;
-}
+	const auto IsVisitedAfter = [this](const FQueuedNode& A, const FQueuedNode& B)
+	{
+		if (A.Rank != B.Rank)
+		{
+			return A.Rank < B.Rank;
+		}
 
+		const int KeyComparison = GetKey(_Nodes[A.NodeIndex]).compare(GetKey(_Nodes[B.NodeIndex]));
+		if (KeyComparison != 0)
+		{
+			return KeyComparison > 0;
+		}
 
+		return !A.bIsWord && B.bIsWord;
+	};
 
-//--------------------------------------------------------------------------
-// Prefix Tree
-//--------------------------------------------------------------------------
-template<typename T>
-Gordian::TPrefixTree<T>::TPrefixTree()
-{
-	_NextUnusedNode = nullptr;
-	_ReservedNodeSpace = nullptr;
-	_ReserveSize = 0;
-	_NumWords = 0;
-	_NumNodes = 0;
-}
+	std::vector<FQueuedNode> Queue;
+	Queue.push_back(FQueuedNode{ _Nodes[StartIndex].MaxRank, StartIndex, false });
 
-template<typename T>
-Gordian::TPrefixTree<T>::TPrefixTree(size_t InReserveSize)
-	: TPrefixTree()
-{
-	Reserve(InReserveSize);
-}
+	size_t NumVisited = 0;
+	while (!Queue.empty() && NumVisited < MaxResults)
+	{
+		std::pop_heap(Queue.begin(), Queue.end(), IsVisitedAfter);
+		const FQueuedNode Next = Queue.back();
+		Queue.pop_back();
 
-template<typename T>
-Gordian::TPrefixTree<T>::TPrefixTree(const Gordian::TPrefixTree<T>& Other)
-	: TPrefixTree(Other._ReserveSize)
-{
-	_ReservedNodeSpace[0].DeepCopy(Other._ReservedNodeSpace[0], _NextUnusedNode);
-	_NumWords = Other._NumWords;
-	_NumNodes = Other._NumNodes;
-}
+		const FNode& Node = _Nodes[Next.NodeIndex];
+		if (Next.bIsWord)
+		{
+			++NumVisited;
+			if (!Visitor(GetKey(Node), _Values[Node.ValueIndex]))
+			{
+				break;
+			}
+			continue;
+		}
 
-template<typename T>
-Gordian::TPrefixTree<T>::TPrefixTree(Gordian::TPrefixTree<T>&& Other)
-{
-	_ReservedNodeSpace = Other._ReservedNodeSpace;
-	Other._ReservedNodeSpace = nullptr;
+		if (Node.ValueIndex != k_InvalidIndex)
+		{
+			Queue.push_back(FQueuedNode{ Node.Rank, Next.NodeIndex, true });
+			std::push_heap(Queue.begin(), Queue.end(), IsVisitedAfter);
+		}
 
-	_NextUnusedNode = Other._NextUnusedNode;
-	Other._NextUnusedNode = nullptr;
+		for (IndexType ChildIndex = Node.FirstChild; ChildIndex != k_InvalidIndex; ChildIndex = _Nodes[ChildIndex].NextSibling)
+		{
+			Queue.push_back(FQueuedNode{ _Nodes[ChildIndex].MaxRank, ChildIndex, false });
+			std::push_heap(Queue.begin(), Queue.end(), IsVisitedAfter);
+		}
+	}
 
-	_ReserveSize = Other._ReserveSize;
-	Other._ReserveSize = 0;
-	_NumWords = Other._NumWords;
-	Other._NumWords = 0;
-	_NumNodes = Other._NumNodes;
-	Other._NumNodes = 0;
+	return NumVisited;
 }
 
 template<typename T>
-Gordian::TPrefixTree<T>::~TPrefixTree()
+typename Gordian::TPrefixTree<T>::KeyViewType Gordian::TPrefixTree<T>::FindSharedPrefix(KeyViewType Prefix) const
 {
-	if (_ReservedNodeSpace != nullptr)
+	IndexType NodeIndex = FindPrefixNode(Prefix);
+	if (NodeIndex == k_InvalidIndex)
 	{
-		delete[] _ReservedNodeSpace;
-		_ReservedNodeSpace = nullptr;
+		return KeyViewType();
 	}
+
+	// Nodes only go unsplit at the root, which may have a single child and no word
+	while (_Nodes[NodeIndex].ValueIndex == k_InvalidIndex
+		   && _Nodes[NodeIndex].FirstChild != k_InvalidIndex
+		   && _Nodes[_Nodes[NodeIndex].FirstChild].NextSibling == k_InvalidIndex)
+	{
+		NodeIndex = _Nodes[NodeIndex].FirstChild;
+	}
+
+	return GetKey(_Nodes[NodeIndex]);
 }
 
 template<typename T>
-inline size_t Gordian::TPrefixTree<T>::MinCapacity() const
+bool Gordian::TPrefixTree<T>::Insert_Internal(KeyViewType Key,
+											  const T& Value,
+											  bool bAllowResize)
 {
-	// The first word always requires exactly two nodes.
-	// Worst case, each additional word requires a new split to be made.
-	// When a split is made, one node becomes 3 (preexisting word -> split + preexisting suffix + new word suffix)
-	// i.e. ReserveSize = 2 * WordCount 
+	// Nodes refer to the pool by 32 bit offsets
+	check(_KeyPool.size() + Key.size() < k_InvalidIndex);
 
-	if (_NumNodes <= 2)
+	if (_Nodes.empty() && (!bAllowResize || !ResizeTree(GetMaxNodesRequired(1))))
 	{
-		// Root costs 1, first word is never a split - so total 2 nodes
-		return _ReserveSize / 2;
+		GE_LOG(LogPrefixTree, Warning, "Could not add to prefix tree, no space has been reserved!");
+		return false;
 	}
-	else
+
+	const FInsertLocation Location = LocateInsertion(Key);
+	if (Location.Child == k_InvalidIndex && Location.Depth == Key.size() && _Nodes[Location.Parent].ValueIndex != k_InvalidIndex)
 	{
-		check(_ReserveSize >= _NumNodes);
+		GE_LOG(LogPrefixTree, Display, "Tried to add a node that already exists (%s)", KeyType(Key).c_str());
+		return false;
+	}
 
-		const size_t UnusedNodeCount = _ReserveSize - _NumNodes;
-		const size_t MinimumCapacityOfUnusedNodes = UnusedNodeCount / 2;
-		const size_t ReturnValue = _NumWords + MinimumCapacityOfUnusedNodes;
-		return ReturnValue;
+	const size_t NumNodesRequired = GetNumNodesRequired(Key, Location);
+	if (_Nodes.size() + NumNodesRequired > _ReserveSize)
+	{
+		if (!bAllowResize || !EnsureUnusedNodeSpace(NumNodesRequired))
+		{
+			GE_LOG(LogPrefixTree, Warning, "Could not add to prefix tree, not enough free nodes!");
+			return false;
+		}
 	}
-}
 
-template<typename T>
-inline size_t Gordian::TPrefixTree<T>::MaxCapacity() const
-{
-	// The first word always requires exactly two nodes.
-	// Best case, each additional word requires no splits - i.e. they all uniquely branch from the root
-	// When no split is made, only one node is added
-	// i.e. ReserveSize = WordCount + 1
+	IndexType WordNode = Location.Parent;
+	IndexType WordParent = Location.Parent;
+	IndexType WordPreviousSibling = Location.PreviousSibling;
+	size_t WordParentDepth = Location.Depth;
 
-	if (_NumNodes <= 1)
+	if (Location.Child != k_InvalidIndex)
 	{
-		return _ReserveSize - 1;
+		// The key diverges partway through Child, so that part becomes a node of its own
+		WordNode = SplitNode(Location);
+		WordParent = WordNode;
+		WordParentDepth = Location.Depth + Location.NumSharedCharacters;
+
+		// The split node's only child is what remains of Child, so the new word goes before or after it
+		const CharType NextCharacter = WordParentDepth < Key.size() ? Key[WordParentDepth] : CharType();
+		WordPreviousSibling = NextCharacter < _Nodes[Location.Child].FirstChar ? k_InvalidIndex : Location.Child;
 	}
-	else
+
+	if (WordParentDepth < Key.size())
 	{
-		check(_ReserveSize >= _NumNodes);
+		const IndexType KeyOffset = static_cast<IndexType>(_KeyPool.size());
+		_KeyPool.append(Key.data(), Key.size());
 
-		const size_t UnusedNodeCount = _ReserveSize - _NumNodes;
-		const size_t MaximumCapacityOfUnusedNodes = UnusedNodeCount;
-		const size_t ReturnValue = _NumWords + MaximumCapacityOfUnusedNodes;
-		return ReturnValue;
+		WordNode = AddNode(WordParent,
+						   WordPreviousSibling,
+						   KeyOffset,
+						   static_cast<IndexType>(Key.size()),
+						   static_cast<IndexType>(Key.size() - WordParentDepth));
 	}
-}
 
-template<typename T>
-inline size_t Gordian::TPrefixTree<T>::Num() const
-{
-	return _NumWords;
+	_Nodes[WordNode].ValueIndex = static_cast<IndexType>(_Values.size());
+	_Values.push_back(Value);
+	++_NumWords;
+
+	return true;
 }
 
 template<typename T>
-bool Gordian::TPrefixTree<T>::Reserve(size_t SizeInWords)
+/*static*/ size_t Gordian::TPrefixTree<T>::GetMaxNodesRequired(size_t WordCount)
 {
-	check(_ReserveSize >= 0);
-
-	const size_t SizeInNodes = GetMaxNodesRequired(SizeInWords, AllocateRootNode);
-	if (_ReserveSize >= SizeInNodes)
-	{
-		return true;
-	}
-
-	return ResizeTree(SizeInNodes);
+	// Each word after the first needs at most 2 nodes, and the first needs 1 on top of the root
+	return 2 * WordCount;
 }
 
 template<typename T>
-inline bool Gordian::TPrefixTree<T>::Insert(const KeyType& Key, const T& Value)
+inline typename Gordian::TPrefixTree<T>::KeyViewType Gordian::TPrefixTree<T>::GetKey(const FNode& Node) const
 {
-	return Insert_Internal(Key, Value, true);
+	return KeyViewType(_KeyPool.data() + Node.KeyOffset, Node.KeyLength);
 }
 
 template<typename T>
-bool Gordian::TPrefixTree<T>::InsertRigid(const KeyType& Key,
-										  const T& Value)
+inline typename Gordian::TPrefixTree<T>::KeyViewType Gordian::TPrefixTree<T>::GetSubKey(const FNode& Node) const
 {
-	return Insert_Internal(Key, Value, false);
+	return KeyViewType(_KeyPool.data() + Node.KeyOffset + Node.KeyLength - Node.SubKeyLength, Node.SubKeyLength);
 }
 
 template<typename T>
-bool Gordian::TPrefixTree<T>::Contains(const KeyType& Key) const
+typename Gordian::TPrefixTree<T>::IndexType Gordian::TPrefixTree<T>::FindNode(KeyViewType Key) const
 {
-	if (_ReservedNodeSpace == nullptr || !_ReservedNodeSpace[0].bIsActive)
+	if (_Nodes.empty())
 	{
-		GE_LOG(LogPrefixTree, Warning, "Tried to check if an uninitialized prefix tree contained key (%s)", Key.c_str());
-		return false;
+		return k_InvalidIndex;
 	}
 
-	auto NodeMatchingKey = _ReservedNodeSpace[0].CachedDescendantWords.find(Key);
+	IndexType NodeIndex = 0;
+	size_t Depth = 0;
+	while (Depth < Key.size())
+	{
+		// Children are sorted, so stop once past where the next character would be
+		const CharType NextCharacter = Key[Depth];
+		IndexType ChildIndex = _Nodes[NodeIndex].FirstChild;
+		while (ChildIndex != k_InvalidIndex && _Nodes[ChildIndex].FirstChar < NextCharacter)
+		{
+			ChildIndex = _Nodes[ChildIndex].NextSibling;
+		}
+
+		if (ChildIndex == k_InvalidIndex || _Nodes[ChildIndex].FirstChar != NextCharacter)
+		{
+			return k_InvalidIndex;
+		}
 
-	return NodeMatchingKey != _ReservedNodeSpace[0].CachedDescendantWords.cend();
+		const KeyViewType SubKey = GetSubKey(_Nodes[ChildIndex]);
+		if (Key.compare(Depth, SubKey.size(), SubKey) != 0)
+		{
+			return k_InvalidIndex;
+		}
+
+		NodeIndex = ChildIndex;
+		Depth += SubKey.size();
+	}
+
+	return NodeIndex;
 }
 
 template<typename T>
-const T* Gordian::TPrefixTree<T>::Find(const KeyType& Key) const
+typename Gordian::TPrefixTree<T>::IndexType Gordian::TPrefixTree<T>::FindPrefixNode(KeyViewType Prefix) const
 {
-	check(_ReservedNodeSpace != nullptr && _ReservedNodeSpace[0].bIsActive);
-
-	if (!Contains(Key))
+	if (_Nodes.empty())
 	{
-		return nullptr;
+		return k_InvalidIndex;
 	}
 
-	const TPrefixTreeNode<T>* _FoundNode = _ReservedNodeSpace[0].Find(Key);
-	if (_FoundNode != nullptr)
+	IndexType NodeIndex = 0;
+	size_t Depth = 0;
+	while (Depth < Prefix.size())
 	{
-		check(_FoundNode->bIsActive);
-		if (_FoundNode->GetKey() == Key && _FoundNode->IsFullWord())
+		const CharType NextCharacter = Prefix[Depth];
+		IndexType ChildIndex = _Nodes[NodeIndex].FirstChild;
+		while (ChildIndex != k_InvalidIndex && _Nodes[ChildIndex].FirstChar < NextCharacter)
 		{
-			return &_FoundNode->WordValue.Get();
+			ChildIndex = _Nodes[ChildIndex].NextSibling;
 		}
-	}
-	else
-	{
-		GE_LOG(LogPrefixTree,
-			   Error,
-			   "Root node belives it has a descendant of key '%s' but the matching node could not be found!",
-			   Key.c_str());
+
+		if (ChildIndex == k_InvalidIndex || _Nodes[ChildIndex].FirstChar != NextCharacter)
+		{
+			return k_InvalidIndex;
+		}
+
+		// A prefix ending partway through a sub-key still leads to everything beneath that node
+		const KeyViewType SubKey = GetSubKey(_Nodes[ChildIndex]);
+		const size_t NumCharactersToCompare = std::min(SubKey.size(), Prefix.size() - Depth);
+		if (Prefix.compare(Depth, NumCharactersToCompare, SubKey, 0, NumCharactersToCompare) != 0)
+		{
+			return k_InvalidIndex;
+		}
+
+		NodeIndex = ChildIndex;
+		Depth += SubKey.size();
 	}
 
-	return false;
+	return NodeIndex;
 }
 
 template<typename T>
-const T& Gordian::TPrefixTree<T>::At(const KeyType& Key) const
+typename Gordian::TPrefixTree<T>::FInsertLocation Gordian::TPrefixTree<T>::LocateInsertion(KeyViewType Key) const
 {
-	const T* FindResult = Find(Key);
-	check(FindResult != nullptr);
-	return *FindResult;
-}
+	check(!_Nodes.empty());
 
-template<typename T>
-bool Gordian::TPrefixTree<T>::Insert_Internal(const KeyType& Key,
-											  const T& Value,
-											  bool bAllowResize)
-{
-	check(_ReservedNodeSpace != nullptr);
-	check(_ReservedNodeSpace[0].bIsActive);
+	FInsertLocation Location;
+	Location.Parent = 0;
+	Location.Depth = 0;
 
-	bool bAddedWord = _ReservedNodeSpace[0].AddWord(Key, Value, _NextUnusedNode, _NumNodes);
-	if (bAllowResize && !bAddedWord && EnsureUnusedNodeSpace(2))
+	for (;;)
 	{
-		// We just needed more node space, try again
-		bAddedWord = _ReservedNodeSpace[0].AddWord(Key, Value, _NextUnusedNode, _NumNodes);
-	}
+		Location.Child = k_InvalidIndex;
+		Location.PreviousSibling = k_InvalidIndex;
+		Location.NumSharedCharacters = 0;
 
-	if (bAddedWord)
-	{
-		++_NumWords;
-	}
+		if (Location.Depth == Key.size())
+		{
+			return Location;
+		}
 
-	return bAddedWord;
-}
+		const CharType NextCharacter = Key[Location.Depth];
+		IndexType ChildIndex = _Nodes[Location.Parent].FirstChild;
+		while (ChildIndex != k_InvalidIndex && _Nodes[ChildIndex].FirstChar < NextCharacter)
+		{
+			Location.PreviousSibling = ChildIndex;
+			ChildIndex = _Nodes[ChildIndex].NextSibling;
+		}
 
-template<typename T>
-Gordian::TPrefixTreeNode<T>* Gordian::TPrefixTree<T>::CreateAndFormatTreeAllocation(size_t InDesiredSize)
-{
-	check(InDesiredSize > 0);
+		if (ChildIndex == k_InvalidIndex || _Nodes[ChildIndex].FirstChar != NextCharacter)
+		{
+			return Location;
+		}
 
-	TPrefixTreeNode<T>* NewAllocation = new TPrefixTreeNode<T>[InDesiredSize];
-	check(NewAllocation != nullptr);
+		const KeyViewType SubKey = GetSubKey(_Nodes[ChildIndex]);
+		const KeyViewType RemainingKey = Key.substr(Location.Depth);
+		const size_t MaxSharedCharacters = std::min(SubKey.size(), RemainingKey.size());
 
-	// Set up reserve space as a linked list of unused nodes 
-	TPrefixTreeNode<T>* LastUnusedNode = nullptr;
-	size_t i = InDesiredSize;
-	while (i > 0)
-	{
-		--i;
-		NewAllocation[i].NextUnusedNode = LastUnusedNode;
-		LastUnusedNode = &NewAllocation[i];
-		NewAllocation[i].bIsActive = false;
-	}
+		size_t NumSharedCharacters = 1;
+		while (NumSharedCharacters < MaxSharedCharacters && SubKey[NumSharedCharacters] == RemainingKey[NumSharedCharacters])
+		{
+			++NumSharedCharacters;
+		}
 
-	// Mark root as in use
-	NewAllocation[0].Initialize(true);
+		if (NumSharedCharacters < SubKey.size())
+		{
+			Location.Child = ChildIndex;
+			Location.NumSharedCharacters = NumSharedCharacters;
+			return Location;
+		}
 
-	return NewAllocation;
+		Location.Parent = ChildIndex;
+		Location.Depth += SubKey.size();
+	}
 }
 
 template<typename T>
-size_t Gordian::TPrefixTree<T>::GetMaxNodesRequired(size_t WordCount, EAccountForRootParam AccountForRoot)
+size_t Gordian::TPrefixTree<T>::GetNumNodesRequired(KeyViewType Key, const FInsertLocation& Location) const
 {
-	// Each extra node needs at most 2 additional nodes created, ignoring the first node
-	// If we're accounting for the root, then the math is simple
-	size_t MaxNodesRequired = 2 * WordCount;
-
-	if (AccountForRoot == IgnoreRootNode)
+	if (Location.Child == k_InvalidIndex)
 	{
-		// If we are not, just remove the one node needed by the root
-		--MaxNodesRequired;
+		// Either Parent is the word already, or the word branches off of it
+		return Location.Depth == Key.size() ? 0 : 1;
 	}
 
-	return MaxNodesRequired;
+	// Splitting Child makes a node for the shared part, and the word needs another unless it ends there
+	return Location.Depth + Location.NumSharedCharacters == Key.size() ? 1 : 2;
 }
 
 template<typename T>
-bool Gordian::TPrefixTree<T>::EnlargeTree(size_t DesiredIncrement)
-{
-	if (DesiredIncrement < 0)
-	{
-		return false;
-	}
+typename Gordian::TPrefixTree<T>::IndexType Gordian::TPrefixTree<T>::AddNode(IndexType Parent,
+																			  IndexType PreviousSibling,
+																			  IndexType KeyOffset,
+																			  IndexType KeyLength,
+																			  IndexType SubKeyLength)
+{
+	check(SubKeyLength > 0 && SubKeyLength <= KeyLength);
+
+	const IndexType NewIndex = static_cast<IndexType>(_Nodes.size());
+	IndexType& Link = PreviousSibling == k_InvalidIndex ? _Nodes[Parent].FirstChild : _Nodes[PreviousSibling].NextSibling;
+
+	FNode NewNode;
+	NewNode.KeyOffset = KeyOffset;
+	NewNode.KeyLength = KeyLength;
+	NewNode.SubKeyLength = SubKeyLength;
+	NewNode.Parent = Parent;
+	NewNode.FirstChild = k_InvalidIndex;
+	NewNode.NextSibling = Link;
+	NewNode.ValueIndex = k_InvalidIndex;
+	NewNode.Rank = 0;
+	NewNode.MaxRank = 0;
+	NewNode.FirstChar = _KeyPool[KeyOffset + KeyLength - SubKeyLength];
+
+	// Space was reserved up front, so Link is still valid after this
+	check(_Nodes.size() < _Nodes.capacity());
+	_Nodes.push_back(NewNode);
+	Link = NewIndex;
+
+	return NewIndex;
+}
 
-	return ResizeTree(_ReserveSize + DesiredIncrement);
+template<typename T>
+typename Gordian::TPrefixTree<T>::IndexType Gordian::TPrefixTree<T>::SplitNode(const FInsertLocation& Location)
+{
+	check(Location.Child != k_InvalidIndex);
+	check(Location.NumSharedCharacters > 0 && Location.NumSharedCharacters < _Nodes[Location.Child].SubKeyLength);
+
+	// The split node's key is a prefix of Child's, so it shares Child's place in the pool
+	const IndexType SplitIndex = AddNode(Location.Parent,
+										 Location.PreviousSibling,
+										 _Nodes[Location.Child].KeyOffset,
+										 static_cast<IndexType>(Location.Depth + Location.NumSharedCharacters),
+										 static_cast<IndexType>(Location.NumSharedCharacters));
+
+	FNode& Split = _Nodes[SplitIndex];
+	FNode& Child = _Nodes[Location.Child];
+
+	// Child moves from beside the split node to beneath it
+	Split.NextSibling = Child.NextSibling;
+	Split.FirstChild = Location.Child;
+	Split.MaxRank = Child.MaxRank;
+	Child.Parent = SplitIndex;
+	Child.NextSibling = k_InvalidIndex;
+	Child.SubKeyLength -= static_cast<IndexType>(Location.NumSharedCharacters);
+	Child.FirstChar = GetSubKey(Child)[0];
+
+	return SplitIndex;
 }
 
 template<typename T>
 bool Gordian::TPrefixTree<T>::ResizeTree(size_t InDesiredSize)
 {
-	check(InDesiredSize > 0);
-
-	checkMsgf(_NumNodes <= _ReserveSize, "PrefixTree should never have more items in it than it has reserved space for");
-	checkMsgf(_NumNodes >= 0, "PrefixTree should always have a non-negative item count");
-	checkMsgf(_ReserveSize >= 0, "PrefixTree should always have a non-negative reserve size");
+	checkMsgf(_Nodes.size() <= _ReserveSize, "PrefixTree should never have more items in it than it has reserved space for");
 
 	if (_ReserveSize >= InDesiredSize)
 	{
 		return true;
 	}
 
-	check(InDesiredSize >= 1);
+	// Nodes refer to each other by index, so moving them does not need any fix up
+	_Nodes.reserve(InDesiredSize);
+	_Values.reserve(InDesiredSize);
 
-	TPrefixTreeNode<T>* NewAllocation = CreateAndFormatTreeAllocation(InDesiredSize);
-	check(NewAllocation != nullptr);
-
-	// Mark root as in use
-	NewAllocation[0].bIsActive = true;
-	_NextUnusedNode = NewAllocation[0].NextUnusedNode;
-	_NumNodes = 1;
-
-	if (_NumWords > 0)
+	if (_Nodes.empty())
 	{
-		_ReservedNodeSpace[0].DeepCopy(NewAllocation[0], _NextUnusedNode);
+		FNode Root;
+		Root.KeyOffset = 0;
+		Root.KeyLength = 0;
+		Root.SubKeyLength = 0;
+		Root.Parent = k_InvalidIndex;
+		Root.FirstChild = k_InvalidIndex;
+		Root.NextSibling = k_InvalidIndex;
+		Root.ValueIndex = k_InvalidIndex;
+		Root.Rank = 0;
+		Root.MaxRank = 0;
+		Root.FirstChar = CharType();
+		_Nodes.push_back(Root);
 	}
 
-	// Commit new allocation
-	delete[] _ReservedNodeSpace;
-	_ReservedNodeSpace = NewAllocation;
 	_ReserveSize = InDesiredSize;
-
 	return true;
 }
 
-template<typename T>
-bool Gordian::TPrefixTree<T>::HasAllocatedTree() const
-{
-	return _ReservedNodeSpace != nullptr && _ReservedNodeSpace[0].bIsActive;
-}
-
 template<typename T>
 bool Gordian::TPrefixTree<T>::EnsureUnusedNodeSpace(size_t DesiredUnusedSpace)
 {
-	const size_t MissingNodeSpace = _NumNodes + DesiredUnusedSpace - _ReserveSize;
-	if (MissingNodeSpace > 0)
+	const size_t RequiredSize = _Nodes.size() + DesiredUnusedSpace;
+	if (RequiredSize <= _ReserveSize)
 	{
-		return EnlargeTree(MissingNodeSpace);
+		return true;
 	}
 
-	return false;
+	// Grow geometrically so inserting many words does not copy the tree each time
+	return ResizeTree(std::max(RequiredSize, 2 * _ReserveSize));
 }
 
 
@@ -2,110 +2,22 @@
 
 #pragma once
 
-#include <map>
-#include <set>
+#include <cstdint>
 #include <string>
-#include <utility>
-
-#include "GordianEngine/Containers/Public/TOptional.h"
+#include <string_view>
+#include <vector>
 
 namespace Gordian
 {
 
-template<typename T>
-class TPrefixTree;
-
-// Describes a node in a prefix tree
-template<typename MappedT>
-class TPrefixTreeNode
-{
-public:
-
-	friend class TPrefixTree<MappedT>;
-
-	//----------------------------------------------------------
-	// Eventually these should be part of the template
-	using KeyType	= std::string;
-	using CharType	= char;
-	//----------------------------------------------------------
-
-	TPrefixTreeNode();
-
-	// Accessors
-
-	// Returns true if this node's key is a full word that was entered into the tree
-	bool IsFullWord() const;
-
-	// Returns the key for this node
-	const KeyType& GetKey() const { return CachedFullKey; }
-
-
-private:
-
-	// Re-initializes the node
-	void Initialize(bool bInIsActive);
-
-	// Returns the next free node, updating the in-out pointer
-	TPrefixTreeNode<MappedT>& GetNextFreeNode(TPrefixTreeNode<MappedT>*& InOutNextFreeNode) const;
-
-	// Returns true if the passed in key could be a child key of this node
-	bool HasMatchingKey(const KeyType& TestKey) const;
-
-	// Returns true if the passed in diverging sub-key starts with this node's 
-	//	DivergingSubKey.
-	bool HasMatchingDivergingKey(const KeyType& TestDivergingSubKey) const;
-
-	// Recursive search to find the first node with a DivergingSubKey >= InDivergingSubKey
-	const TPrefixTreeNode<MappedT>* Find(const KeyType& InDivergingSubKey) const;
-
-	// Adds a child word with the given key using the passed data struct.
-	// Returns whether or not the child was successfully added.
-	bool AddWord(const KeyType& InWordDivergingSubKey,
-				 const MappedT& InWordValue,
-				 TPrefixTreeNode<MappedT>*& InOutNextFreeNode,
-				 size_t& OutNodesAdded);
-
-	// Splits the node that overlaps the passed in key so both nodes can exist.
-	// SplitSubKey should be the desired DivergingSubKey that this node competes with.
-	bool SplitNode(const KeyType& SplitSubKey,
-				   TPrefixTreeNode<MappedT>*& InOutNextFreeNode,
-				   size_t& OutNodesAdded);
-
-	// Copies all data in this node to the passed node, ignoring pointer specific values
-	bool DeepCopy(TPrefixTreeNode<MappedT>& InDestination, TPrefixTreeNode<MappedT>*& OutNextFreeNode) const;
-
-	// Map of all child nodes
-	std::map<CharType, TPrefixTreeNode<MappedT>*> ChildrenNodes;
-
-	// Cached set of all words for descendant nodes
-	std::set<KeyType> CachedDescendantWords;
-
-	// Portion of this node's key that diverges from parent
-	KeyType DivergingSubKey;
-
-	// Cache of this node's full key
-	KeyType CachedFullKey;
-
-	// If this node completes a word, then this is the value of that word key
-	TOptional<MappedT> WordValue;
-
-	// Flags if this is currently in use.
-	// If it is, ParentNode is valid. Otherwise NextUnusedNode is valid.
-	bool bIsActive;
-
-	union
-	{
-		// Next Unused Node in allocation
-		TPrefixTreeNode<MappedT>* NextUnusedNode;
-
-		// Parent Node
-		TPrefixTreeNode<MappedT>* ParentNode;
-	};
-
-};	// class TPrefixTreeNode
-
 
 // A map from strings to some arbitrary type where a list of possible keys from a given prefix can be found.
+// Stored as a radix tree: each node holds the part of its key that diverges from its parent.
+//	Nodes live in one array and refer to each other by index, and keys are stored once in a
+//	shared pool that nodes refer to by offset, so inserting does not allocate until the tree
+//	outgrows its reserved space.
+// Words can be ranked, such as by how often they are used, so prefix queries can return the best matches first.
+// Pointers returned by Find are invalidated when the tree grows.
 template<typename MappedT>
 class TPrefixTree
 {
@@ -113,9 +25,12 @@ public:
 
 	//----------------------------------------------------------
 	// Eventually these should be part of the template
-	using KeyType	= std::string;
-	using CharType	= char;
+	using KeyType		= std::string;
+	using KeyViewType	= std::string_view;
+	using CharType		= char;
 	//----------------------------------------------------------
+
+	using RankType		= std::uint32_t;
 	
 
 	TPrefixTree();
@@ -123,7 +38,8 @@ public:
 	TPrefixTree(const TPrefixTree& Other);
 	TPrefixTree(TPrefixTree&& Other);
 
-	~TPrefixTree();
+	TPrefixTree& operator=(const TPrefixTree& Other);
+	TPrefixTree& operator=(TPrefixTree&& Other);
 
 	// Minimum number of words this tree can hold
 	size_t MinCapacity() const;
@@ -139,62 +55,142 @@ public:
 
 	// Inserts a new pairing into the tree.
 	// Returns true if the insert was successful.
-	bool Insert(const KeyType& Key, 
+	bool Insert(KeyViewType Key, 
 				const MappedT& Value);
 
 	// Inserts a new pairing into the tree.
 	// Fails if there is not enough room to add the value
 	// Returns true if the insert was successful.
-	bool InsertRigid(const KeyType& Key,
-					const MappedT& Value);
+	bool InsertRigid(KeyViewType Key,
+					 const MappedT& Value);
 
 	// Returns true if the Prefix Tree contains a key-value pair at the specified key
-	bool Contains(const KeyType& Key) const;
+	bool Contains(KeyViewType Key) const;
 
 	// Returns the mapped value for the given key.
 	// Returns nullptr if there was no mapped value at the specified key.
-	const MappedT* Find(const KeyType& Key) const;
+	const MappedT* Find(KeyViewType Key) const;
+	MappedT* Find(KeyViewType Key);
 
 	// Returns the mapped value for the given key.
 	// Asserts if there was no mapped value at the specified key.
-	const MappedT& At(const KeyType& Key) const;
+	const MappedT& At(KeyViewType Key) const;
+
+	// Raises the rank of the word at Key by Amount. Words start at rank 0.
+	// Returns false if there is no word at the specified key.
+	bool AddRank(KeyViewType Key, RankType Amount = 1);
+
+	// Calls Visitor(Key, Value) for each word starting with Prefix, in key order, until MaxResults
+	//	words have been visited or Visitor returns false. Only as much of the tree is walked as is visited.
+	// Keys passed to Visitor are only valid until the tree changes.
+	// Returns the number of words visited.
+	template<typename VisitorT>
+	size_t ForEachWithPrefix(KeyViewType Prefix, size_t MaxResults, VisitorT&& Visitor) const;
+
+	// As ForEachWithPrefix, but visits the highest ranked words first, in key order where ranks tie.
+	//	Subtrees that cannot outrank what is being visited are not expanded.
+	template<typename VisitorT>
+	size_t ForEachTopRankedWithPrefix(KeyViewType Prefix, size_t MaxResults, VisitorT&& Visitor) const;
+
+	// Returns the longest key that every word starting with Prefix also starts with,
+	//	or an empty key if no word starts with Prefix. Only valid until the tree changes.
+	KeyViewType FindSharedPrefix(KeyViewType Prefix) const;
 
 protected:
 
-	bool Insert_Internal(const KeyType& Key,
-						const MappedT& Value,
-						bool bAllowResize);
+	bool Insert_Internal(KeyViewType Key,
+						 const MappedT& Value,
+						 bool bAllowResize);
 
 private:
 
-	enum EAccountForRootParam
+	using IndexType = std::uint32_t;
+
+	static constexpr IndexType k_InvalidIndex = ~IndexType(0);
+
+	struct FNode
+	{
+		// This node's full key, in _KeyPool. The last SubKeyLength characters diverge from the parent.
+		IndexType KeyOffset;
+		IndexType KeyLength;
+		IndexType SubKeyLength;
+
+		// Children are kept in a list sorted by the first character of their sub-keys
+		IndexType Parent;
+		IndexType FirstChild;
+		IndexType NextSibling;
+
+		// Index into _Values if this node's key is a word
+		IndexType ValueIndex;
+
+		// Rank of this node's word, and the highest rank of any word at or beneath this node
+		RankType Rank;
+		RankType MaxRank;
+
+		// First character of the sub-key, so siblings can be searched without reading the pool
+		CharType FirstChar;
+	};
+
+	// Where a key would be inserted, found without changing the tree
+	struct FInsertLocation
 	{
-		AllocateRootNode = 0,
-		IgnoreRootNode = 1
+		// Deepest node whose key is a prefix of the inserted key
+		IndexType Parent;
+		// Child of Parent sharing the next character of the inserted key, if any
+		IndexType Child;
+		// Sibling that comes before the new or split node in Parent's children, if any
+		IndexType PreviousSibling;
+		// Length of Parent's key
+		size_t Depth;
+		// Characters Child's sub-key shares with the rest of the inserted key
+		size_t NumSharedCharacters;
 	};
 
-	static TPrefixTreeNode<MappedT>* CreateAndFormatTreeAllocation(size_t DesiredSize);
+	// Returns the max number of nodes required to store WordCount words, including the root
+	static size_t GetMaxNodesRequired(size_t WordCount);
+
+	KeyViewType GetKey(const FNode& Node) const;
+	KeyViewType GetSubKey(const FNode& Node) const;
+
+	// Returns the index of the node whose key is exactly Key, or k_InvalidIndex if there is none
+	IndexType FindNode(KeyViewType Key) const;
+
+	// Returns the index of the highest node whose key starts with Prefix, or k_InvalidIndex if there is none
+	IndexType FindPrefixNode(KeyViewType Prefix) const;
+
+	FInsertLocation LocateInsertion(KeyViewType Key) const;
+
+	// Returns the number of nodes inserting at Location would add
+	size_t GetNumNodesRequired(KeyViewType Key, const FInsertLocation& Location) const;
+
+	// Adds a node after PreviousSibling in Parent's children
+	IndexType AddNode(IndexType Parent,
+					  IndexType PreviousSibling,
+					  IndexType KeyOffset,
+					  IndexType KeyLength,
+					  IndexType SubKeyLength);
 
-	// Returns the max number of nodes required to store WordCount words
-	static size_t GetMaxNodesRequired(size_t WordCount, EAccountForRootParam AccountForRoot);
+	// Splits Child so its first NumSharedCharacters characters become a new node in its place.
+	//	Returns the new node, whose only child is Child.
+	IndexType SplitNode(const FInsertLocation& Location);
 
-	bool EnlargeTree(size_t DesiredIncrement);
 	bool ResizeTree(size_t DesiredSize);
 
-	// Returns true if the node space was increased
+	// Returns true if there is room for DesiredUnusedSpace more nodes, growing the tree if needed
 	bool EnsureUnusedNodeSpace(size_t DesiredUnusedSpace);
 
-	bool HasAllocatedTree() const;
+	// All nodes, starting with the root
+	std::vector<FNode> _Nodes;
 
-	// The next free node in the allocation
-	TPrefixTreeNode<MappedT>* _NextUnusedNode;
+	// Values of every word, in the order they were inserted
+	std::vector<MappedT> _Values;
 
-	// Allocated Array of all nodes
-	TPrefixTreeNode<MappedT>* _ReservedNodeSpace;
+	// Keys of every node, each stored once. Split nodes share the keys of their descendants.
+	KeyType _KeyPool;
 
+	// Number of nodes there is room for, including the root
 	size_t _ReserveSize;
 	size_t _NumWords;
-	size_t _NumNodes;
 
 
 };	// class TPrefixTree
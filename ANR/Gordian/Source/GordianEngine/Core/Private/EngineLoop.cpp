@@ -5,29 +5,70 @@
 #include "SFML/Window/Event.hpp"
 #include "SFML/Graphics/RenderWindow.hpp"
 
+#include "GordianEngine/Core/Public/EventBus.h"
+#include "GordianEngine/Core/Public/JobSystem.h"
 #include "GordianEngine/Debug/Public/Asserts.h"
 #include "GordianEngine/Debug/Public/CommandPrompt.h"
 #include "GordianEngine/Debug/Public/Logging.h"
+#include "GordianEngine/Debug/Public/Profiler.h"
+#include "GordianEngine/Debug/Public/StatsOverlay.h"
 #include "GordianEngine/FileIO/Public/IniManager.h"
 #include "GordianEngine/FileIO/Public/StackableIniReader.h"
 #include "GordianEngine/Input/Public/InputManager.h"
 #include "GordianEngine/Platform/Public/Platform.h"
 #include "GordianEngine/Platform/Public/ConsoleFormatting.h"
+#include "GordianEngine/Rendering/Public/AssetLoader.h"
+#include "GordianEngine/Rendering/Public/TextureCache.h"
 #include "GordianEngine/World/Public/World.h"
 
 #include "inih/INIReader.h"
 
+#include <cstdio>
+#include <cstring>
+
 using namespace Gordian;
 
+namespace
+{
+	// Ticks averaging more than this fraction of their step are falling behind
+	const float k_SlowTickFraction = 0.8f;
+	// The rate is only raised again if ticks would take less than this fraction of the faster step
+	const float k_FastTickFraction = 0.5f;
+	// Frames to wait after changing the tick rate before changing it again
+	const sf::Uint32 k_TickRateChangeCooldown = 60;
+	// Weight given to the newest tick in the average tick cost
+	const float k_TickCostSmoothing = 0.125f;
+	// Command line flags followed by the path of an input recording
+	const char* k_RecordInputFlag = "-recordinput=";
+	const char* k_ReplayInputFlag = "-replayinput=";
+	// Where profile.export writes to when not given a path
+	const char* k_DefaultProfileFilepath = "../Netrunner/Saved/Profile.json";
+}
+
 FEngineLoop::FEngineLoop()
     : GameWindow(nullptr)
 	, InputManager(nullptr)
 	, GameWorld(nullptr)
     , TickConsumptionStepSize(sf::Time::Zero)
     , TimePendingTickConsumption(sf::Time::Zero)
+	, TargetTickRate(30)
+	, MinTickRate(30)
+	, CurrentTickRate(30)
+	, MaxTicksPerFrame(5)
+	, AverageTickCost(sf::Time::Zero)
+	, FramesSinceTickRateChange(0)
+	, bIsTickRatePinned(false)
+	, FrameTickTime(sf::Time::Zero)
     , bIsRequestingExit(false)
+	, bIsHeadless(false)
+	, MaxHeadlessTicks(0)
+	, NumTicksSimulated(0)
+	, MaxTextureUploadsPerFrame(0)
+	, InputRecordingPath()
+	, InputReplayPath()
+	, InputReplayer()
 {
-    TickConsumptionStepSize = sf::milliseconds(1000 / 30);
+    SetTickRate(CurrentTickRate);
 }
 
 FEngineLoop::~FEngineLoop()
@@ -38,10 +79,15 @@ FEngineLoop::~FEngineLoop()
 
 sf::Int32 FEngineLoop::Init(int argc, char** argv)
 {
+	// Logs made during static initialization were written on the spot, from here on they are batched
+	GLogOutputManager.StartWriterThread();
+
 	GE_LOG(LogCore, Log, "Initializing Core Loop...");
 
 	sf::Int32 ErrorCode = 0;
 
+	LoadSimulationSettings();
+
 	ErrorCode = ParseCommandArgs(argc, argv);
 	if (ErrorCode != 0)
 	{
@@ -59,33 +105,176 @@ sf::Int32 FEngineLoop::Init(int argc, char** argv)
 	}
 #endif
 
-	char FilenameFromPath[50];
-	_splitpath_s(argv[0], NULL, 0, NULL, 0, FilenameFromPath, 50, NULL, 0);
+	if (bIsHeadless)
+	{
+		GE_LOG(LogCore, Log, "Running headless, no window will be created.");
+	}
+	else
+	{
+		char FilenameFromPath[50];
+		_splitpath_s(argv[0], NULL, 0, NULL, 0, FilenameFromPath, 50, NULL, 0);
 
-    ErrorCode = InitializeGameWindow(FilenameFromPath);
-    if (ErrorCode != 0)
-    {
-        return ErrorCode;
-    }
+		ErrorCode = InitializeGameWindow(FilenameFromPath);
+		if (ErrorCode != 0)
+		{
+			return ErrorCode;
+		}
+
+		RegisterConsoleCommands();
+	}
 
 	// Initialize classes
 
+	ErrorCode = InitializeJobSystem();
+	if (ErrorCode != 0)
+	{
+		return ErrorCode;
+	}
+
+	ErrorCode = InitializeAssetStreaming();
+	if (ErrorCode != 0)
+	{
+		return ErrorCode;
+	}
+
 	InputManager = new FInputManager();
+	if (!InputRecordingPath.empty() && !InputManager->StartRecording(InputRecordingPath, CurrentTickRate))
+	{
+		return 1;
+	}
+	if (!InputReplayPath.empty())
+	{
+		if (!InputReplayer.Open(InputReplayPath))
+		{
+			return 1;
+		}
+
+		SetTickRate(InputReplayer.GetTickRate());
+	}
+
+	// Recordings are keyed on tick index, so a tick must cover the same time from start to finish
+	bIsTickRatePinned = !InputRecordingPath.empty() || !InputReplayPath.empty();
+
 	GameWorld = FGlobalObjectLibrary::CreateObject<OWorld>(nullptr, OWorld::GetStaticType(), "GameWorld");
     bIsRequestingExit = false;
     TickDurationClock.restart();
+	NumTicksSimulated = 0;
+	SimulationClock.restart();
 
 	GE_LOG(LogCore, Log, "Core Loop Initialized Successfully.");
     return ErrorCode;
 }
 
+void FEngineLoop::LoadSimulationSettings()
+{
+	const INIReader& IniReader = IniManager::Get().GetIniCategory("Engine");
+
+	bIsHeadless = IniReader.GetBoolean("Simulation", "Headless", false);
+
+	const long MaxTicks = IniReader.GetInteger("Simulation", "MaxHeadlessTicks", 0);
+	MaxHeadlessTicks = MaxTicks > 0 ? static_cast<sf::Uint64>(MaxTicks) : 0;
+
+	const long TickRate = IniReader.GetInteger("Simulation", "TickRate", 30);
+	TargetTickRate = TickRate > 0 ? static_cast<sf::Uint32>(TickRate) : 30;
+
+	const long MinimumTickRate = IniReader.GetInteger("Simulation", "MinTickRate", TargetTickRate / 2);
+	MinTickRate = MinimumTickRate > 0 ? static_cast<sf::Uint32>(MinimumTickRate) : 1;
+	MinTickRate = MinTickRate < TargetTickRate ? MinTickRate : TargetTickRate;
+
+	const long MaxCatchUpTicks = IniReader.GetInteger("Simulation", "MaxTicksPerFrame", 5);
+	MaxTicksPerFrame = MaxCatchUpTicks > 0 ? static_cast<sf::Uint32>(MaxCatchUpTicks) : 1;
+
+	SetTickRate(TargetTickRate);
+}
+
+void FEngineLoop::SetTickRate(sf::Uint32 TickRate)
+{
+	check(TickRate > 0);
+
+	CurrentTickRate = TickRate;
+	TickConsumptionStepSize = sf::microseconds(1000000 / TickRate);
+	FramesSinceTickRateChange = 0;
+}
+
+void FEngineLoop::UpdateTickRate()
+{
+	if (bIsTickRatePinned)
+	{
+		return;
+	}
+
+	++FramesSinceTickRateChange;
+	if (FramesSinceTickRateChange < k_TickRateChangeCooldown)
+	{
+		return;
+	}
+
+	const float AverageTickMilliseconds = AverageTickCost.asSeconds() * 1000.f;
+
+	if (CurrentTickRate > MinTickRate && AverageTickCost > TickConsumptionStepSize * k_SlowTickFraction)
+	{
+		// Drop a quarter of the rate at a time, so one slow patch does not halve it
+		const sf::Uint32 RateDrop = (CurrentTickRate + 3) / 4;
+		const sf::Uint32 NewTickRate = CurrentTickRate - RateDrop > MinTickRate ? CurrentTickRate - RateDrop : MinTickRate;
+
+		GE_LOG(LogCore, Warning, "Ticks take %.2f ms on average, lowering tick rate from %u to %u.",
+			   AverageTickMilliseconds, CurrentTickRate, NewTickRate);
+		SetTickRate(NewTickRate);
+	}
+	else if (CurrentTickRate < TargetTickRate)
+	{
+		const sf::Uint32 RateRise = (CurrentTickRate + 3) / 4;
+		const sf::Uint32 NewTickRate = CurrentTickRate + RateRise < TargetTickRate ? CurrentTickRate + RateRise : TargetTickRate;
+
+		const sf::Time FasterStepSize = sf::microseconds(1000000 / NewTickRate);
+		if (AverageTickCost < FasterStepSize * k_FastTickFraction)
+		{
+			GE_LOG(LogCore, Display, "Ticks take %.2f ms on average, raising tick rate from %u to %u.",
+				   AverageTickMilliseconds, CurrentTickRate, NewTickRate);
+			SetTickRate(NewTickRate);
+		}
+	}
+}
+
 sf::Int32 FEngineLoop::ParseCommandArgs(int argc, char** argv)
 {
 	check(argc > 0);
 	for (int i = 1; i < argc; ++i)
 	{
-		// This should become data driven
-		return LoadProject(argv[i]);
+		const char* Arg = argv[i];
+		if (Arg[0] != '-')
+		{
+			// This should become data driven
+			const sf::Int32 ErrorCode = LoadProject(Arg);
+			if (ErrorCode != 0)
+			{
+				return ErrorCode;
+			}
+			continue;
+		}
+
+		unsigned long long MaxTicks = 0;
+		if (std::strcmp(Arg, "-headless") == 0)
+		{
+			bIsHeadless = true;
+		}
+		else if (std::sscanf(Arg, "-maxticks=%llu", &MaxTicks) == 1)
+		{
+			MaxHeadlessTicks = MaxTicks;
+		}
+		else if (std::strncmp(Arg, k_RecordInputFlag, std::strlen(k_RecordInputFlag)) == 0)
+		{
+			InputRecordingPath = Arg + std::strlen(k_RecordInputFlag);
+		}
+		else if (std::strncmp(Arg, k_ReplayInputFlag, std::strlen(k_ReplayInputFlag)) == 0)
+		{
+			InputReplayPath = Arg + std::strlen(k_ReplayInputFlag);
+		}
+		else
+		{
+			GE_LOG(LogCore, Error, "Unknown command line flag: %s", Arg);
+			return 1;
+		}
 	}
 
 	return 0;
@@ -112,30 +301,181 @@ sf::Int32 FEngineLoop::InitializeGameWindow(const char* WindowTitle)
     return 0;
 }
 
+sf::Int32 FEngineLoop::InitializeJobSystem()
+{
+	const INIReader& IniReader = IniManager::Get().GetIniCategory("Engine");
+
+	// Ticking stays on the main thread unless workers are asked for.
+	// Negative counts fall back to one worker per spare core.
+	const long WorkerThreads = IniReader.GetInteger("Threading", "WorkerThreads", 0);
+	const sf::Uint32 NumWorkers = WorkerThreads < 0 ? FJobSystem::GetDefaultNumWorkers()
+													: static_cast<sf::Uint32>(WorkerThreads);
+
+	FJobSystem::Get().Start(NumWorkers);
+	return 0;
+}
+
+sf::Int32 FEngineLoop::InitializeAssetStreaming()
+{
+	const INIReader& IniReader = IniManager::Get().GetIniCategory("Engine");
+
+	const long TextureBudgetMB = IniReader.GetInteger("Graphics", "TextureCacheBudgetMB", 256);
+	FTextureCache::Get().SetMemoryBudget(TextureBudgetMB > 0 ? static_cast<size_t>(TextureBudgetMB) * 1024 * 1024 : 0);
+
+	const long TextureUploads = IniReader.GetInteger("Graphics", "TextureUploadsPerFrame", 4);
+	MaxTextureUploadsPerFrame = TextureUploads > 0 ? static_cast<size_t>(TextureUploads) : 1;
+
+	// Started with or without a window, so textures requested by a headless run are still delivered
+	const long LoaderThreads = IniReader.GetInteger("Threading", "AssetLoaderThreads", 2);
+	FAssetLoader::Get().Start(LoaderThreads > 0 ? static_cast<sf::Uint32>(LoaderThreads) : 0);
+	return 0;
+}
+
+void FEngineLoop::RegisterConsoleCommands()
+{
+	FCommandPrompt& CommandPrompt = FCommandPrompt::Get();
+
+	// profile.export [path]: writes recorded markers as a trace chrome://tracing can open
+	CommandPrompt.RegisterCommand("profile.export", [](const std::vector<std::string>& Arguments)
+	{
+		FProfiler::Get().ExportChromeTrace(Arguments.empty() ? k_DefaultProfileFilepath : Arguments[0]);
+	});
+
+	// profile.clear: forgets recorded markers, so the next export only covers what follows
+	CommandPrompt.RegisterCommand("profile.clear", [](const std::vector<std::string>& Arguments)
+	{
+		FProfiler::Get().Clear();
+	});
+
+	// stats: shows or hides frame, tick, draw call and memory stats
+	CommandPrompt.RegisterCommand("stats", [](const std::vector<std::string>& Arguments)
+	{
+		FStatsOverlay::Get().Toggle();
+	});
+}
+
 void FEngineLoop::Tick()
 {
 	check(!bIsRequestingExit);
 
+	if (bIsHeadless)
+	{
+		// Only replays have input without a window
+		ParseInput();
+		if (bIsRequestingExit)
+		{
+			return;
+		}
+
+		FEventBus::Get().Dispatch();
+		InputManager->BroadcastAnalogInput();
+
+		// Nothing is waiting on the wall clock, so step as fast as we can.
+		// The tick rate is never adapted here, so headless runs always use the configured step.
+		Tick(TickConsumptionStepSize);
+
+		// Nothing is drawn, but anything waiting on a streamed texture still gets it
+		FAssetLoader::Get().DeliverDecodedImages(MaxTextureUploadsPerFrame);
+
+		if (MaxHeadlessTicks > 0 && NumTicksSimulated >= MaxHeadlessTicks)
+		{
+			RequestExit();
+		}
+		return;
+	}
+
     ParseInput();
 
-    TimePendingTickConsumption += TickDurationClock.restart();
-    while (TimePendingTickConsumption >= TickConsumptionStepSize)
-    {
-        Tick(TickConsumptionStepSize);
+	// Input is handled before the world ticks on it
+	FEventBus::Get().Dispatch();
+	InputManager->BroadcastAnalogInput();
 
-        TimePendingTickConsumption -= TickConsumptionStepSize;
-    }
+    const sf::Time FrameTime = TickDurationClock.restart();
+	FrameTickTime = sf::Time::Zero;
+
+	ConsumeFrameTime(FrameTime);
+
+	// Whatever the ticks posted is handled before it is drawn
+	FEventBus::Get().Dispatch();
 
     // In order to smooth motion of objects, we use the leftover time that has
     // not been passed through update to estimate positions of renderable objects.
     const float BlendFactor = TimePendingTickConsumption / TickConsumptionStepSize;
 	check(BlendFactor >= 0.f && BlendFactor < 1.f);
+
+	// Uploads are spread over frames so streaming many textures at once does not stall one
+	FAssetLoader::Get().DeliverDecodedImages(MaxTextureUploadsPerFrame);
+
     Render(TimePendingTickConsumption);
+
+	FFrameStats FrameStats;
+	FrameStats.FrameTime = FrameTime;
+	FrameStats.TickTime = FrameTickTime;
+	FrameStats.NumDrawCalls = GameWorld != nullptr ? GameWorld->GetNumDrawCalls() : 0;
+	FStatsOverlay::Get().RecordFrame(FrameStats);
+}
+
+sf::Uint32 FEngineLoop::ConsumeFrameTime(const sf::Time& FrameTime)
+{
+    TimePendingTickConsumption += FrameTime;
+
+	// The step must not change between consuming time and blending what is left of it
+	UpdateTickRate();
+
+	sf::Uint32 NumTicksThisFrame = 0;
+    while (TimePendingTickConsumption >= TickConsumptionStepSize && NumTicksThisFrame < MaxTicksPerFrame)
+    {
+        Tick(TickConsumptionStepSize);
+
+        TimePendingTickConsumption -= TickConsumptionStepSize;
+		++NumTicksThisFrame;
+    }
+
+	// Catching up on everything after a long hitch would only cause a longer one
+	if (TimePendingTickConsumption >= TickConsumptionStepSize)
+	{
+		const long long NumDroppedTicks = static_cast<long long>(TimePendingTickConsumption / TickConsumptionStepSize);
+		GE_LOG(LogCore, Verbose, "Fell %lld ticks behind, dropping them.", NumDroppedTicks);
+		TimePendingTickConsumption %= TickConsumptionStepSize;
+	}
+
+	return NumTicksThisFrame;
 }
 
 void FEngineLoop::ParseInput()
 {
-	check(GameWindow != nullptr && InputManager != nullptr);
+	GE_PROFILE_SCOPE("FEngineLoop::ParseInput");
+
+	check(InputManager != nullptr);
+
+	// Events are tagged with the tick they arrive before, which is the next to be simulated
+	InputManager->SetCurrentTickIndex(NumTicksSimulated);
+
+	const bool bIsReplayingInput = InputReplayer.IsReplaying();
+	if (bIsReplayingInput)
+	{
+		sf::Event Event;
+		while (InputReplayer.PollEvent(NumTicksSimulated, Event))
+		{
+			InputManager->HandleWindowEvent(Event);
+		}
+
+		if (!InputReplayer.IsReplaying())
+		{
+			GE_LOG(LogCore, Log, "Input replay finished after %llu ticks.", static_cast<unsigned long long>(NumTicksSimulated));
+
+			// A finished replay is a finished benchmark, unless told to run for longer
+			if (bIsHeadless && MaxHeadlessTicks == 0)
+			{
+				RequestExit();
+			}
+		}
+	}
+
+	if (GameWindow == nullptr)
+	{
+		return;
+	}
 
     sf::Event Event;
     while (GameWindow->pollEvent(Event))
@@ -151,23 +491,40 @@ void FEngineLoop::ParseInput()
 			// Command prompt has hogged this input, continue...
 			continue;
 		}
-		
-		InputManager->HandleWindowEvent(Event);
+
+		// Live input would make the replay play out differently
+		if (!bIsReplayingInput)
+		{
+			InputManager->HandleWindowEvent(Event);
+		}
     }
 }
 
 void FEngineLoop::Tick(const sf::Time& DeltaSeconds)
 {
+	GE_PROFILE_SCOPE("FEngineLoop::Tick");
+
 	check(DeltaSeconds > sf::Time::Zero);
 
+	sf::Clock TickCostClock;
+
 	if (GameWorld != nullptr)
 	{
 		GameWorld->Tick(DeltaSeconds);
 	}
+
+	++NumTicksSimulated;
+
+	const sf::Time TickCost = TickCostClock.getElapsedTime();
+	FrameTickTime += TickCost;
+	AverageTickCost = (AverageTickCost == sf::Time::Zero) ? TickCost
+														  : AverageTickCost + (TickCost - AverageTickCost) * k_TickCostSmoothing;
 }
 
 void FEngineLoop::Render(const sf::Time& BlendTime)
 {
+	GE_PROFILE_SCOPE("FEngineLoop::Render");
+
 	check(GameWindow != nullptr);
 
 	GameWindow->clear();
@@ -177,6 +534,7 @@ void FEngineLoop::Render(const sf::Time& BlendTime)
 		GameWorld->Render(BlendTime, *GameWindow, sf::RenderStates::Default);
 	}
 
+	GameWindow->draw(FStatsOverlay::Get());
 	GameWindow->draw(FCommandPrompt::Get());
 
     GameWindow->display();
@@ -194,6 +552,18 @@ void FEngineLoop::Exit(bool bForceImmediate)
 
 	check(bIsRequestingExit);
 
+	if (bIsHeadless)
+	{
+		const float SecondsElapsed = SimulationClock.getElapsedTime().asSeconds();
+		GE_LOG(LogCore, Log, "Simulated %llu ticks in %.2f seconds (%.1f ticks per second).",
+			   static_cast<unsigned long long>(NumTicksSimulated),
+			   SecondsElapsed,
+			   SecondsElapsed > 0.f ? NumTicksSimulated / SecondsElapsed : 0.f);
+	}
+
+	// Undelivered images would be uploaded to textures that are about to be freed
+	FAssetLoader::Get().Stop();
+
 	if (GameWindow != nullptr)
 	{
 		GameWindow->close();
@@ -203,10 +573,12 @@ void FEngineLoop::Exit(bool bForceImmediate)
 
 	if (GameWorld != nullptr)
 	{
-		delete GameWorld;
+		FGlobalObjectLibrary::DestroyObject(GameWorld);
 		GameWorld = nullptr;
 	}
 
+	FJobSystem::Get().Stop();
+
 	if (InputManager != nullptr)
 	{
 		delete InputManager;
@@ -0,0 +1,78 @@
+// Gordian by Daniel Luna (2019)
+
+#include "../Public/EventBus.h"
+
+#include "GordianEngine/Debug/Public/Asserts.h"
+#include "GordianEngine/Debug/Public/Profiler.h"
+
+using namespace Gordian;
+
+/*static*/ FEventBus& FEventBus::Get()
+{
+	static FEventBus EventBus;
+	return EventBus;
+}
+
+FEventBus::FEventBus()
+	: _Channels{}
+	, _PendingChannels{}
+	, _PostArenaIndex(0)
+	, _bIsDispatching(false)
+{
+}
+
+FEventBus::~FEventBus()
+{
+}
+
+/*static*/ size_t FEventBus::AllocateEventTypeIndex()
+{
+	static size_t NextEventTypeIndex = 0;
+	return NextEventTypeIndex++;
+}
+
+void FEventBus::Dispatch()
+{
+	GE_PROFILE_SCOPE("FEventBus::Dispatch");
+
+	// Dispatching from a subscriber would run events out of order
+	ensure(!_bIsDispatching);
+	if (_bIsDispatching)
+	{
+		return;
+	}
+
+	_bIsDispatching = true;
+
+	// Events posted from here on go to the other arena and wait for the next dispatch
+	std::vector<IEventChannel*> ChannelsToDispatch;
+	ChannelsToDispatch.swap(_PendingChannels);
+	FFrameArena& DispatchArena = _Arenas[_PostArenaIndex];
+	_PostArenaIndex ^= 1;
+
+	for (IEventChannel* Channel : ChannelsToDispatch)
+	{
+		Channel->Dispatch();
+	}
+
+	DispatchArena.Reset();
+
+	// Keep the capacity around rather than reallocating it every frame
+	ChannelsToDispatch.clear();
+	if (_PendingChannels.empty())
+	{
+		_PendingChannels.swap(ChannelsToDispatch);
+	}
+
+	_bIsDispatching = false;
+}
+
+size_t FEventBus::GetNumQueuedEvents() const
+{
+	size_t NumQueuedEvents = 0;
+	for (const IEventChannel* Channel : _PendingChannels)
+	{
+		NumQueuedEvents += Channel->GetNumQueued();
+	}
+	return NumQueuedEvents;
+}
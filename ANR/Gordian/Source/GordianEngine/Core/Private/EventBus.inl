@@ -0,0 +1,158 @@
+#include <cstring>
+#include <type_traits>
+
+#include "GordianEngine/Debug/Public/Asserts.h"
+
+namespace Gordian
+{
+
+
+template <class TEvent>
+class FEventBus::TEventChannel : public FEventBus::IEventChannel
+{
+public:
+
+	TEventChannel()
+		: Coalescing(EEventCoalescing::KeepAll)
+		, OnEvent()
+		, _Events(nullptr)
+		, _NumEvents(0)
+		, _Capacity(0)
+	{
+	}
+
+	// Returns true if the queue was empty before
+	bool Enqueue(const TEvent& Event, FFrameArena& Arena)
+	{
+		const bool bWasEmpty = _NumEvents == 0;
+
+		if (!bWasEmpty && Coalescing == EEventCoalescing::KeepLast)
+		{
+			_Events[_NumEvents - 1] = Event;
+			return false;
+		}
+
+		// Outgrown storage is left in the arena, it is all reclaimed once the queue is dispatched
+		if (_NumEvents == _Capacity)
+		{
+			const size_t NewCapacity = _Capacity > 0 ? _Capacity * 2 : 8;
+			TEvent* NewEvents = static_cast<TEvent*>(Arena.Allocate(NewCapacity * sizeof(TEvent), alignof(TEvent)));
+			if (_NumEvents > 0)
+			{
+				std::memcpy(NewEvents, _Events, _NumEvents * sizeof(TEvent));
+			}
+			_Events = NewEvents;
+			_Capacity = NewCapacity;
+		}
+
+		_Events[_NumEvents++] = Event;
+		return bWasEmpty;
+	}
+
+	virtual void Dispatch() override
+	{
+		// Anything posted from a subscriber starts a fresh queue for the next dispatch
+		const TEvent* const Events = _Events;
+		const size_t NumEvents = _NumEvents;
+		_Events = nullptr;
+		_NumEvents = 0;
+		_Capacity = 0;
+
+		for (size_t i = 0; i < NumEvents; ++i)
+		{
+			OnEvent(Events[i]);
+		}
+	}
+
+	virtual size_t GetNumQueued() const override
+	{
+		return _NumEvents;
+	}
+
+	EEventCoalescing Coalescing;
+
+	multicast_delegate<void(const TEvent&)> OnEvent;
+
+private:
+
+	TEvent* _Events;
+	size_t _NumEvents;
+	size_t _Capacity;
+};
+
+
+template <class TEvent>
+/*static*/ size_t FEventBus::GetEventTypeIndex()
+{
+	static const size_t EventTypeIndex = AllocateEventTypeIndex();
+	return EventTypeIndex;
+}
+
+template <class TEvent>
+FEventBus::TEventChannel<TEvent>& FEventBus::GetChannel()
+{
+	static_assert(std::is_trivially_copyable<TEvent>::value && std::is_trivially_destructible<TEvent>::value,
+				  "Events are copied into arena memory and never destroyed");
+
+	const size_t EventTypeIndex = GetEventTypeIndex<TEvent>();
+	if (EventTypeIndex >= _Channels.size())
+	{
+		_Channels.resize(EventTypeIndex + 1);
+	}
+
+	std::unique_ptr<IEventChannel>& Channel = _Channels[EventTypeIndex];
+	if (Channel == nullptr)
+	{
+		Channel.reset(new TEventChannel<TEvent>());
+	}
+
+	return static_cast<TEventChannel<TEvent>&>(*Channel);
+}
+
+template <class TEvent>
+void FEventBus::Post(const TEvent& Event)
+{
+	TEventChannel<TEvent>& Channel = GetChannel<TEvent>();
+	if (Channel.OnEvent.isNull())
+	{
+		return;
+	}
+
+	if (Channel.Enqueue(Event, _Arenas[_PostArenaIndex]))
+	{
+		_PendingChannels.push_back(&Channel);
+	}
+}
+
+template <class TEvent, class T, void(T::*TMethod)(const TEvent&)>
+void FEventBus::Subscribe(T* Subscriber)
+{
+	GetChannel<TEvent>().OnEvent += delegate<void(const TEvent&)>::template create<T, TMethod>(Subscriber);
+}
+
+template <class TEvent, void(*TMethod)(const TEvent&)>
+void FEventBus::Subscribe()
+{
+	GetChannel<TEvent>().OnEvent += delegate<void(const TEvent&)>::template create<TMethod>();
+}
+
+template <class TEvent, class T, void(T::*TMethod)(const TEvent&)>
+void FEventBus::Unsubscribe(T* Subscriber)
+{
+	GetChannel<TEvent>().OnEvent -= delegate<void(const TEvent&)>::template create<T, TMethod>(Subscriber);
+}
+
+template <class TEvent, void(*TMethod)(const TEvent&)>
+void FEventBus::Unsubscribe()
+{
+	GetChannel<TEvent>().OnEvent -= delegate<void(const TEvent&)>::template create<TMethod>();
+}
+
+template <class TEvent>
+void FEventBus::SetCoalescing(EEventCoalescing Coalescing)
+{
+	GetChannel<TEvent>().Coalescing = Coalescing;
+}
+
+
+};
@@ -0,0 +1,223 @@
+// Gordian by Daniel Luna (2019)
+
+#include "GordianEngine/Core/Public/JobSystem.h"
+
+#include <algorithm>
+
+#include "GordianEngine/Debug/Public/Asserts.h"
+#include "GordianEngine/Debug/Public/Logging.h"
+
+using namespace Gordian;
+
+FJobSystem::FJobSystem()
+	: _Workers{}
+	, _Queues{}
+	, _NumQueuedJobs(0)
+	, _bIsStopping(false)
+	, _bIsRunningParallelFor(false)
+{
+	// The calling thread always has a queue, even with no workers
+	_Queues.push_back(std::make_unique<FJobQueue>());
+}
+
+FJobSystem::~FJobSystem()
+{
+	Stop();
+}
+
+/*static*/ FJobSystem& FJobSystem::Get()
+{
+	static FJobSystem Singleton;
+
+	return Singleton;
+}
+
+/*static*/ sf::Uint32 FJobSystem::GetDefaultNumWorkers()
+{
+	const sf::Uint32 NumCores = std::thread::hardware_concurrency();
+	return NumCores > 1 ? NumCores - 1 : 0;
+}
+
+void FJobSystem::Start(sf::Uint32 NumWorkers)
+{
+	check(_Workers.empty());
+
+	_bIsStopping = false;
+
+	// Queues must all exist before any worker starts stealing
+	_Queues.clear();
+	for (sf::Uint32 QueueIndex = 0; QueueIndex <= NumWorkers; ++QueueIndex)
+	{
+		_Queues.push_back(std::make_unique<FJobQueue>());
+	}
+
+	for (sf::Uint32 WorkerIndex = 0; WorkerIndex < NumWorkers; ++WorkerIndex)
+	{
+		_Workers.emplace_back(&FJobSystem::WorkerMain, this, WorkerIndex);
+	}
+
+	GE_LOG(LogCore, Log, "Job system started with %u worker threads.", NumWorkers);
+}
+
+void FJobSystem::Stop()
+{
+	if (_Workers.empty())
+	{
+		return;
+	}
+
+	check(!_bIsRunningParallelFor);
+
+	{
+		std::lock_guard<std::mutex> WakeLock(_WakeMutex);
+		_bIsStopping = true;
+	}
+	_WakeCondition.notify_all();
+
+	for (std::thread& Worker : _Workers)
+	{
+		Worker.join();
+	}
+
+	_Workers.clear();
+	_Queues.resize(1);
+}
+
+void FJobSystem::ParallelFor(size_t Count, size_t BatchSize, const std::function<void(size_t)>& Body)
+{
+	check(Body);
+	BatchSize = std::max<size_t>(BatchSize, 1);
+
+	// Not worth waking anyone for a single batch
+	if (_Workers.empty() || Count <= BatchSize)
+	{
+		for (size_t Index = 0; Index < Count; ++Index)
+		{
+			Body(Index);
+		}
+		return;
+	}
+
+	const bool bWasRunningParallelFor = _bIsRunningParallelFor.exchange(true);
+	checkMsgf(!bWasRunningParallelFor, "ParallelFor cannot be nested.");
+
+	const size_t NumJobs = (Count + BatchSize - 1) / BatchSize;
+	FParallelForState State;
+	State.Body = &Body;
+	State.RemainingJobs = NumJobs;
+
+	// Counted before pushing, so a thief can never take the count below zero
+	_NumQueuedJobs += NumJobs;
+
+	// Deal batches out across every queue so each worker starts with local work
+	for (size_t JobIndex = 0; JobIndex < NumJobs; ++JobIndex)
+	{
+		const size_t Begin = JobIndex * BatchSize;
+		const FJob Job{ &State, Begin, std::min(Begin + BatchSize, Count) };
+
+		FJobQueue& Queue = *_Queues[JobIndex % _Queues.size()];
+		std::lock_guard<std::mutex> QueueLock(Queue.Mutex);
+		Queue.Jobs.push_back(Job);
+	}
+
+	{
+		std::lock_guard<std::mutex> WakeLock(_WakeMutex);
+	}
+	_WakeCondition.notify_all();
+
+	// Help out until every batch is done, including ones stolen by workers
+	const size_t CallerQueueIndex = _Queues.size() - 1;
+	FJob Job;
+	while (State.RemainingJobs.load(std::memory_order_acquire) > 0)
+	{
+		if (TryGetJob(CallerQueueIndex, Job))
+		{
+			RunJob(Job);
+		}
+		else
+		{
+			std::this_thread::yield();
+		}
+	}
+
+	_bIsRunningParallelFor = false;
+
+	// Failures on workers would otherwise take the whole process down, so they surface to the caller
+	if (State.Failure)
+	{
+		std::rethrow_exception(State.Failure);
+	}
+}
+
+void FJobSystem::WorkerMain(size_t QueueIndex)
+{
+	FJob Job;
+	while (true)
+	{
+		if (TryGetJob(QueueIndex, Job))
+		{
+			RunJob(Job);
+			continue;
+		}
+
+		std::unique_lock<std::mutex> WakeLock(_WakeMutex);
+		_WakeCondition.wait(WakeLock, [this]() { return _bIsStopping || _NumQueuedJobs > 0; });
+
+		if (_bIsStopping && _NumQueuedJobs == 0)
+		{
+			return;
+		}
+	}
+}
+
+bool FJobSystem::TryGetJob(size_t QueueIndex, FJob& OutJob)
+{
+	{
+		FJobQueue& OwnQueue = *_Queues[QueueIndex];
+		std::lock_guard<std::mutex> QueueLock(OwnQueue.Mutex);
+		if (!OwnQueue.Jobs.empty())
+		{
+			OutJob = OwnQueue.Jobs.back();
+			OwnQueue.Jobs.pop_back();
+			--_NumQueuedJobs;
+			return true;
+		}
+	}
+
+	for (size_t Offset = 1; Offset < _Queues.size(); ++Offset)
+	{
+		FJobQueue& VictimQueue = *_Queues[(QueueIndex + Offset) % _Queues.size()];
+		std::lock_guard<std::mutex> QueueLock(VictimQueue.Mutex);
+		if (!VictimQueue.Jobs.empty())
+		{
+			OutJob = VictimQueue.Jobs.front();
+			VictimQueue.Jobs.pop_front();
+			--_NumQueuedJobs;
+			return true;
+		}
+	}
+
+	return false;
+}
+
+void FJobSystem::RunJob(const FJob& Job)
+{
+	FParallelForState& State = *Job.State;
+	try
+	{
+		for (size_t Index = Job.Begin; Index < Job.End; ++Index)
+		{
+			(*State.Body)(Index);
+		}
+	}
+	catch (...)
+	{
+		std::lock_guard<std::mutex> FailureLock(State.FailureMutex);
+		if (!State.Failure)
+		{
+			State.Failure = std::current_exception();
+		}
+	}
+
+	State.RemainingJobs.fetch_sub(1, std::memory_order_acq_rel);
+}
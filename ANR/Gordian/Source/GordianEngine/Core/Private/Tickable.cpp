@@ -0,0 +1,107 @@
+// Gordian by Daniel Luna (2019)
+
+#include "GordianEngine/Core/Public/Tickable.h"
+
+#include <algorithm>
+
+#include "GordianEngine/Debug/Public/Asserts.h"
+#include "GordianEngine/World/Public/TickManager.h"
+
+using namespace Gordian;
+
+ITickable::ITickable()
+	: _TickGroup(ETickGroup::GameLogic)
+	, _TickPrerequisites{}
+	, _TickDependents{}
+	, _TickManager(nullptr)
+	, _TickType(nullptr)
+	, _TickSlot(-1)
+	, _TickRunIndex(-1)
+	, _TickRunSlot(-1)
+	, _TickWave(-1)
+{
+
+}
+
+ITickable::~ITickable()
+{
+	if (_TickManager != nullptr)
+	{
+		_TickManager->UnregisterTickable(this);
+	}
+
+	// Break every link in both directions so nothing is left pointing at us
+	for (ITickable* Prerequisite : _TickPrerequisites)
+	{
+		std::vector<ITickable*>& Dependents = Prerequisite->_TickDependents;
+		Dependents.erase(std::find(Dependents.begin(), Dependents.end(), this));
+	}
+
+	for (ITickable* Dependent : _TickDependents)
+	{
+		std::vector<ITickable*>& Prerequisites = Dependent->_TickPrerequisites;
+		Prerequisites.erase(std::find(Prerequisites.begin(), Prerequisites.end(), this));
+	}
+}
+
+void ITickable::SetTickGroup(ETickGroup InTickGroup)
+{
+	check(InTickGroup < ETickGroup::Count);
+
+	if (_TickGroup == InTickGroup)
+	{
+		return;
+	}
+
+	// Groups keep separate lists, so move over by registering again
+	FTickManager* TickManager = _TickManager;
+	const OType_Struct* TickType = _TickType;
+	if (TickManager != nullptr)
+	{
+		TickManager->UnregisterTickable(this);
+	}
+
+	_TickGroup = InTickGroup;
+
+	if (TickManager != nullptr)
+	{
+		TickManager->RegisterTickable(this, TickType);
+	}
+}
+
+void ITickable::AddTickPrerequisite(ITickable* Prerequisite)
+{
+	check(Prerequisite != nullptr && Prerequisite != this);
+
+	if (std::find(_TickPrerequisites.begin(), _TickPrerequisites.end(), Prerequisite) != _TickPrerequisites.end())
+	{
+		return;
+	}
+
+	_TickPrerequisites.push_back(Prerequisite);
+	Prerequisite->_TickDependents.push_back(this);
+	MarkTickScheduleDirty();
+}
+
+void ITickable::RemoveTickPrerequisite(ITickable* Prerequisite)
+{
+	auto PrerequisiteIt = std::find(_TickPrerequisites.begin(), _TickPrerequisites.end(), Prerequisite);
+	if (PrerequisiteIt == _TickPrerequisites.end())
+	{
+		return;
+	}
+
+	_TickPrerequisites.erase(PrerequisiteIt);
+
+	// Waiting on less never breaks the current schedule, so there is nothing to rebuild
+	std::vector<ITickable*>& Dependents = Prerequisite->_TickDependents;
+	Dependents.erase(std::find(Dependents.begin(), Dependents.end(), this));
+}
+
+void ITickable::MarkTickScheduleDirty()
+{
+	if (_TickManager != nullptr)
+	{
+		_TickManager->MarkScheduleDirty(_TickGroup);
+	}
+}
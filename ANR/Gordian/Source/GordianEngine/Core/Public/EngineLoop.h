@@ -7,6 +7,7 @@
 #include "SFML/System/NonCopyable.hpp"
 #include "SFML/System/Time.hpp"
 
+#include "GordianEngine/Input/Public/InputRecording.h"
 #include "GordianEngine/World/Public/World.h"
 
 #include "inih/INIReader.h"
@@ -50,14 +51,56 @@ public:
 
 	const sf::Vector2u& GetWindowSize() const;
 
+	/// If true there is no window, and the world is stepped as fast as possible
+	inline bool IsHeadless() const
+	{
+		return bIsHeadless;
+	}
+
+	/// Ticks simulated per second. May be below the configured rate if ticks run long.
+	inline sf::Uint32 GetTickRate() const
+	{
+		return CurrentTickRate;
+	}
+
+	/// Moving average of the time taken by one tick
+	inline sf::Time GetAverageTickCost() const
+	{
+		return AverageTickCost;
+	}
+
 protected:
 
+	/// Reads [Simulation] settings from Engine.ini. Command line flags may override these.
+	void LoadSimulationSettings();
+
+	/// Changes the fixed step used to tick
+	void SetTickRate(sf::Uint32 TickRate);
+	/// Lowers the tick rate when ticks cannot keep up, and raises it again once they can.
+	/// Only windowed frames adapt it; headless runs and input recordings or replays keep a fixed rate.
+	void UpdateTickRate();
+	/// Adds FrameTime to the time waiting to be ticked, then ticks it away in fixed steps.
+	/// Adapts the tick rate first, so every tick in a frame uses the same step.
+	/// @return The number of ticks run
+	sf::Uint32 ConsumeFrameTime(const sf::Time& FrameTime);
+
 	sf::Int32 ParseCommandArgs(int argc, char** argv);
 
     /// Initializes the game window.
 	///	@return Returns an non-zero error codes if relevant.
     sf::Int32 InitializeGameWindow(const char* WindowTitle);
 
+	/// Starts the worker threads used to tick in parallel.
+	///	@return Returns an non-zero error codes if relevant.
+	sf::Int32 InitializeJobSystem();
+
+	/// Sets up the texture cache and starts the threads that stream textures in.
+	///	@return Returns an non-zero error codes if relevant.
+	sf::Int32 InitializeAssetStreaming();
+
+	/// Adds the engine's own commands to the command prompt
+	void RegisterConsoleCommands();
+
     /// Parse Input received by the local window
     void ParseInput();
 	// Dispatch update across objects that care.
@@ -82,8 +125,44 @@ protected:
     // Tracks time that we have not yet updated with
     sf::Time TimePendingTickConsumption;
 
+	/// Tick rate asked for in Engine.ini, in ticks per second
+	sf::Uint32 TargetTickRate;
+	/// Slowest rate to fall back to when ticks cannot keep up
+	sf::Uint32 MinTickRate;
+	/// Rate currently being ticked at
+	sf::Uint32 CurrentTickRate;
+	/// Most ticks run to catch up in one frame. Any time left over is dropped.
+	sf::Uint32 MaxTicksPerFrame;
+	/// Moving average of the time taken by one tick
+	sf::Time AverageTickCost;
+	/// Frames since the tick rate last changed, so it does not flip back and forth
+	sf::Uint32 FramesSinceTickRateChange;
+	/// Set while recording or replaying input, which needs every tick to be the same length
+	bool bIsTickRatePinned;
+	/// Time spent ticking during the current frame, reported to the stats overlay
+	sf::Time FrameTickTime;
+
     /// If true the loop is currently attempting to terminate
     bool bIsRequestingExit;
+
+	/// If true, skips the window and rendering and ticks without waiting on the clock
+	bool bIsHeadless;
+	/// When headless, exit is requested after this many ticks. 0 means never.
+	sf::Uint64 MaxHeadlessTicks;
+	/// Ticks run since Init
+	sf::Uint64 NumTicksSimulated;
+	/// Measures real time spent since Init, used to report tick throughput
+	sf::Clock SimulationClock;
+
+	/// Streamed textures uploaded to the graphics card each frame, at most
+	size_t MaxTextureUploadsPerFrame;
+
+	/// Where to record handled input to, given by -recordinput=. Empty when not recording.
+	std::string InputRecordingPath;
+	/// Recording to replay, given by -replayinput=. Empty when not replaying.
+	std::string InputReplayPath;
+	/// Feeds a recording back through ParseInput in place of live input
+	FInputReplayer InputReplayer;
 };
 
 extern FEngineLoop GEngineLoop;
@@ -0,0 +1,119 @@
+// Gordian by Daniel Luna (2019)
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "SFML/Config.hpp"
+#include "SFML/System/NonCopyable.hpp"
+
+#include "GordianEngine/Delegates/MulticastDelegate.h"
+#include "GordianEngine/GlobalLibraries/Public/FrameArena.h"
+
+namespace Gordian
+{
+
+
+// What a queue does with an event posted while another of its type is already waiting
+enum class EEventCoalescing : sf::Uint8
+{
+	// Every event is dispatched, in the order posted
+	KeepAll,
+	// Only the most recent event is dispatched, such as the last mouse move of a frame
+	KeepLast
+};
+
+// Queues typed events and dispatches them in batches at fixed points in the frame, rather than
+//	calling subscribers while the poster is still on the stack.
+// Each event type gets its own queue, and a dispatch drains the queues one type at a time,
+//	in the order each type was first posted. Events are copied into memory that is thrown
+//	away after they are dispatched, so they must be trivially copyable and destructible.
+// Events posted while dispatching wait for the next dispatch.
+// Only use the bus from the main thread.
+class FEventBus : sf::NonCopyable
+{
+public:
+
+	// The bus used by the engine
+	static FEventBus& Get();
+
+	FEventBus();
+	~FEventBus();
+
+	// Queues Event for the next dispatch. Events nobody is subscribed to are dropped.
+	template <class TEvent>
+	void Post(const TEvent& Event);
+
+	// Subscribe with a non-const member function
+	template <class TEvent, class T, void(T::*TMethod)(const TEvent&)>
+	void Subscribe(T* Subscriber);
+
+	// Subscribe with a non-member function
+	template <class TEvent, void(*TMethod)(const TEvent&)>
+	void Subscribe();
+
+	template <class TEvent, class T, void(T::*TMethod)(const TEvent&)>
+	void Unsubscribe(T* Subscriber);
+
+	template <class TEvent, void(*TMethod)(const TEvent&)>
+	void Unsubscribe();
+
+	// Defaults to KeepAll. Changing it does not affect events already queued.
+	template <class TEvent>
+	void SetCoalescing(EEventCoalescing Coalescing);
+
+	// Calls subscribers for every queued event
+	void Dispatch();
+
+	// Events waiting for the next dispatch
+	size_t GetNumQueuedEvents() const;
+
+	inline bool IsDispatching() const
+	{
+		return _bIsDispatching;
+	}
+
+private:
+
+	class IEventChannel
+	{
+	public:
+		virtual ~IEventChannel() {}
+
+		// Calls subscribers for each queued event, leaving the queue empty
+		virtual void Dispatch() = 0;
+
+		virtual size_t GetNumQueued() const = 0;
+	};
+
+	template <class TEvent>
+	class TEventChannel;
+
+	// Each event type is given the next index into _Channels the first time it is used
+	static size_t AllocateEventTypeIndex();
+
+	template <class TEvent>
+	static size_t GetEventTypeIndex();
+
+	template <class TEvent>
+	TEventChannel<TEvent>& GetChannel();
+
+	// Indexed by event type index, null for types this bus has not seen
+	std::vector<std::unique_ptr<IEventChannel>> _Channels;
+
+	// Channels with queued events, in the order they were first posted to
+	std::vector<IEventChannel*> _PendingChannels;
+
+	// Queued events are stored in one arena while the other's are being dispatched
+	FFrameArena _Arenas[2];
+	size_t _PostArenaIndex;
+
+	bool _bIsDispatching;
+};
+
+
+};
+
+
+#include "../Private/EventBus.inl"
@@ -0,0 +1,107 @@
+// Gordian by Daniel Luna (2019)
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "SFML/Config.hpp"
+#include "SFML/System/NonCopyable.hpp"
+
+namespace Gordian
+{
+
+
+// A pool of worker threads that share batches of work by stealing from each other.
+// Every worker owns a queue. Workers take from the back of their own queue and
+//	steal from the front of everyone else's, so idle threads keep busy without
+//	contending over a single shared queue.
+// Until Start is called (or if it is started with no workers) all work runs inline.
+class FJobSystem : public sf::NonCopyable
+{
+public:
+
+	FJobSystem();
+	~FJobSystem();
+
+	static FJobSystem& Get();
+
+	// Returns the worker count to use by default: one per core, minus the calling thread
+	static sf::Uint32 GetDefaultNumWorkers();
+
+	// Spins up the worker threads. Must not already be running.
+	void Start(sf::Uint32 NumWorkers);
+	// Finishes any queued work, then joins all worker threads.
+	void Stop();
+
+	inline size_t GetNumWorkers() const
+	{
+		return _Workers.size();
+	}
+
+	// Runs Body once for every index in [0, Count), split into batches of BatchSize.
+	// The calling thread works on batches too, and this only returns once every
+	//	batch has finished. Batches may run in any order, on any thread.
+	// Must not be called from inside of another ParallelFor.
+	// If a batch throws, the rest of that batch is skipped and the first exception is rethrown here.
+	void ParallelFor(size_t Count, size_t BatchSize, const std::function<void(size_t)>& Body);
+
+private:
+
+	// Shared by every batch of one ParallelFor, and owned by its caller
+	struct FParallelForState
+	{
+		const std::function<void(size_t)>* Body;
+		std::atomic<size_t> RemainingJobs;
+
+		// First exception thrown by a batch, rethrown on the calling thread once every batch is done
+		std::mutex FailureMutex;
+		std::exception_ptr Failure;
+	};
+
+	// A contiguous range of indices to pass to a ParallelFor body
+	struct FJob
+	{
+		FParallelForState* State;
+		size_t Begin;
+		size_t End;
+	};
+
+	struct FJobQueue
+	{
+		std::mutex Mutex;
+		std::deque<FJob> Jobs;
+	};
+
+	void WorkerMain(size_t QueueIndex);
+
+	// Pops from the back of the given queue, or steals from the front of another.
+	bool TryGetJob(size_t QueueIndex, FJob& OutJob);
+
+	void RunJob(const FJob& Job);
+
+	std::vector<std::thread> _Workers;
+
+	// One queue per worker, plus a last queue for the thread calling ParallelFor
+	std::vector<std::unique_ptr<FJobQueue>> _Queues;
+
+	// Workers sleep on this while there is nothing to steal
+	std::mutex _WakeMutex;
+	std::condition_variable _WakeCondition;
+	std::atomic<size_t> _NumQueuedJobs;
+
+	std::atomic<bool> _bIsStopping;
+
+	// True while a ParallelFor is in flight, used to catch nesting
+	std::atomic<bool> _bIsRunningParallelFor;
+};
+
+
+};	// namespace Gordian
@@ -0,0 +1,79 @@
+// Gordian by Daniel Luna (2019)
+
+#pragma once
+
+#include <vector>
+
+#include "SFML/Config.hpp"
+#include "SFML/System/Time.hpp"
+
+namespace Gordian
+{
+
+class FTickManager;
+class OType_Struct;
+
+
+// Tick groups run in order, each finishing before the next begins.
+enum class ETickGroup : sf::Uint8
+{
+	PrePhysics,
+	GameLogic,
+	PostUpdate,
+	PreRender,
+
+	Count
+};
+
+
+/// Interface for a class that can be ticked by a tick manager.
+/// Tickables in the same group with no prerequisites between them may
+///	tick at the same time on different threads.
+class ITickable
+{
+	friend FTickManager;
+
+public:
+
+	ITickable();
+	virtual ~ITickable();
+
+	virtual void Tick(const sf::Time& DeltaTime) = 0;
+
+	// Moves this tickable into another group. Takes effect from the next tick.
+	void SetTickGroup(ETickGroup InTickGroup);
+	inline ETickGroup GetTickGroup() const
+	{
+		return _TickGroup;
+	}
+
+	// Makes this tickable tick after Prerequisite each tick.
+	// Prerequisites in earlier groups are always met. Ones in later groups are ignored.
+	void AddTickPrerequisite(ITickable* Prerequisite);
+	void RemoveTickPrerequisite(ITickable* Prerequisite);
+
+private:
+
+	// Lets the tick manager know the tick order needs to be worked out again
+	void MarkTickScheduleDirty();
+
+	ETickGroup _TickGroup;
+
+	std::vector<ITickable*> _TickPrerequisites;
+	// Everything with this as a prerequisite, so links can be broken on destruction
+	std::vector<ITickable*> _TickDependents;
+
+	// Set while registered with a tick manager
+	FTickManager* _TickManager;
+	const OType_Struct* _TickType;
+	// Index into the tick manager's registered list for this group
+	sf::Int32 _TickSlot;
+	// Run of this tickable's type inside its wave, and its index in that run
+	sf::Int32 _TickRunIndex;
+	sf::Int32 _TickRunSlot;
+	// Dependency depth within the group, worked out by the tick manager
+	sf::Int32 _TickWave;
+};
+
+
+};	// namespace Gordian
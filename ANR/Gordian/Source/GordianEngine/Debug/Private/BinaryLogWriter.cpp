@@ -0,0 +1,139 @@
+// Gordian by Daniel Luna (2019)
+
+#include "../Public/BinaryLogWriter.h"
+
+#include "GordianEngine/Debug/Public/Asserts.h"
+
+using namespace Gordian;
+
+namespace
+{
+	static const char* k_BinaryLogFilepath = "Log.bin";
+
+	// Spells GLOG when read as bytes
+	static const sf::Uint32 k_BinaryLogMagic = 0x474F4C47;
+	static const sf::Uint16 k_BinaryLogVersion = 1;
+
+	// Pending records are written out once they take up this many bytes
+	static const size_t k_BufferWriteSize = 64 * 1024;
+}
+
+FBinaryLogSite::FBinaryLogSite(FBinaryLogWriter& Writer,
+							   const char* Category,
+							   ELogVerbosity Verbosity,
+							   const char* LogLocation,
+							   const char* LogFormat)
+	: _Id(Writer.RegisterSite(Category, Verbosity, LogLocation, LogFormat))
+	, _Verbosity(Verbosity)
+{
+}
+
+sf::Uint32 FBinaryLogSite::GetId() const
+{
+	return _Id;
+}
+
+ELogVerbosity FBinaryLogSite::GetVerbosity() const
+{
+	return _Verbosity;
+}
+
+/*static*/ FBinaryLogWriter& FBinaryLogWriter::Get()
+{
+	static FBinaryLogWriter BinaryLogWriter(k_BinaryLogFilepath);
+	return BinaryLogWriter;
+}
+
+FBinaryLogWriter::FBinaryLogWriter(const char* Filepath)
+	: _OutputFile(nullptr)
+	, _NumSites(0)
+{
+	_PendingBuffer.reserve(k_BufferWriteSize + PrivateBinaryLogHelpers::k_MaxRecordSize);
+	_WritingBuffer.reserve(k_BufferWriteSize + PrivateBinaryLogHelpers::k_MaxRecordSize);
+
+	// Runs are appended, each starting with its own session record
+	errno_t ErrorCode = fopen_s(&_OutputFile, Filepath, "ab");
+	ensure(ErrorCode == 0);
+
+	PrivateBinaryLogHelpers::FRecordBuilder Record(EBinaryLogRecord::Session);
+	Record.AddValue(k_BinaryLogMagic);
+	Record.AddValue(k_BinaryLogVersion);
+	Record.AddValue(PrivateBinaryLogHelpers::GetTimestamp());
+
+	size_t RecordSize;
+	const char* RecordData = Record.Finish(RecordSize);
+	AppendRecord(RecordData, RecordSize);
+}
+
+FBinaryLogWriter::~FBinaryLogWriter()
+{
+	Flush();
+
+	if (_OutputFile != nullptr)
+	{
+		std::fclose(_OutputFile);
+	}
+}
+
+void FBinaryLogWriter::Flush()
+{
+	std::unique_lock<std::mutex> BufferLock(_BufferMutex);
+	WritePendingBuffer(BufferLock);
+
+	std::lock_guard<std::mutex> FileLock(_FileMutex);
+	if (_OutputFile != nullptr)
+	{
+		std::fflush(_OutputFile);
+	}
+}
+
+sf::Uint32 FBinaryLogWriter::RegisterSite(const char* Category,
+										  ELogVerbosity Verbosity,
+										  const char* LogLocation,
+										  const char* LogFormat)
+{
+	std::unique_lock<std::mutex> BufferLock(_BufferMutex);
+
+	const sf::Uint32 SiteId = _NumSites++;
+
+	PrivateBinaryLogHelpers::FRecordBuilder Record(EBinaryLogRecord::Site);
+	Record.AddValue(SiteId);
+	Record.AddValue(Verbosity);
+	Record.AddString(Category);
+	Record.AddString(LogLocation);
+	Record.AddString(LogFormat);
+
+	// Goes in under the same lock as the id, so it always lands before the site's first log
+	size_t RecordSize;
+	const char* RecordData = Record.Finish(RecordSize);
+	_PendingBuffer.insert(_PendingBuffer.end(), RecordData, RecordData + RecordSize);
+
+	return SiteId;
+}
+
+void FBinaryLogWriter::AppendRecord(const char* Record, size_t RecordSize)
+{
+	std::unique_lock<std::mutex> BufferLock(_BufferMutex);
+	_PendingBuffer.insert(_PendingBuffer.end(), Record, Record + RecordSize);
+
+	if (_PendingBuffer.size() >= k_BufferWriteSize)
+	{
+		WritePendingBuffer(BufferLock);
+	}
+}
+
+void FBinaryLogWriter::WritePendingBuffer(std::unique_lock<std::mutex>& BufferLock)
+{
+	check(BufferLock.owns_lock());
+
+	// Take the file before letting go of the buffer, so writes keep their order
+	std::lock_guard<std::mutex> FileLock(_FileMutex);
+	_WritingBuffer.clear();
+	_WritingBuffer.swap(_PendingBuffer);
+	BufferLock.unlock();
+
+	if (_OutputFile != nullptr && !_WritingBuffer.empty())
+	{
+		std::fwrite(_WritingBuffer.data(), 1, _WritingBuffer.size(), _OutputFile);
+	}
+}
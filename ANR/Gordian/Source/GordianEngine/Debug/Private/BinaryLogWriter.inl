@@ -0,0 +1,175 @@
+// Gordian by Daniel Luna (2019)
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+namespace Gordian
+{
+
+
+namespace PrivateBinaryLogHelpers
+{
+	// Largest record a single log can produce. Strings are cut short to fit.
+	const size_t k_MaxRecordSize = 2048;
+
+	// Bytes taken up by a record's type and payload size
+	const size_t k_RecordHeaderSize = sizeof(EBinaryLogRecord) + sizeof(sf::Uint16);
+
+	// Microseconds since epoch, matching the decoder's expectations
+	inline sf::Int64 GetTimestamp()
+	{
+		using namespace std::chrono;
+		return duration_cast<microseconds>(system_clock::now().time_since_epoch()).count();
+	}
+
+	// Builds a single record on the stack, so it can be copied out in one go
+	class FRecordBuilder
+	{
+	public:
+
+		explicit FRecordBuilder(EBinaryLogRecord RecordType)
+			: _Size(k_RecordHeaderSize)
+		{
+			_Data[0] = static_cast<char>(RecordType);
+		}
+
+		// Copies the raw bytes of a value. Returns false if it did not fit.
+		template <typename T>
+		bool AddValue(const T& Value)
+		{
+			static_assert(std::is_trivially_copyable<T>::value, "Binary log values must be trivially copyable!");
+			if (_Size + sizeof(T) > k_MaxRecordSize)
+			{
+				return false;
+			}
+
+			std::memcpy(_Data + _Size, &Value, sizeof(T));
+			_Size += sizeof(T);
+			return true;
+		}
+
+		// Copies a length prefixed string, cutting it short if there is not enough room
+		void AddString(const char* String)
+		{
+			const size_t Remaining = k_MaxRecordSize - std::min(_Size + sizeof(sf::Uint16), k_MaxRecordSize);
+			const sf::Uint16 Length = static_cast<sf::Uint16>(std::min(std::strlen(String), Remaining));
+
+			if (AddValue(Length))
+			{
+				std::memcpy(_Data + _Size, String, Length);
+				_Size += Length;
+			}
+		}
+
+		// Copies a single printf argument along with its tag
+		template <typename T>
+		void AddArg(T Arg)
+		{
+			if constexpr (std::is_enum<T>::value)
+			{
+				AddArg(static_cast<typename std::underlying_type<T>::type>(Arg));
+			}
+			else if constexpr (std::is_integral<T>::value)
+			{
+				// Small integers are widened the same way printf would see them
+				if constexpr (sizeof(T) <= sizeof(sf::Int32))
+				{
+					if constexpr (std::is_signed<T>::value)
+					{
+						AddTaggedValue(EBinaryLogArg::Int32, static_cast<sf::Int32>(Arg));
+					}
+					else
+					{
+						AddTaggedValue(EBinaryLogArg::UInt32, static_cast<sf::Uint32>(Arg));
+					}
+				}
+				else if constexpr (std::is_signed<T>::value)
+				{
+					AddTaggedValue(EBinaryLogArg::Int64, static_cast<sf::Int64>(Arg));
+				}
+				else
+				{
+					AddTaggedValue(EBinaryLogArg::UInt64, static_cast<sf::Uint64>(Arg));
+				}
+			}
+			else if constexpr (std::is_floating_point<T>::value)
+			{
+				AddTaggedValue(EBinaryLogArg::Double, static_cast<double>(Arg));
+			}
+			else if constexpr (std::is_same<T, const char*>::value || std::is_same<T, char*>::value)
+			{
+				// The pointer means nothing once we exit, so the text has to be copied
+				if (_Size + sizeof(EBinaryLogArg) + sizeof(sf::Uint16) <= k_MaxRecordSize)
+				{
+					AddValue(EBinaryLogArg::String);
+					AddString(Arg != nullptr ? Arg : "(null)");
+				}
+			}
+			else if constexpr (std::is_null_pointer<T>::value)
+			{
+				AddTaggedValue(EBinaryLogArg::Pointer, sf::Uint64(0));
+			}
+			else if constexpr (std::is_pointer<T>::value)
+			{
+				AddTaggedValue(EBinaryLogArg::Pointer, static_cast<sf::Uint64>(reinterpret_cast<std::uintptr_t>(Arg)));
+			}
+			else
+			{
+				static_assert(sizeof(T) == 0, "Binary logs only support printf style arguments!");
+			}
+		}
+
+		// Fills in the payload size and returns the finished record
+		const char* Finish(size_t& OutSize)
+		{
+			const sf::Uint16 PayloadSize = static_cast<sf::Uint16>(_Size - k_RecordHeaderSize);
+			std::memcpy(_Data + sizeof(EBinaryLogRecord), &PayloadSize, sizeof(PayloadSize));
+
+			OutSize = _Size;
+			return _Data;
+		}
+
+	private:
+
+		// Arguments are all or nothing, so the decoder never reads half of one
+		template <typename T>
+		void AddTaggedValue(EBinaryLogArg Tag, const T& Value)
+		{
+			if (_Size + sizeof(Tag) + sizeof(T) <= k_MaxRecordSize)
+			{
+				AddValue(Tag);
+				AddValue(Value);
+			}
+		}
+
+		size_t _Size;
+
+		char _Data[k_MaxRecordSize];
+	};
+};
+
+
+template <typename... TArgs>
+void FBinaryLogWriter::Write(const FBinaryLogSite& Site, TArgs... Args)
+{
+	PrivateBinaryLogHelpers::FRecordBuilder Record(EBinaryLogRecord::Log);
+	Record.AddValue(Site.GetId());
+	Record.AddValue(PrivateBinaryLogHelpers::GetTimestamp());
+	(Record.AddArg(Args), ...);
+
+	size_t RecordSize;
+	const char* RecordData = Record.Finish(RecordSize);
+	AppendRecord(RecordData, RecordSize);
+
+	if (Site.GetVerbosity() == ELogVerbosity::Fatal)
+	{
+		// We are about to halt, so get this out while we still can
+		Flush();
+	}
+}
+
+
+};
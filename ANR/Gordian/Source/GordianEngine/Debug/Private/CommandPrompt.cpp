@@ -4,6 +4,7 @@
 
 #include <algorithm>
 #include <filesystem>
+#include <sstream>
 
 #include "SFML/Graphics/RenderTarget.hpp"
 
@@ -23,6 +24,7 @@ namespace
 	static const char* k_CommandPromptFontFilepath = "/Netrunner/Resources/Default/CommandPrompt.ttf";
 
 	static const size_t k_MaxRecentCommands = 31;
+	static const size_t k_MaxAutoCompleteSuggestions = 8;
 	static const size_t k_MaxCommandLength = 1020;
 
 	static const unsigned int k_CommandPromptFontSize = 16;
@@ -40,7 +42,7 @@ FCommandPrompt::FCommandPrompt()
 {
 	RecentCommandsIndex = -1;
 	PreviousCommands.Resize(k_MaxRecentCommands);
-	TestTrie.Reserve(15);
+	Commands.Reserve(16);
 	CurrentInputString = "";
 
 	errno_t ErrorCode = 0;
@@ -87,6 +89,12 @@ FCommandPrompt::FCommandPrompt()
 	CurrentInputText.setFillColor(sf::Color::White);
 	bIsPromptOpen = false;
 
+	// Suggestions sit on their own line, just above the background
+	SuggestionsText.setCharacterSize(k_CommandPromptFontSize);
+	SuggestionsText.setFont(PromptFont);
+	SuggestionsText.setPosition(BorderSpacing, -(2 * StringHeight + 2 * BorderSpacing + DividerSpacing));
+	SuggestionsText.setFillColor(sf::Color::White);
+
 	// Set up the Background
 	BackgroundShape.setFillColor(sf::Color(0, 0, 0, k_ConsoleBackgroundAlpha));
 	BackgroundShape.setOutlineColor(sf::Color::White);
@@ -141,6 +149,52 @@ void FCommandPrompt::Initialize()
 
 }
 
+void FCommandPrompt::RegisterCommand(const std::string& Name, const FConsoleCommand& Command)
+{
+	check(!Name.empty() && Name.find(' ') == std::string::npos);
+
+	FConsoleCommand* const ExistingCommand = Commands.Find(Name);
+	if (ExistingCommand != nullptr)
+	{
+		*ExistingCommand = Command;
+	}
+	else
+	{
+		Commands.Insert(Name, Command);
+	}
+}
+
+bool FCommandPrompt::ExecuteCommand(const std::string& CommandLine)
+{
+	std::istringstream CommandStream(CommandLine);
+
+	std::string CommandName;
+	if (!(CommandStream >> CommandName))
+	{
+		return false;
+	}
+
+	const FConsoleCommand* const FoundCommand = Commands.Find(CommandName);
+	if (FoundCommand == nullptr)
+	{
+		GE_LOG(LogCommandPrompt, Warning, "Unknown command %s", CommandName.c_str());
+		return false;
+	}
+
+	std::vector<std::string> Arguments;
+	std::string Argument;
+	while (CommandStream >> Argument)
+	{
+		Arguments.push_back(Argument);
+	}
+
+	// Copied, since running it may register more commands and move the one stored
+	const FConsoleCommand Command = *FoundCommand;
+	Commands.AddRank(CommandName);
+	Command(Arguments);
+	return true;
+}
+
 bool FCommandPrompt::ParseRawInput(const sf::Event& RawInput)
 {
 	bool bConsumedInput = false;
@@ -185,7 +239,8 @@ bool FCommandPrompt::ParseRawInput(const sf::Event& RawInput)
 			}
 			case InputKeys::EKeyboardKeys::Tab:
 			{
-				//AutoCompleteCommand();
+				AutoCompleteCommand();
+				break;
 			}
 		}
 	}
@@ -217,19 +272,61 @@ void FCommandPrompt::DigestCommand()
 {
 	GE_LOG(LogCommandPrompt, Verbose, "Digesting Command %s", CurrentInputString.toAnsiString().c_str());
 
-	TestTrie.Insert(CurrentInputString, CurrentInputString.getSize());
 	PreviousCommands.Enqueue(CurrentInputString);
 	RecentCommandsIndex = -1;
 
+	ExecuteCommand(CurrentInputString.toAnsiString());
+
 	SetCurrentInputString("");
 }
 
+void FCommandPrompt::AutoCompleteCommand()
+{
+	const std::string Input = CurrentInputString.toAnsiString();
+
+	// Only the command name completes, arguments are up to the command
+	if (Input.find(' ') != std::string::npos)
+	{
+		return;
+	}
+
+	std::vector<std::string> Matches;
+	Commands.ForEachTopRankedWithPrefix(Input, k_MaxAutoCompleteSuggestions, [&Matches](std::string_view Name, const FConsoleCommand&)
+	{
+		Matches.emplace_back(Name);
+		return true;
+	});
+
+	if (Matches.empty())
+	{
+		return;
+	}
+
+	if (Matches.size() == 1)
+	{
+		SetCurrentInputString(Matches[0] + " ");
+		return;
+	}
+
+	// Fill in as much as every command under the input agrees on, not just the ones listed,
+	//	and list the top ranked ones so the user can pick
+	std::string Suggestions;
+	for (const std::string& Match : Matches)
+	{
+		Suggestions.append(Match).append("  ");
+	}
+
+	SetCurrentInputString(std::string(Commands.FindSharedPrefix(Input)));
+	SuggestionsText.setString(Suggestions);
+}
+
 void FCommandPrompt::SetCurrentInputString(const sf::String& NewInputString)
 {
 	CurrentInputString = NewInputString;
 
 	// Update Visualization
 	CurrentInputText.setString(CurrentInputString + "_");
+	SuggestionsText.setString("");
 }
 
 void FCommandPrompt::AppendCurrentInputString(const sf::Uint32& UnicodeValue)
@@ -255,6 +352,7 @@ void FCommandPrompt::AppendCurrentInputString(const sf::Uint32& UnicodeValue)
 
 	// Update Visualization
 	CurrentInputText.setString(CurrentInputString + "_");
+	SuggestionsText.setString("");
 }
 
 void FCommandPrompt::TraverseRecentCommands(int DirectionOfTraversal)
@@ -317,6 +415,11 @@ void FCommandPrompt::draw(sf::RenderTarget& target, sf::RenderStates states) con
 		target.draw(BackgroundShape, BackgroundRenderStates);
 	}
 
+	if (!SuggestionsText.getString().isEmpty())
+	{
+		target.draw(SuggestionsText, states);
+	}
+
 	// Draw text input
 	const sf::FloatRect& TextBounds = CurrentInputText.getGlobalBounds();
 	// If text is wider than the target width
@@ -12,6 +12,7 @@ FLogCategoryBase::FLogCategoryBase(const char* InName,
 	: Name(InName)
 	, DefaultRuntimeVerbosity(InDefaultRuntimeVerbosity)
 	, CompileTimeVerbosity(InCompileTimeVerbosity)
+	, Sinks(ELogSink::Text)
 {
 	RuntimeVerbosity = DefaultRuntimeVerbosity <= CompileTimeVerbosity ? DefaultRuntimeVerbosity : CompileTimeVerbosity;
 }
@@ -48,3 +49,18 @@ void FLogCategoryBase::ResetRuntimeVerboisty()
 {
 	RuntimeVerbosity = DefaultRuntimeVerbosity;
 }
+
+ELogSink FLogCategoryBase::GetLogSinks() const
+{
+	return Sinks;
+}
+
+bool FLogCategoryBase::IsLoggingTo(ELogSink Sink) const
+{
+	return (static_cast<sf::Uint8>(Sinks) & static_cast<sf::Uint8>(Sink)) != 0;
+}
+
+void FLogCategoryBase::SetLogSinks(ELogSink InSinks)
+{
+	Sinks = InSinks;
+}
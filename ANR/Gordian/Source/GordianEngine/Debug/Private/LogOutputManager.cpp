@@ -4,6 +4,8 @@
 
 #include "GordianEngine/Platform/Public/ConsoleFormatting.h"
 
+#include <algorithm>
+#include <chrono>
 #include <cstdarg>
 #include <cstdio>
 #include <cstring>
@@ -25,15 +27,72 @@ namespace
 	static const int k_MaxLogCharacterLength = 1024;
 	static const int k_MaxLogTimestampLength = 29;
 	static const char* k_LogFilepath = "Log.txt";
+
+	// Records in the ring. Must be a power of two.
+	static const size_t k_LogRecordCapacity = 1024;
+	// Bytes reserved up front for each output batch
+	static const size_t k_BatchReserveSize = 64 * 1024;
+
+	// How long the writer sleeps between drains when nobody wakes it
+	static const std::chrono::milliseconds k_WriterSleepDuration(50);
+	// How often the log file is flushed while logs are coming in
+	static const std::chrono::milliseconds k_FileFlushInterval(1000);
+	// Longest the destructor will spend writing out logs still in the ring
+	static const std::chrono::milliseconds k_ShutdownDrainTimeout(2000);
+
+	// Formatted timestamps only change once a second, so each thread keeps its last one
+	struct FCachedTimestamp
+	{
+		std::time_t Time = std::time_t(-1);
+		size_t Length = 0;
+		char Text[k_MaxLogTimestampLength] = "";
+	};
+
+	thread_local FCachedTimestamp CachedTimestamp;
+
+	inline void AppendToBatch(std::vector<char>& Batch, const char* Text, size_t Length)
+	{
+		Batch.insert(Batch.end(), Text, Text + Length);
+	}
 }
 
+static_assert((k_LogRecordCapacity & (k_LogRecordCapacity - 1)) == 0, "Log record capacity must be a power of two!");
+
 FLogOutputManager Gordian::GLogOutputManager;
 
 FLogOutputManager::FLogOutputManager()
+	: FLogOutputManager(k_LogFilepath, k_LogRecordCapacity)
+{
+}
+
+FLogOutputManager::FLogOutputManager(const char* LogFilepath, size_t RecordCapacity)
 	: bIsEnabled(true)
+	, LogOutputFile(nullptr)
+	, _Records(new FLogRecord[RecordCapacity])
+	, _RecordMask(RecordCapacity - 1)
+	, _WakeWriterInterval(std::max<size_t>(RecordCapacity / 4, 1))
+	, _EnqueuePosition(0)
+	, _DequeuePosition(0)
+	, _bHasUnflushedFileOutput(false)
+	, _bHasConsoleFormats(false)
+	, _bIsWriterStopping(false)
+	, _bIsWriterRunning(false)
 {
+	static_assert(sizeof(FLogRecord::Text) >= k_MaxLogCharacterLength + k_MaxLogTimestampLength, "Log records are too small!");
+	check(RecordCapacity > 0 && (RecordCapacity & (RecordCapacity - 1)) == 0);
+
+	// A record is free to claim when its sequence matches the claiming position
+	for (size_t RecordIndex = 0; RecordIndex < RecordCapacity; ++RecordIndex)
+	{
+		_Records[RecordIndex].Sequence.store(RecordIndex, std::memory_order_relaxed);
+	}
+
+	_ConsoleBatch.reserve(k_BatchReserveSize);
+	_FileBatch.reserve(k_BatchReserveSize);
+
 	errno_t ErrorCode;
-	ErrorCode = fopen_s(&LogOutputFile, k_LogFilepath, "a");
+	ErrorCode = fopen_s(&LogOutputFile, LogFilepath, "a");
+
 	if (ErrorCode != 0)
 	{
 		GE_LOG(LogFileIO, Fatal, "LogOutput file could not be set up! Error code: %d!", ErrorCode);
@@ -42,29 +101,73 @@ FLogOutputManager::FLogOutputManager()
 
 FLogOutputManager::~FLogOutputManager()
 {
+	if (_WriterThread.joinable())
+	{
+		{
+			std::lock_guard<std::mutex> WakeLock(_WakeMutex);
+			_bIsWriterStopping = true;
+		}
+		_WakeCondition.notify_one();
+		_WriterThread.join();
+	}
+
+	_bIsWriterRunning = false;
+
+	// Other threads may still be logging, so don't wait on them forever
+	{
+		std::lock_guard<std::mutex> DrainLock(_DrainMutex);
+
+		const auto DrainDeadline = std::chrono::steady_clock::now() + k_ShutdownDrainTimeout;
+		while (DrainRecords() > 0 && std::chrono::steady_clock::now() < DrainDeadline)
+		{
+		}
+
+		FlushOutputs();
+	}
+
 	if (LogOutputFile != nullptr)
 	{
 		std::fclose(LogOutputFile);
 	}
 }
 
-void FLogOutputManager::FetchLogTimestamp(char* OutString) const
+void FLogOutputManager::StartWriterThread()
+{
+	if (_WriterThread.joinable())
+	{
+		return;
+	}
+
+	_WriterThread = std::thread(&FLogOutputManager::WriterMain, this);
+	_bIsWriterRunning = true;
+}
+
+size_t FLogOutputManager::FetchLogTimestamp(char* OutString) const
 {
 	std::time_t Time;
 	std::time(&Time);
 
-	check(Time != std::time_t(-1));
-	std::tm OutLocalTime;
+	if (Time != CachedTimestamp.Time)
+	{
+		check(Time != std::time_t(-1));
+		std::tm OutLocalTime;
+
+		errno_t ErrorCode = localtime_s(&OutLocalTime, &Time);
+		ensure(ErrorCode == 0);
 
-	errno_t ErrorCode = localtime_s(&OutLocalTime, &Time);
-	ensure(ErrorCode == 0);
+		size_t FinalStringSize = std::strftime(CachedTimestamp.Text, k_MaxLogTimestampLength, "[%Y.%m.%d %H:%M:%S %z] ", &OutLocalTime);
+		check(FinalStringSize > 0 && FinalStringSize < k_MaxLogTimestampLength);
 
-	size_t FinalStringSize = std::strftime(OutString, k_MaxLogTimestampLength, "[%Y.%m.%d %H:%M:%S %z] ", &OutLocalTime);
-	check(FinalStringSize > 0 && FinalStringSize < k_MaxLogTimestampLength);
+		CachedTimestamp.Time = Time;
+		CachedTimestamp.Length = FinalStringSize;
+	}
+
+	std::memcpy(OutString, CachedTimestamp.Text, CachedTimestamp.Length);
+	return CachedTimestamp.Length;
 }
 
-void FLogOutputManager::PrintEnsure(const char* EnsureText, 
-									const char* FileName, 
+void FLogOutputManager::PrintEnsure(const char* EnsureText,
+									const char* FileName,
 									int LineNumber) const
 {
 	if (!bIsEnabled)
@@ -72,6 +175,9 @@ void FLogOutputManager::PrintEnsure(const char* EnsureText,
 		return;
 	}
 
+	// Anything logged before this should show up before it
+	Flush();
+
 	FScopedConsoleFormat EnsureFormat;
 	EnsureFormat.SetTextColor(EConsoleColor::Yellow);
 	EnsureFormat.SetFormatOption(EConsoleFormat::Bold, true);
@@ -89,6 +195,9 @@ void FLogOutputManager::PrintCheck(const char* AssertText,
 		return;
 	}
 
+	// Checks usually halt, so get everything logged so far out first
+	Flush();
+
 	FScopedConsoleFormat CheckFormat;
 	CheckFormat.SetTextColor(EConsoleColor::Red);
 	CheckFormat.SetFormatOption(EConsoleFormat::Bold, true);
@@ -108,33 +217,52 @@ void FLogOutputManager::PrintLog(const char* Category,
 		return;
 	}
 
-	FScopedConsoleFormat CheckFormat;
-	switch (Verbosity)
-	{
-		case ELogVerbosity::Fatal:
-			CheckFormat.SetFormatOption(EConsoleFormat::Underline, true);
-			// Falls through to error...
-		case ELogVerbosity::Error:
-			CheckFormat.SetTextColor(EConsoleColor::Red);
-			CheckFormat.SetFormatOption(EConsoleFormat::Bold, true);
-			break;
-		case ELogVerbosity::Warning:
-			CheckFormat.SetTextColor(EConsoleColor::Yellow);
-			CheckFormat.SetFormatOption(EConsoleFormat::Bold, true);
-			break;
-		default:
-			break;
-	}
+	size_t Position;
+	FLogRecord& Record = ClaimRecord(Position);
+	Record.Verbosity = Verbosity;
+	Record.LogLocation = LogLocation;
 
-	CheckFormat.Apply();
+	// Leave room for the trailing newline
+	const size_t MaxLength = sizeof(Record.Text) - 2;
+	size_t Length = FetchLogTimestamp(Record.Text);
+
+	const int CategoryLength = snprintf(Record.Text + Length, MaxLength - Length + 1, "%s - ", Category);
+	Length = std::min(Length + std::max(CategoryLength, 0), MaxLength);
 
-	char FinalLogFormat[k_MaxLogCharacterLength];
-	snprintf(FinalLogFormat, k_MaxLogCharacterLength, "%s - %s\n", Category, LogFormat);
-	
 	va_list Args;
 	va_start(Args, LogFormat);
-	vFullLogf(LogLocation, FinalLogFormat, Args);
+	const int MessageLength = vsnprintf(Record.Text + Length, MaxLength - Length + 1, LogFormat, Args);
 	va_end(Args);
+	Length = std::min(Length + std::max(MessageLength, 0), MaxLength);
+
+	Record.Text[Length++] = '\n';
+	Record.Text[Length] = '\0';
+	Record.TextLength = Length;
+
+	PublishRecord(Record, Position);
+
+	if (Verbosity == ELogVerbosity::Fatal || !_bIsWriterRunning)
+	{
+		// Either we are about to halt, or there is no writer to wait on
+		Flush();
+	}
+	else if (Verbosity <= ELogVerbosity::Error || (Position % _WakeWriterInterval) == 0)
+	{
+		_WakeCondition.notify_one();
+	}
+}
+
+void FLogOutputManager::Flush() const
+{
+	std::lock_guard<std::mutex> DrainLock(_DrainMutex);
+
+	// Only wait on logs queued before the flush, in case other threads keep logging
+	const size_t FlushPosition = _EnqueuePosition.load(std::memory_order_acquire);
+	while (_DequeuePosition < FlushPosition && DrainRecords() > 0)
+	{
+	}
+
+	FlushOutputs();
 }
 
 void FLogOutputManager::SetIsEnabled(bool bInIsEnabled)
@@ -142,74 +270,193 @@ void FLogOutputManager::SetIsEnabled(bool bInIsEnabled)
 	bIsEnabled = bInIsEnabled;
 }
 
-void FLogOutputManager::Logf(const char* LogFormat, ...) const
+FLogOutputManager::FLogRecord& FLogOutputManager::ClaimRecord(size_t& OutPosition) const
 {
-	va_list Args;
-	va_start(Args, LogFormat);
-	vLogf(LogFormat, Args);
-	va_end(Args);
+	size_t Position = _EnqueuePosition.load(std::memory_order_relaxed);
+	while (true)
+	{
+		FLogRecord& Record = _Records[Position & _RecordMask];
+		const size_t Sequence = Record.Sequence.load(std::memory_order_acquire);
+		const std::ptrdiff_t Difference = static_cast<std::ptrdiff_t>(Sequence - Position);
+
+		if (Difference == 0)
+		{
+			// Free, try to take it before another producer does
+			if (_EnqueuePosition.compare_exchange_weak(Position, Position + 1, std::memory_order_relaxed))
+			{
+				OutPosition = Position;
+				return Record;
+			}
+		}
+		else if (Difference < 0)
+		{
+			// The ring is full. Drain it ourselves unless someone else already is.
+			if (_DrainMutex.try_lock())
+			{
+				DrainRecords();
+				_DrainMutex.unlock();
+			}
+			else
+			{
+				std::this_thread::yield();
+			}
+
+			Position = _EnqueuePosition.load(std::memory_order_relaxed);
+		}
+		else
+		{
+			// Another producer beat us to it
+			Position = _EnqueuePosition.load(std::memory_order_relaxed);
+		}
+	}
 }
 
-void FLogOutputManager::vLogf(const char* LogFormat, va_list Args) const
+void FLogOutputManager::PublishRecord(FLogRecord& Record, size_t Position) const
 {
-	char Timestamp[k_MaxLogTimestampLength];
-	FetchLogTimestamp(Timestamp);
+	Record.Sequence.store(Position + 1, std::memory_order_release);
+}
 
-	// Output to console, but don't output location
-	printf(Timestamp);
-	vprintf(LogFormat, Args);
+size_t FLogOutputManager::DrainRecords() const
+{
+	_ConsoleBatch.clear();
+	_FileBatch.clear();
 
-	// Dupe output to log file.
-	if (LogOutputFile != nullptr)
+#if GE_USE_CONSOLE
+	if (!_bHasConsoleFormats && FConsoleFormatting::IsInitialized())
 	{
-		fprintf(LogOutputFile, Timestamp);
-		vfprintf(LogOutputFile, LogFormat, Args);
-		fflush(LogOutputFile);
+		BuildConsoleFormats();
 	}
 
-#ifdef WINDOWS
-	// Dupe output to visual studio output.
-	OutputDebugString(Timestamp);
+	const char* CurrentConsoleFormat = nullptr;
+#endif	// GE_USE_CONSOLE
 
-	char VisualStudioOutputBuffer[k_MaxLogCharacterLength] = "";
-	_vsnprintf_s(VisualStudioOutputBuffer, sizeof(VisualStudioOutputBuffer), LogFormat, Args);
-	OutputDebugString(VisualStudioOutputBuffer);
+	// Never take more than a ring's worth, so a flood of logs can't keep us here
+	size_t NumDrained = 0;
+	while (NumDrained <= _RecordMask)
+	{
+		FLogRecord& Record = _Records[_DequeuePosition & _RecordMask];
+		if (Record.Sequence.load(std::memory_order_acquire) != _DequeuePosition + 1)
+		{
+			// Either empty, or the next record is still being written
+			break;
+		}
+
+#if GE_USE_CONSOLE
+		if (_bHasConsoleFormats && CurrentConsoleFormat != _ConsoleFormats[Record.Verbosity])
+		{
+			CurrentConsoleFormat = _ConsoleFormats[Record.Verbosity];
+			AppendToBatch(_ConsoleBatch, CurrentConsoleFormat, std::strlen(CurrentConsoleFormat));
+		}
+#endif	// GE_USE_CONSOLE
+
+		// Output to console, but don't output location
+		AppendToBatch(_ConsoleBatch, Record.Text, Record.TextLength);
+
+		// Dupe output to log file.
+		AppendToBatch(_FileBatch, Record.LogLocation, std::strlen(Record.LogLocation));
+		_FileBatch.push_back('\n');
+		AppendToBatch(_FileBatch, Record.Text, Record.TextLength);
+
+#ifdef WINDOWS
+		// Dupe output to visual studio output.
+		OutputDebugString(Record.LogLocation);
+		OutputDebugString("\n");
+		OutputDebugString(Record.Text);
 #endif	// WINDOWS
+
+		// Hand the slot back to producers for their next lap around the ring
+		Record.Sequence.store(_DequeuePosition + _RecordMask + 1, std::memory_order_release);
+		++_DequeuePosition;
+		++NumDrained;
+	}
+
+#if GE_USE_CONSOLE
+	if (CurrentConsoleFormat != nullptr)
+	{
+		AppendToBatch(_ConsoleBatch, _ConsoleResetFormat, std::strlen(_ConsoleResetFormat));
+	}
+#endif	// GE_USE_CONSOLE
+
+	if (!_ConsoleBatch.empty())
+	{
+		std::fwrite(_ConsoleBatch.data(), 1, _ConsoleBatch.size(), stdout);
+		std::fflush(stdout);
+	}
+
+	if (!_FileBatch.empty() && LogOutputFile != nullptr)
+	{
+		std::fwrite(_FileBatch.data(), 1, _FileBatch.size(), LogOutputFile);
+		_bHasUnflushedFileOutput = true;
+	}
+
+	return NumDrained;
 }
 
-void FLogOutputManager::FullLogf(const char* LogLocation, const char* LogFormat, ...) const
+void FLogOutputManager::FlushOutputs() const
 {
-	va_list Args;
-	va_start(Args, LogFormat);
-	vFullLogf(LogLocation, LogFormat, Args);
-	va_end(Args);
+	std::fflush(stdout);
+
+	if (_bHasUnflushedFileOutput && LogOutputFile != nullptr)
+	{
+		std::fflush(LogOutputFile);
+		_bHasUnflushedFileOutput = false;
+	}
 }
 
-void FLogOutputManager::vFullLogf(const char* LogLocation, const char* LogFormat, va_list Args) const
+void FLogOutputManager::BuildConsoleFormats() const
 {
-	char Timestamp[k_MaxLogTimestampLength];
-	FetchLogTimestamp(Timestamp);
+	for (sf::Uint8 VerbosityIndex = 0; VerbosityIndex < ELogVerbosity::Count; ++VerbosityIndex)
+	{
+		TOptional<EConsoleColor> TextColor;
+		std::map<EConsoleFormat, bool> FormatOptions;
+
+		switch (static_cast<ELogVerbosity>(VerbosityIndex))
+		{
+			case ELogVerbosity::Fatal:
+				FormatOptions.emplace(EConsoleFormat::Underline, true);
+				// Falls through to error...
+			case ELogVerbosity::Error:
+				TextColor.Set(EConsoleColor::Red);
+				FormatOptions.emplace(EConsoleFormat::Bold, true);
+				break;
+			case ELogVerbosity::Warning:
+				TextColor.Set(EConsoleColor::Yellow);
+				FormatOptions.emplace(EConsoleFormat::Bold, true);
+				break;
+			default:
+				break;
+		}
+
+		FConsoleFormatting::GetFormatString(_ConsoleFormats[VerbosityIndex], TextColor, FormatOptions);
+	}
 
-	// Output to console, but don't output location or timestamp
-	printf(Timestamp);
-	vprintf(LogFormat, Args);
+	FConsoleFormatting::GetFullResetString(_ConsoleResetFormat);
+	_bHasConsoleFormats = true;
+}
 
-	// Dupe output to log file.
-	if (LogOutputFile != nullptr)
+void FLogOutputManager::WriterMain()
+{
+	auto LastFileFlushTime = std::chrono::steady_clock::now();
+
+	while (!_bIsWriterStopping)
 	{
-		fprintf(LogOutputFile, "%s\n%s", LogLocation, Timestamp);
-		vfprintf(LogOutputFile, LogFormat, Args);
-		fflush(LogOutputFile);
+		{
+			// Producers only wake us when it matters, otherwise we drain on a timer
+			std::unique_lock<std::mutex> WakeLock(_WakeMutex);
+			if (!_bIsWriterStopping)
+			{
+				_WakeCondition.wait_for(WakeLock, k_WriterSleepDuration);
+			}
+		}
+
+		std::lock_guard<std::mutex> DrainLock(_DrainMutex);
+		DrainRecords();
+
+		const auto Now = std::chrono::steady_clock::now();
+		if (Now - LastFileFlushTime >= k_FileFlushInterval)
+		{
+			FlushOutputs();
+			LastFileFlushTime = Now;
+		}
 	}
-
-#ifdef WINDOWS
-	// Dupe output to visual studio output.
-	OutputDebugString(LogLocation);
-	OutputDebugString("\n");
-	OutputDebugString(Timestamp);
-
-	char VisualStudioOutputBuffer[k_MaxLogCharacterLength] = "";
-	_vsnprintf_s(VisualStudioOutputBuffer, sizeof(VisualStudioOutputBuffer), LogFormat, Args);
-	OutputDebugString(VisualStudioOutputBuffer);
-#endif	// WINDOWS
 }
@@ -5,4 +5,5 @@
 
 DEFINE_LOG_CATEGORY_EXTERN(LogTemp)
 DEFINE_LOG_CATEGORY_EXTERN(LogFileIO)
-DEFINE_LOG_CATEGORY_EXTERN(LogCore)
\ No newline at end of file
+DEFINE_LOG_CATEGORY_EXTERN(LogCore)
+DEFINE_LOG_CATEGORY_EXTERN(LogRendering)
\ No newline at end of file
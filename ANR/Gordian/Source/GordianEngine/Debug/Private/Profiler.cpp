@@ -0,0 +1,158 @@
+// Gordian by Daniel Luna (2019)
+
+#include "GordianEngine/Debug/Public/Profiler.h"
+
+#include <algorithm>
+#include <cstdio>
+
+#include "GordianEngine/Debug/Public/Logging.h"
+
+using namespace Gordian;
+
+namespace
+{
+	// Writes Text as the contents of a JSON string
+	void WriteJsonString(std::FILE* File, const char* Text)
+	{
+		for (const char* Character = Text; *Character != '\0'; ++Character)
+		{
+			if (*Character == '"' || *Character == '\\')
+			{
+				std::fputc('\\', File);
+			}
+			std::fputc(*Character, File);
+		}
+	}
+}
+
+/*static*/ const size_t FProfiler::k_EventsPerThread;
+
+/*static*/ FProfiler& FProfiler::Get()
+{
+	static FProfiler Singleton;
+
+	return Singleton;
+}
+
+FProfiler::FProfiler()
+	: _StartTime(std::chrono::steady_clock::now())
+	, _Buffers()
+{
+}
+
+void FProfiler::RecordEvent(const char* Name, sf::Int64 StartMicroseconds, sf::Int64 DurationMicroseconds)
+{
+	FThreadBuffer& Buffer = GetThreadBuffer();
+
+	// Only this thread writes to its buffer, so the count can be read relaxed
+	const size_t EventIndex = Buffer.NumWritten.load(std::memory_order_relaxed);
+	Buffer.Events[EventIndex % k_EventsPerThread] = FEvent{ Name, StartMicroseconds, DurationMicroseconds };
+	Buffer.NumWritten.store(EventIndex + 1, std::memory_order_release);
+}
+
+sf::Int64 FProfiler::GetTimestamp() const
+{
+	const std::chrono::steady_clock::duration TimeSinceStart = std::chrono::steady_clock::now() - _StartTime;
+	return std::chrono::duration_cast<std::chrono::microseconds>(TimeSinceStart).count();
+}
+
+bool FProfiler::ExportChromeTrace(const std::string& FilePath) const
+{
+	std::FILE* TraceFile = nullptr;
+	errno_t ErrorCode = fopen_s(&TraceFile, FilePath.c_str(), "w");
+	if (ErrorCode != 0 || TraceFile == nullptr)
+	{
+		GE_LOG(LogFileIO, Warning, "Could not open %s to write a trace to. (Code: %d)", FilePath.c_str(), ErrorCode);
+		return false;
+	}
+
+	std::fputs("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[", TraceFile);
+
+	size_t NumEventsWritten = 0;
+	std::vector<FEvent> Events;
+
+	std::lock_guard<std::mutex> Lock(_BuffersMutex);
+	for (const std::unique_ptr<FThreadBuffer>& Buffer : _Buffers)
+	{
+		Events.clear();
+		CopyEvents(*Buffer, Events);
+
+		for (const FEvent& Event : Events)
+		{
+			std::fputs(NumEventsWritten > 0 ? ",\n{\"name\":\"" : "\n{\"name\":\"", TraceFile);
+			WriteJsonString(TraceFile, Event.Name);
+			std::fprintf(TraceFile, "\",\"cat\":\"Gordian\",\"ph\":\"X\",\"pid\":0,\"tid\":%u,\"ts\":%lld,\"dur\":%lld}",
+						 Buffer->ThreadIndex,
+						 static_cast<long long>(Event.StartMicroseconds),
+						 static_cast<long long>(Event.DurationMicroseconds));
+			++NumEventsWritten;
+		}
+	}
+
+	std::fputs("\n]}\n", TraceFile);
+
+	const bool bWroteEverything = std::ferror(TraceFile) == 0;
+	const bool bClosed = std::fclose(TraceFile) == 0;
+	if (!bWroteEverything || !bClosed)
+	{
+		GE_LOG(LogFileIO, Warning, "Failed to write trace to %s", FilePath.c_str());
+		return false;
+	}
+
+	GE_LOG(LogFileIO, Log, "Wrote %zu profiled events to %s", NumEventsWritten, FilePath.c_str());
+	return true;
+}
+
+void FProfiler::Clear()
+{
+	std::lock_guard<std::mutex> Lock(_BuffersMutex);
+	for (const std::unique_ptr<FThreadBuffer>& Buffer : _Buffers)
+	{
+		Buffer->NumCleared.store(Buffer->NumWritten.load(std::memory_order_acquire), std::memory_order_release);
+	}
+}
+
+FProfiler::FThreadBuffer& FProfiler::GetThreadBuffer()
+{
+	thread_local FThreadBuffer* ThreadBuffer = nullptr;
+	if (ThreadBuffer == nullptr)
+	{
+		std::unique_ptr<FThreadBuffer> NewBuffer = std::make_unique<FThreadBuffer>();
+		NewBuffer->Events = std::make_unique<FEvent[]>(k_EventsPerThread);
+		NewBuffer->NumWritten.store(0, std::memory_order_relaxed);
+		NewBuffer->NumCleared.store(0, std::memory_order_relaxed);
+
+		std::lock_guard<std::mutex> Lock(_BuffersMutex);
+		NewBuffer->ThreadIndex = static_cast<sf::Uint32>(_Buffers.size());
+		ThreadBuffer = NewBuffer.get();
+		_Buffers.push_back(std::move(NewBuffer));
+	}
+
+	return *ThreadBuffer;
+}
+
+/*static*/ void FProfiler::CopyEvents(const FThreadBuffer& Buffer, std::vector<FEvent>& OutEvents)
+{
+	const size_t NumWrittenBefore = Buffer.NumWritten.load(std::memory_order_acquire);
+	const size_t NumCleared = Buffer.NumCleared.load(std::memory_order_acquire);
+
+	size_t FirstEvent = NumWrittenBefore > k_EventsPerThread ? NumWrittenBefore - k_EventsPerThread : 0;
+	FirstEvent = std::max(FirstEvent, NumCleared);
+
+	const size_t FirstCopied = OutEvents.size();
+	for (size_t EventIndex = FirstEvent; EventIndex < NumWrittenBefore; ++EventIndex)
+	{
+		OutEvents.push_back(Buffer.Events[EventIndex % k_EventsPerThread]);
+	}
+
+	// The owning thread kept recording while we copied. Anything it may have
+	//	written over since, including the slot it is writing now, is thrown away.
+	std::atomic_thread_fence(std::memory_order_acquire);
+	const size_t NumWrittenAfter = Buffer.NumWritten.load(std::memory_order_relaxed);
+	const size_t FirstIntactEvent = NumWrittenAfter + 1 > k_EventsPerThread ? NumWrittenAfter + 1 - k_EventsPerThread : 0;
+	if (FirstIntactEvent > FirstEvent)
+	{
+		const size_t NumTorn = std::min(FirstIntactEvent - FirstEvent, NumWrittenBefore - FirstEvent);
+		OutEvents.erase(OutEvents.begin() + FirstCopied, OutEvents.begin() + FirstCopied + NumTorn);
+	}
+}
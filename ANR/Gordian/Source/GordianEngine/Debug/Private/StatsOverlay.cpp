@@ -0,0 +1,253 @@
+// Gordian by Daniel Luna (2019)
+
+#include "GordianEngine/Debug/Public/StatsOverlay.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <filesystem>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "SFML/Graphics/RenderTarget.hpp"
+
+#include "GordianEngine/Debug/Public/Logging.h"
+#include "GordianEngine/GlobalLibraries/Public/GlobalObjectLibrary.h"
+
+#ifdef WINDOWS
+	#include <Windows.h>
+	#include <Psapi.h>
+#endif	// WINDOWS
+
+using namespace Gordian;
+
+namespace
+{
+	// Shares the command prompt's font, so the two overlays look alike
+	const char* k_StatsOverlayFontFilepath = "/Netrunner/Resources/Default/CommandPrompt.ttf";
+	const unsigned int k_StatsOverlayFontSize = 14;
+	const sf::Uint8 k_StatsOverlayBackgroundAlpha = 160;
+	// Space between the text and the edges of its background
+	const float k_StatsOverlayPadding = 6.f;
+
+	// Frames the rolling stats are taken over
+	const size_t k_FrameHistorySize = 120;
+	// Memory samples kept, one per refresh
+	const size_t k_HeapHistorySize = 16;
+	// Frames between text refreshes while shown
+	const sf::Uint32 k_FramesPerRefresh = 15;
+	// Types with the most live objects listed, at most
+	const size_t k_MaxTypesListed = 8;
+
+	const float k_BytesPerMegabyte = 1024.f * 1024.f;
+
+	// Bytes of memory the process has committed, or 0 where that is not measured
+	size_t GetProcessMemoryBytes()
+	{
+#ifdef WINDOWS
+		PROCESS_MEMORY_COUNTERS_EX MemoryCounters;
+		if (GetProcessMemoryInfo(GetCurrentProcess(),
+								 reinterpret_cast<PROCESS_MEMORY_COUNTERS*>(&MemoryCounters),
+								 sizeof(MemoryCounters)))
+		{
+			return static_cast<size_t>(MemoryCounters.PrivateUsage);
+		}
+#endif	// WINDOWS
+		return 0;
+	}
+
+	float SelectFrameMilliseconds(const FFrameStats& Stats)
+	{
+		return Stats.FrameTime.asSeconds() * 1000.f;
+	}
+
+	float SelectTickMilliseconds(const FFrameStats& Stats)
+	{
+		return Stats.TickTime.asSeconds() * 1000.f;
+	}
+
+	float SelectDrawCalls(const FFrameStats& Stats)
+	{
+		return static_cast<float>(Stats.NumDrawCalls);
+	}
+
+	// Appends one row of the min/avg/max table to Text
+	void AppendSummaryRow(std::string& Text, const char* Label, const FStatSummary& Summary)
+	{
+		char Row[96];
+		std::snprintf(Row, sizeof(Row), "%-10s%8.2f%8.2f%8.2f\n", Label, Summary.Min, Summary.Average, Summary.Max);
+		Text += Row;
+	}
+}
+
+/*static*/ FStatsOverlay& FStatsOverlay::Get()
+{
+	static FStatsOverlay Singleton;
+
+	return Singleton;
+}
+
+FStatsOverlay::FStatsOverlay()
+	: _Font()
+	, _Text()
+	, _Background()
+	, _FrameHistory(k_FrameHistorySize)
+	, _HeapHistory(k_HeapHistorySize)
+	, _FramesSinceRefresh(0)
+	, _bIsVisible(false)
+{
+	std::experimental::filesystem::path CurrentPath = std::experimental::filesystem::current_path().parent_path();
+	std::string FullFontPath = CurrentPath.generic_string().append(k_StatsOverlayFontFilepath);
+	if (!_Font.loadFromFile(FullFontPath))
+	{
+		GE_LOG(LogFileIO, Warning, "StatsOverlay could not find its font %s to load.", k_StatsOverlayFontFilepath);
+	}
+
+	_Text.setFont(_Font);
+	_Text.setCharacterSize(k_StatsOverlayFontSize);
+	_Text.setFillColor(sf::Color::White);
+	_Text.setPosition(k_StatsOverlayPadding, k_StatsOverlayPadding);
+
+	_Background.setFillColor(sf::Color(0, 0, 0, k_StatsOverlayBackgroundAlpha));
+}
+
+void FStatsOverlay::Toggle()
+{
+	_bIsVisible = !_bIsVisible;
+
+	if (_bIsVisible)
+	{
+		// Don't show whatever was laid out the last time it was open
+		RefreshText();
+	}
+}
+
+void FStatsOverlay::RecordFrame(const FFrameStats& Stats)
+{
+	_FrameHistory.Enqueue(Stats);
+
+	++_FramesSinceRefresh;
+	if (_bIsVisible && _FramesSinceRefresh >= k_FramesPerRefresh)
+	{
+		RefreshText();
+	}
+}
+
+FStatSummary FStatsOverlay::GetFrameTimeSummary() const
+{
+	return Summarize(&SelectFrameMilliseconds);
+}
+
+FStatSummary FStatsOverlay::GetTickTimeSummary() const
+{
+	return Summarize(&SelectTickMilliseconds);
+}
+
+FStatSummary FStatsOverlay::GetDrawCallSummary() const
+{
+	return Summarize(&SelectDrawCalls);
+}
+
+void FStatsOverlay::draw(sf::RenderTarget& target, sf::RenderStates states) const
+{
+	if (!_bIsVisible)
+	{
+		return;
+	}
+
+	target.draw(_Background, states);
+	target.draw(_Text, states);
+}
+
+void FStatsOverlay::RefreshText()
+{
+	_FramesSinceRefresh = 0;
+
+	std::string Text;
+	Text.reserve(1024);
+	char Line[128];
+	std::snprintf(Line, sizeof(Line), "%-10s%8s%8s%8s\n", "", "min", "avg", "max");
+	Text += Line;
+
+	AppendSummaryRow(Text, "Frame ms", GetFrameTimeSummary());
+	AppendSummaryRow(Text, "Tick ms", GetTickTimeSummary());
+	AppendSummaryRow(Text, "Draws", GetDrawCallSummary());
+
+	const size_t ProcessMemoryBytes = GetProcessMemoryBytes();
+	if (ProcessMemoryBytes > 0)
+	{
+		_HeapHistory.Enqueue(ProcessMemoryBytes);
+
+		FStatSummary HeapSummary{ ProcessMemoryBytes / k_BytesPerMegabyte, 0.f, 0.f };
+		HeapSummary.Max = HeapSummary.Min;
+		for (size_t SampleIndex = 0; SampleIndex < _HeapHistory.Num(); ++SampleIndex)
+		{
+			const float SampleMegabytes = _HeapHistory[SampleIndex] / k_BytesPerMegabyte;
+			HeapSummary.Min = std::min(HeapSummary.Min, SampleMegabytes);
+			HeapSummary.Max = std::max(HeapSummary.Max, SampleMegabytes);
+			HeapSummary.Average += SampleMegabytes;
+		}
+		HeapSummary.Average /= _HeapHistory.Num();
+
+		AppendSummaryRow(Text, "Heap MB", HeapSummary);
+	}
+
+	// Every live object sits in its type's pool, so the pools double as per type counts
+	std::vector<std::pair<const OType_Struct*, size_t>> LiveObjectsByType;
+	size_t NumLiveObjects = 0;
+	size_t PooledBytes = 0;
+	FGlobalObjectLibrary::ForEachObjectPoolStats([&LiveObjectsByType, &NumLiveObjects, &PooledBytes](const OType_Struct* ObjectType, const FObjectPoolStats& PoolStats)
+	{
+		if (PoolStats.LiveSlots > 0)
+		{
+			LiveObjectsByType.emplace_back(ObjectType, PoolStats.LiveSlots);
+			NumLiveObjects += PoolStats.LiveSlots;
+		}
+		PooledBytes += PoolStats.SlabCount * PoolStats.SlotsPerSlab * PoolStats.SlotSize;
+	});
+
+	const size_t NumTypesListed = std::min(LiveObjectsByType.size(), k_MaxTypesListed);
+	std::partial_sort(LiveObjectsByType.begin(),
+					  LiveObjectsByType.begin() + NumTypesListed,
+					  LiveObjectsByType.end(),
+					  [](const std::pair<const OType_Struct*, size_t>& Lhs, const std::pair<const OType_Struct*, size_t>& Rhs)
+	{
+		return Lhs.second > Rhs.second;
+	});
+
+	std::snprintf(Line, sizeof(Line), "\nObjects %zu live, pools %.2f MB\n", NumLiveObjects, PooledBytes / k_BytesPerMegabyte);
+	Text += Line;
+	for (size_t TypeIndex = 0; TypeIndex < NumTypesListed; ++TypeIndex)
+	{
+		std::snprintf(Line, sizeof(Line), "  %-24s%8zu\n",
+					  LiveObjectsByType[TypeIndex].first->GetName().c_str(),
+					  LiveObjectsByType[TypeIndex].second);
+		Text += Line;
+	}
+
+	_Text.setString(Text);
+
+	const sf::FloatRect TextBounds = _Text.getGlobalBounds();
+	_Background.setSize(sf::Vector2f(TextBounds.left + TextBounds.width + k_StatsOverlayPadding,
+									 TextBounds.top + TextBounds.height + k_StatsOverlayPadding));
+}
+
+FStatSummary FStatsOverlay::Summarize(float (*Select)(const FFrameStats&)) const
+{
+	if (_FrameHistory.IsEmpty())
+	{
+		return FStatSummary{ 0.f, 0.f, 0.f };
+	}
+
+	FStatSummary Summary{ Select(_FrameHistory[0]), 0.f, Select(_FrameHistory[0]) };
+	for (size_t FrameIndex = 0; FrameIndex < _FrameHistory.Num(); ++FrameIndex)
+	{
+		const float Value = Select(_FrameHistory[FrameIndex]);
+		Summary.Min = std::min(Summary.Min, Value);
+		Summary.Max = std::max(Summary.Max, Value);
+		Summary.Average += Value;
+	}
+	Summary.Average /= _FrameHistory.Num();
+
+	return Summary;
+}
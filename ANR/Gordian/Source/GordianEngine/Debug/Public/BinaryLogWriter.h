@@ -0,0 +1,121 @@
+// Gordian by Daniel Luna (2019)
+
+#pragma once
+
+#include "SFML/System/NonCopyable.hpp"
+
+#include <cstdio>
+#include <mutex>
+#include <vector>
+
+#include "LogVerbosity.h"
+
+namespace Gordian
+{
+
+
+class FBinaryLogWriter;
+
+// Binary log files are a stream of records, each starting with a type and a payload size.
+//	All values are little-endian. Tools/DecodeBinaryLog.py reads them back into text.
+enum class EBinaryLogRecord : sf::Uint8
+{
+	// Starts each run. Payload: u32 magic, u16 version, i64 start time (microseconds since epoch)
+	Session		= 0,
+	// Describes a call site. Payload: u32 site id, u8 verbosity, then category, location
+	//	and format, each as a u16 length followed by that many chars
+	Site		= 1,
+	// A single log. Payload: u32 site id, i64 time (microseconds since epoch), then each argument
+	Log			= 2,
+};
+
+// Tags each argument of a log record, followed by the argument's raw bytes.
+enum class EBinaryLogArg : sf::Uint8
+{
+	Int32		= 1,
+	UInt32		= 2,
+	Int64		= 3,
+	UInt64		= 4,
+	Double		= 5,
+	// u16 length followed by that many chars
+	String		= 6,
+	// u64 address
+	Pointer		= 7,
+};
+
+
+// A single GE_LOG call site writing to the binary log.
+// Its category, location and format are written once, every log after that only refers to its id.
+class FBinaryLogSite : sf::NonCopyable
+{
+public:
+
+	FBinaryLogSite(FBinaryLogWriter& Writer,
+				   const char* Category,
+				   ELogVerbosity Verbosity,
+				   const char* LogLocation,
+				   const char* LogFormat);
+
+	sf::Uint32 GetId() const;
+
+	ELogVerbosity GetVerbosity() const;
+
+private:
+
+	sf::Uint32 _Id;
+
+	ELogVerbosity _Verbosity;
+};
+
+
+// Writes logs without formatting them. Each log only copies its call site id, a timestamp and its
+//	raw arguments, leaving the formatting to an offline decoder.
+class FBinaryLogWriter : sf::NonCopyable
+{
+public:
+
+	// Gets the writer used by GE_LOG, which writes to Log.bin
+	static FBinaryLogWriter& Get();
+
+	explicit FBinaryLogWriter(const char* Filepath);
+	~FBinaryLogWriter();
+
+	// Records a log from the given site. Fatal logs are flushed right away.
+	template <typename... TArgs>
+	void Write(const FBinaryLogSite& Site, TArgs... Args);
+
+	// Writes out everything logged so far
+	void Flush();
+
+private:
+
+	friend FBinaryLogSite;
+
+	// Adds a site, writing out its description. Returns its id.
+	sf::Uint32 RegisterSite(const char* Category,
+							ELogVerbosity Verbosity,
+							const char* LogLocation,
+							const char* LogFormat);
+
+	// Copies a finished record into the pending buffer, writing it out once it gets large
+	void AppendRecord(const char* Record, size_t RecordSize);
+
+	// Swaps out the pending buffer and writes it. Expects _BufferMutex to be held by BufferLock.
+	void WritePendingBuffer(std::unique_lock<std::mutex>& BufferLock);
+
+	FILE* _OutputFile;
+
+	// Records waiting to be written, along with the number of sites handed out
+	std::mutex _BufferMutex;
+	std::vector<char> _PendingBuffer;
+	sf::Uint32 _NumSites;
+
+	// Held while writing to the file, so buffers land in the order they were filled
+	std::mutex _FileMutex;
+	std::vector<char> _WritingBuffer;
+};
+
+
+};
+
+#include "../Private/BinaryLogWriter.inl"
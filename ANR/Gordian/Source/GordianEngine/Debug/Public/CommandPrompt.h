@@ -2,6 +2,10 @@
 
 #pragma once
 
+#include <functional>
+#include <string>
+#include <vector>
+
 #include "SFML/Graphics/Drawable.hpp"
 #include "SFML/Graphics/RectangleShape.hpp"
 #include "SFML/Graphics/Text.hpp"
@@ -16,6 +20,9 @@ namespace Gordian
 {
 
 
+// Runs a console command. Receives the words typed after the command's name.
+typedef std::function<void(const std::vector<std::string>&)> FConsoleCommand;
+
 // Allows the user to input debug commands via string.
 // This is intentionally not using the UI functionality to keep its functionality independent 
 //	from as many Gordian systems as possible.
@@ -38,6 +45,14 @@ public:
 	// Returns whether or not the prompt is open
 	bool IsOpen() const;
 
+	// Makes Command run whenever a line starting with Name is digested.
+	//	Registering a name twice replaces the first command.
+	void RegisterCommand(const std::string& Name, const FConsoleCommand& Command);
+
+	// Splits CommandLine on spaces and runs the command named by the first word.
+	// Returns false if no such command is registered.
+	bool ExecuteCommand(const std::string& CommandLine);
+
 	// Draw override for the prompt.
 	virtual void draw(sf::RenderTarget& target, sf::RenderStates states) const override;
 
@@ -55,6 +70,9 @@ protected:
 	// Digests the CurrentInputString into actual function commands
 	void DigestCommand();
 
+	// Completes the command name being typed, listing the most used matches if there are several
+	void AutoCompleteCommand();
+
 	// Setter for current input string
 	void SetCurrentInputString(const sf::String& NewInputString);
 	// Appends a character to the current input string
@@ -73,6 +91,8 @@ private:
 	sf::Font PromptFont;
 	// The drawable text representing the user's input
 	sf::Text CurrentInputText;
+	// Commands matching the input, shown above it after autocompleting
+	sf::Text SuggestionsText;
 	// The background rectangle for the entire console
 	sf::RectangleShape BackgroundShape;
 
@@ -82,7 +102,8 @@ private:
 		
 	};
 
-	TPrefixTree<int> TestTrie;
+	// Registered commands by name, ranked by how often they have been run
+	TPrefixTree<FConsoleCommand> Commands;
 
 	// List of Recent Digested Commands
 	TCircularBuffer<sf::String> PreviousCommands;
@@ -12,6 +12,17 @@ namespace Gordian
 {
 
 
+// Where a log category's logs are written. Can be combined.
+enum class ELogSink : sf::Uint8
+{
+	// Formatted as it is logged, then written to the console, debugger and log file
+	Text			= 1 << 0,
+	// Written unformatted to the binary log, to be decoded offline
+	Binary			= 1 << 1,
+	TextAndBinary	= Text | Binary,
+};
+
+
 // Houses information about a log category.
 // Each category has it's own max verbosity that it will compile / print.
 class FLogCategoryBase : public sf::NonCopyable
@@ -42,6 +53,15 @@ public:
 	// Resets the max runtime verbosity to its default
 	void ResetRuntimeVerboisty();
 
+	// Reads where logs in this category are written
+	ELogSink GetLogSinks() const;
+
+	// Returns whether or not logs in this category are written to the given sink
+	bool IsLoggingTo(ELogSink Sink) const;
+
+	// Sets where logs in this category are written. Fatal logs are always written as text.
+	void SetLogSinks(ELogSink InSinks);
+
 protected:
 
 	// The print-friendly name of the category
@@ -57,6 +77,9 @@ protected:
 	//	This cannot be changed without a recompile.
 	const ELogVerbosity CompileTimeVerbosity;
 
+	// Where logs in this category are written. Defaults to text.
+	ELogSink Sinks;
+
 };
 
 
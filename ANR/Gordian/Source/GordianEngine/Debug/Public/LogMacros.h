@@ -6,6 +6,7 @@
 
 #include "GordianEngine/Utility/Public/CommonMacros.h"
 #include "AssertMacros.h"
+#include "BinaryLogWriter.h"
 #include "LogCategory.h"
 #include "LogOutputManager.h"
 #include "LogVerbosity.h"
@@ -62,6 +63,29 @@ namespace Gordian
 		{
 			return false;
 		}
+
+		// Sends a single log to every sink its category writes to. Arguments are only evaluated
+		//	once, by the macro, then copied to each sink. GetBinarySite returns the call site's
+		//	FBinaryLogSite given its location, and only makes it the first time the site logs
+		//	to the binary log.
+		template<typename Category, typename TGetBinarySite, typename... TArgs>
+		void WriteLog(const Category& LogCategory,
+					  ELogVerbosity Verbosity,
+					  const char* LogLocation,
+					  const char* LogFormat,
+					  TGetBinarySite GetBinarySite,
+					  TArgs... Args)
+		{
+			if (LogCategory.IsLoggingTo(ELogSink::Binary))
+			{
+				FBinaryLogWriter::Get().Write(GetBinarySite(LogLocation), Args...);
+			}
+
+			if (LogCategory.IsLoggingTo(ELogSink::Text) || Verbosity == ELogVerbosity::Fatal)
+			{
+				GLogOutputManager.PrintLog(LogCategory.GetCategoryName(), Verbosity, LogLocation, LogFormat, Args...);
+			}
+		}
 	};
 
 	// Returns true if the given log category is active at the given verbosity.
@@ -75,11 +99,20 @@ namespace Gordian
 		static_assert(Verbosity >= 0 && Verbosity < ELogVerbosity::Count, "Expects legal verbosity!");			\
 		if (GE_IS_LOG_ACTIVE(Category, Verbosity))																\
 		{																										\
-			GLogOutputManager.PrintLog(Category.GetCategoryName(),												\
-									   ELogVerbosity::Verbosity,												\
-									   __GE_LOG_LOCATION__(__FILE__, __FUNCTIONSIG__, __TOSTRING(__LINE__)),	\
-									   LogFormat,																\
-									   ##__VA_ARGS__);															\
+			Gordian::PrivateLogHelpers::WriteLog(Category,														\
+												 ELogVerbosity::Verbosity,										\
+												 __GE_LOG_LOCATION__(__FILE__, __FUNCTIONSIG__, __TOSTRING(__LINE__)),	\
+												 LogFormat,														\
+												 [](const char* LogLocation) -> const FBinaryLogSite&			\
+												 {																\
+													 static const FBinaryLogSite BinaryLogSite(FBinaryLogWriter::Get(),	\
+																							   Category.GetCategoryName(),	\
+																							   ELogVerbosity::Verbosity,	\
+																							   LogLocation,			\
+																							   LogFormat);			\
+													 return BinaryLogSite;										\
+												 },																\
+												 ##__VA_ARGS__);												\
 		}																										\
 																												\
 		if (Verbosity == ELogVerbosity::Fatal)																	\
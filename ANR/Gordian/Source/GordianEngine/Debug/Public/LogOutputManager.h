@@ -4,8 +4,14 @@
 
 #include "SFML/System/NonCopyable.hpp"
 
+#include <atomic>
+#include <condition_variable>
 #include <cstdio>
 #include <cstdarg>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
 
 #include "LogVerbosity.h"
 
@@ -14,13 +20,26 @@ namespace Gordian
 
 
 // Manages log / debug output to console-like objects
+//
+// Logging threads format their log straight into a slot of a lock-free ring,
+//	and a background writer thread drains the ring in batches. The writer only
+//	touches the console and log file once per batch, and only flushes the log
+//	file on a timer, after a fatal log, or when Flush is called.
+//	Until the writer is started, each log is written out on the thread that made it.
 class FLogOutputManager : sf::NonCopyable
 {
 public:
 
+	// Writes to Log.txt
 	FLogOutputManager();
+	// Writes to LogFilepath, queuing up to RecordCapacity logs. RecordCapacity must be a power of two.
+	FLogOutputManager(const char* LogFilepath, size_t RecordCapacity);
 	~FLogOutputManager();
 
+	// Starts the background writer. GLogOutputManager is built during static initialization,
+	//	so the engine starts its writer once it initializes.
+	void StartWriterThread();
+
 	void PrintEnsure(const char* EnsureText,
 					 const char* FileName,
 					 int LineNumber) const;
@@ -35,32 +54,84 @@ public:
 				  const char* LogFormat,
 				  ...) const;
 
+	// Writes out every log queued so far on the calling thread, then flushes all output.
+	void Flush() const;
+
 	void SetIsEnabled(bool bInIsEnabled);
 
 private:
 
-	// Prints log to all appropriate streams.
-	void Logf(const char* LogFormat, ...) const;
+	// A single formatted log waiting to be written.
+	struct FLogRecord
+	{
+		// Tells producers and the writer whose turn it is to use this slot
+		std::atomic<size_t> Sequence;
+		ELogVerbosity Verbosity;
+		// Points at a string literal, so it is safe to keep around
+		const char* LogLocation;
+		size_t TextLength;
+		// Timestamp, category and message, ending in a newline.
+		// Sized for a full length log plus its timestamp.
+		char Text[1024 + 32];
+	};
+
+	// Claims a free record, waiting on the writer if the ring is full.
+	FLogRecord& ClaimRecord(size_t& OutPosition) const;
 
-	// Prints log to all appropriate streams.
-	void vLogf(const char* LogFormat, va_list Args) const;
+	// Hands a filled in record over to the writer
+	void PublishRecord(FLogRecord& Record, size_t Position) const;
 
-	// Prints log to all appropriate streams.
-	void FullLogf(const char* LogLocation, const char* LogFormat, ...) const;
+	// Writes out every published record. Returns the number written.
+	// Expects _DrainMutex to be held.
+	size_t DrainRecords() const;
 
-	// Prints log to all appropriate streams, but the log location does not get
-	// output to the console.
-	void vFullLogf(const char* LogLocation, const char* LogFormat, va_list Args) const;
+	// Flushes the log file and console. Expects _DrainMutex to be held.
+	void FlushOutputs() const;
 
-	// Fetches the current time as a file name for the log
-	void GenerateLogFilename(char* OutString) const;
+	// Builds the console format string for each verbosity. Expects _DrainMutex to be held.
+	void BuildConsoleFormats() const;
 
-	// Fetches the current time as a string for log lines
-	void FetchLogTimestamp(char* OutString) const;
+	void WriterMain();
+
+	// Fetches the current time as a string for log lines.
+	// The string is cached per thread, and only rebuilt once a second.
+	// Returns the length of the string.
+	size_t FetchLogTimestamp(char* OutString) const;
 
 	bool bIsEnabled;
 
 	FILE* LogOutputFile;
+
+	// Fixed size ring of records. Capacity is a power of two.
+	std::unique_ptr<FLogRecord[]> _Records;
+	size_t _RecordMask;
+	// Producers wake the writer early every time this many records have been queued
+	size_t _WakeWriterInterval;
+
+	// Next position a producer will claim
+	mutable std::atomic<size_t> _EnqueuePosition;
+	// Next position to be drained. Only touched while holding _DrainMutex.
+	mutable size_t _DequeuePosition;
+
+	// Held by whoever is draining the ring, making the drain single-consumer
+	mutable std::mutex _DrainMutex;
+
+	// Text batched up during a drain, written out in one go per output
+	mutable std::vector<char> _ConsoleBatch;
+	mutable std::vector<char> _FileBatch;
+	mutable bool _bHasUnflushedFileOutput;
+
+	// Console format strings per verbosity, built once console formatting is ready
+	mutable char _ConsoleFormats[ELogVerbosity::Count][16];
+	mutable char _ConsoleResetFormat[16];
+	mutable bool _bHasConsoleFormats;
+
+	std::thread _WriterThread;
+	mutable std::mutex _WakeMutex;
+	mutable std::condition_variable _WakeCondition;
+	std::atomic<bool> _bIsWriterStopping;
+	// False when there is no writer thread, in which case logs are written on the spot
+	std::atomic<bool> _bIsWriterRunning;
 };
 
 // We use a global variable for macro simplicity.
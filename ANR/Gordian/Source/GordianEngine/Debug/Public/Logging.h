@@ -12,3 +12,5 @@ DECLARE_LOG_CATEGORY_EXTERN(LogTemp, Log, Verbose);
 DECLARE_LOG_CATEGORY_EXTERN(LogFileIO, Log, Verbose);
 // Used by core engine loop
 DECLARE_LOG_CATEGORY_EXTERN(LogCore, Log, Verbose);
+// Used by rendering and texture loading
+DECLARE_LOG_CATEGORY_EXTERN(LogRendering, Log, Verbose);
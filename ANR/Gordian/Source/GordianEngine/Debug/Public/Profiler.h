@@ -0,0 +1,123 @@
+// Gordian by Daniel Luna (2019)
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "SFML/Config.hpp"
+#include "SFML/System/NonCopyable.hpp"
+
+#include "GordianEngine/Utility/Public/CommonMacros.h"
+
+// Profiling markers compile to nothing in release builds
+#ifndef GE_USE_PROFILER
+	#define GE_USE_PROFILER (!GE_RELEASE && !GE_SHIPPING)
+#endif
+
+namespace Gordian
+{
+
+
+// Records timed scopes from every thread, and writes them out as a Chrome trace.
+// Each thread records into its own ring buffer, so recording never takes a lock.
+//	Only the most recent events of each thread are kept.
+class FProfiler : public sf::NonCopyable
+{
+public:
+
+	struct FEvent
+	{
+		// Must outlive the profiler, such as a string literal or a type's name
+		const char* Name;
+		sf::Int64 StartMicroseconds;
+		sf::Int64 DurationMicroseconds;
+	};
+
+	static FProfiler& Get();
+
+	// Records a scope that ran on the calling thread
+	void RecordEvent(const char* Name, sf::Int64 StartMicroseconds, sf::Int64 DurationMicroseconds);
+
+	// Microseconds since the profiler was created
+	sf::Int64 GetTimestamp() const;
+
+	// Writes every kept event as Chrome trace_event JSON, which chrome://tracing can open.
+	//	Returns false if the file could not be written.
+	bool ExportChromeTrace(const std::string& FilePath) const;
+
+	// Forgets every event recorded so far
+	void Clear();
+
+	// Events each thread keeps before overwriting its oldest
+	static const size_t k_EventsPerThread = 1 << 16;
+
+private:
+
+	// Written only by its own thread, and read by whoever exports
+	struct FThreadBuffer
+	{
+		sf::Uint32 ThreadIndex;
+		std::unique_ptr<FEvent[]> Events;
+		// Total events ever written. The newest is at (NumWritten - 1) % k_EventsPerThread.
+		std::atomic<size_t> NumWritten;
+		// Events before this were cleared
+		std::atomic<size_t> NumCleared;
+	};
+
+	FProfiler();
+
+	// Returns the calling thread's buffer, creating it on first use
+	FThreadBuffer& GetThreadBuffer();
+
+	// Copies the events of Buffer that are still intact
+	static void CopyEvents(const FThreadBuffer& Buffer, std::vector<FEvent>& OutEvents);
+
+	const std::chrono::steady_clock::time_point _StartTime;
+
+	// Guards adding buffers. Buffers outlive their threads, so their events can still be exported.
+	mutable std::mutex _BuffersMutex;
+	std::vector<std::unique_ptr<FThreadBuffer>> _Buffers;
+};
+
+// Times the scope it is declared in. Use GE_PROFILE_SCOPE rather than this directly.
+class FProfileScope
+{
+public:
+
+	explicit FProfileScope(const char* InName)
+		: _Name(InName)
+		, _StartMicroseconds(FProfiler::Get().GetTimestamp())
+	{
+	}
+
+	~FProfileScope()
+	{
+		FProfiler& Profiler = FProfiler::Get();
+		Profiler.RecordEvent(_Name, _StartMicroseconds, Profiler.GetTimestamp() - _StartMicroseconds);
+	}
+
+private:
+
+	const char* _Name;
+	sf::Int64 _StartMicroseconds;
+};
+
+
+#if GE_USE_PROFILER
+
+	// Times the rest of the current scope under Name, which must outlive the profiler
+	#define GE_PROFILE_SCOPE(Name) Gordian::FProfileScope __GE_CONCAT(ProfileScope_, __LINE__)(Name)
+
+#else	// !GE_USE_PROFILER
+
+	#define GE_PROFILE_SCOPE(Name)
+
+#endif	// GE_USE_PROFILER
+
+
+};
@@ -0,0 +1,96 @@
+// Gordian by Daniel Luna (2019)
+
+#pragma once
+
+#include "SFML/Graphics/Drawable.hpp"
+#include "SFML/Graphics/Font.hpp"
+#include "SFML/Graphics/RectangleShape.hpp"
+#include "SFML/Graphics/Text.hpp"
+#include "SFML/System/NonCopyable.hpp"
+#include "SFML/System/Time.hpp"
+
+#include "GordianEngine/Containers/Public/TCircularBuffer.h"
+
+namespace Gordian
+{
+
+
+// What the engine measured over one frame
+struct FFrameStats
+{
+	// Time since the previous frame
+	sf::Time FrameTime;
+	// Time spent ticking the world this frame, over every tick run
+	sf::Time TickTime;
+	// Draw calls made rendering the world
+	size_t NumDrawCalls;
+};
+
+// Rolling minimum, average and maximum of one stat
+struct FStatSummary
+{
+	float Min;
+	float Average;
+	float Max;
+};
+
+// Draws recent frame stats over the game, alongside the command prompt.
+// Frames are recorded whether or not the overlay is shown, but its text is only rebuilt
+//	a few times a second while shown. sf::Text keeps its glyph layout until its string
+//	changes, so drawing in between costs one draw call for the background and one for the text.
+class FStatsOverlay : public sf::NonCopyable
+					, public sf::Drawable
+{
+public:
+
+	static FStatsOverlay& Get();
+
+	// Shows the overlay if hidden, and hides it if shown
+	void Toggle();
+
+	inline bool IsVisible() const
+	{
+		return _bIsVisible;
+	}
+
+	// Adds a finished frame to the history, dropping the oldest once full
+	void RecordFrame(const FFrameStats& Stats);
+
+	// Frame times, in milliseconds, over the recorded history
+	FStatSummary GetFrameTimeSummary() const;
+	// Tick times, in milliseconds, over the recorded history
+	FStatSummary GetTickTimeSummary() const;
+	// Draw calls per frame over the recorded history
+	FStatSummary GetDrawCallSummary() const;
+
+	// Draw override for the overlay
+	virtual void draw(sf::RenderTarget& target, sf::RenderStates states) const override;
+
+private:
+
+	FStatsOverlay();
+
+	// Samples memory use and lays out the text again from the history
+	void RefreshText();
+
+	// Summarizes the value Select reads from each recorded frame
+	FStatSummary Summarize(float (*Select)(const FFrameStats&)) const;
+
+	sf::Font _Font;
+	// Laid out only by RefreshText
+	sf::Text _Text;
+	sf::RectangleShape _Background;
+
+	// Most recent frames, oldest first
+	TCircularBuffer<FFrameStats> _FrameHistory;
+	// Process memory sampled each refresh, in bytes
+	TCircularBuffer<size_t> _HeapHistory;
+
+	// Frames recorded since the text was last refreshed
+	sf::Uint32 _FramesSinceRefresh;
+
+	bool _bIsVisible;
+};
+
+
+};
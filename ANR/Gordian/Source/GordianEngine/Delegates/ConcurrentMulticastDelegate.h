@@ -0,0 +1,168 @@
+// Gordian by Daniel Luna (2019)
+
+#pragma once
+#include "Delegate.h"
+#include <atomic>
+#include <cstddef>
+#include <vector>
+
+namespace Gordian {
+
+	// A multicast delegate that any thread may subscribe to, unsubscribe from or broadcast.
+	// Subscribers are kept in an immutable snapshot. Broadcasting reads the current snapshot without
+	// taking a lock, and subscription changes publish a new snapshot with a compare and swap.
+	// Replaced snapshots are freed once no broadcast is in progress, checked on each later change.
+	// A subscriber removed on one thread may still be called by a broadcast already underway on another,
+	// so objects must outlive their subscriptions by more than the unsubscribe itself.
+	template<typename RET, typename ...PARAMS>
+	class concurrent_multicast_delegate<RET(PARAMS...)> final : private delegate_base<RET(PARAMS...)> {
+		using element_type = typename delegate_base<RET(PARAMS...)>::InvocationElement;
+	public:
+
+		concurrent_multicast_delegate() = default;
+		~concurrent_multicast_delegate() {
+			delete current.load();
+			freeSnapshots(retired.exchange(nullptr));
+		} //~concurrent_multicast_delegate
+
+		concurrent_multicast_delegate& operator =(const concurrent_multicast_delegate&) = delete;
+		concurrent_multicast_delegate(const concurrent_multicast_delegate&) = delete;
+
+		bool isNull() const { return size() < 1; }
+
+		// Number of subscribers in the current snapshot. May already be stale when it returns.
+		size_t size() const {
+			const read_scope scope(*this);
+			const snapshot* subscribers = current.load();
+			return subscribers != nullptr ? subscribers->elements.size() : 0;
+		} //size
+
+		concurrent_multicast_delegate& operator +=(const delegate<RET(PARAMS...)>& another) {
+			if (another.isNull()) return *this;
+			const element_type item = another.invocation;
+			publish([&item](std::vector<element_type>& elements) {
+				elements.push_back(item);
+				return true;
+			});
+			return *this;
+		} //operator +=
+
+		// Removes the first subscriber matching another, if there is one
+		concurrent_multicast_delegate& operator -=(const delegate<RET(PARAMS...)>& another) {
+			if (another.isNull()) return *this;
+			const element_type item = another.invocation;
+			publish([&item](std::vector<element_type>& elements) {
+				for (auto it = elements.begin(); it != elements.end(); ++it) {
+					if (*it == item) {
+						elements.erase(it);
+						return true;
+					} //if
+				} //loop
+				return false;
+			});
+			return *this;
+		} //operator -=
+
+		// Removes every subscriber
+		void clear() {
+			publish([](std::vector<element_type>& elements) {
+				const bool hadSubscribers = !elements.empty();
+				elements.clear();
+				return hadSubscribers;
+			});
+		} //clear
+
+		// Calls every subscriber in the snapshot current when the broadcast starts.
+		// Return values are ignored.
+		void operator()(PARAMS... arg) const {
+			const read_scope scope(*this);
+			const snapshot* subscribers = current.load();
+			if (subscribers == nullptr) return;
+			for (const element_type& item : subscribers->elements)
+				(*(item.stub))(item.object, arg...);
+		} //operator()
+
+	private:
+
+		struct snapshot {
+			std::vector<element_type> elements;
+			// Links snapshots waiting to be freed
+			snapshot* nextRetired = nullptr;
+		}; //snapshot
+
+		// Marks a thread as possibly holding a snapshot for as long as it lives
+		struct read_scope {
+			explicit read_scope(const concurrent_multicast_delegate& owner) : readers(owner.activeReaders) { ++readers; }
+			~read_scope() { --readers; }
+			std::atomic<size_t>& readers;
+		}; //read_scope
+
+		// Publishes a copy of the current snapshot after Edit changes it, retrying if another thread
+		// published first. Edit returns false to leave the snapshot as it is.
+		template <typename EDIT>
+		void publish(const EDIT& edit) {
+			snapshot* replaced = nullptr;
+			{
+				// Copying reads the current snapshot, so it must not be freed underneath us
+				const read_scope scope(*this);
+				snapshot* expected = current.load();
+				for (;;) {
+					snapshot* desired = new snapshot();
+					if (expected != nullptr) desired->elements = expected->elements;
+					if (!edit(desired->elements)) {
+						delete desired;
+						return;
+					} //if
+					if (current.compare_exchange_weak(expected, desired)) break;
+					// Never published, so no one else can be reading it
+					delete desired;
+				} //loop
+				replaced = expected;
+			}
+
+			if (replaced != nullptr) retire(replaced);
+			reclaim();
+		} //publish
+
+		void retire(snapshot* replaced) {
+			replaced->nextRetired = retired.load();
+			while (!retired.compare_exchange_weak(replaced->nextRetired, replaced)) {}
+		} //retire
+
+		// Frees retired snapshots if no broadcast can still be reading them
+		void reclaim() {
+			// Everything taken here was replaced before the check below. A broadcast that loaded one
+			// of them counted itself as a reader first, so it is either still counted or long done.
+			snapshot* taken = retired.exchange(nullptr);
+			if (taken == nullptr) return;
+
+			if (activeReaders.load() == 0) {
+				freeSnapshots(taken);
+				return;
+			} //if
+
+			// Still in use, so hand them back for a later change to free
+			snapshot* last = taken;
+			while (last->nextRetired != nullptr) last = last->nextRetired;
+			last->nextRetired = retired.load();
+			while (!retired.compare_exchange_weak(last->nextRetired, taken)) {}
+		} //reclaim
+
+		static void freeSnapshots(snapshot* first) {
+			while (first != nullptr) {
+				snapshot* next = first->nextRetired;
+				delete first;
+				first = next;
+			} //loop
+		} //freeSnapshots
+
+		// Snapshot broadcasts read, or nullptr before anything subscribes
+		std::atomic<snapshot*> current{ nullptr };
+		// Replaced snapshots not yet freed
+		std::atomic<snapshot*> retired{ nullptr };
+		// Broadcasts and subscription changes currently reading a snapshot
+		mutable std::atomic<size_t> activeReaders{ 0 };
+
+	}; //class concurrent_multicast_delegate
+
+} /* namespace Gordian */
@@ -24,6 +24,7 @@ namespace Gordian {
 
 	template <typename T> class delegate;
 	template <typename T> class multicast_delegate;
+	template <typename T> class concurrent_multicast_delegate;
 
 	template<typename RET, typename ...PARAMS>
 	class delegate<RET(PARAMS...)> final : private delegate_base<RET(PARAMS...)> {
@@ -123,6 +124,7 @@ namespace Gordian {
 		} //lambda_stub
 
 		friend class multicast_delegate<RET(PARAMS...)>;
+		friend class concurrent_multicast_delegate<RET(PARAMS...)>;
 		typename delegate_base<RET(PARAMS...)>::InvocationElement invocation;
 
 	}; //class delegate
@@ -19,22 +19,29 @@
 
 #pragma once
 #include "Delegate.h"
-#include <list>
+#include <cstddef>
 #include <functional>
 
 namespace Gordian {
 
+	// Invocations are kept in one contiguous array, stored inline for the first few subscribers,
+	// so subscribing rarely allocates and broadcasting walks memory in order.
+	// Subscribers may be added or removed while broadcasting. Removed ones are skipped right away;
+	// added ones are first called by the next broadcast.
 	template<typename RET, typename ...PARAMS>
 	class multicast_delegate<RET(PARAMS...)> final : private delegate_base<RET(PARAMS...)> {
+		using element_type = typename delegate_base<RET(PARAMS...)>::InvocationElement;
 	public:
 
+		// Subscribers stored without allocating
+		static constexpr size_t inlineCapacity = 4;
+
 		multicast_delegate() = default;
 		~multicast_delegate() {
-			for (auto& element : invocationList) delete element;
-			invocationList.clear();
+			if (elements != inlineElements) delete[] elements;
 		} //~multicast_delegate
 
-		bool isNull() const { return invocationList.size() < 1; }
+		bool isNull() const { return liveCount < 1; }
 		bool operator ==(void* ptr) const {
 			return (ptr == nullptr) && this->isNull();
 		} //operator ==
@@ -42,22 +49,38 @@ namespace Gordian {
 			return (ptr != nullptr) || (!this->isNull());
 		} //operator !=
 
-		size_t size() const { return invocationList.size(); }
+		size_t size() const { return liveCount; }
 
 		multicast_delegate& operator =(const multicast_delegate&) = delete;
 		multicast_delegate(const multicast_delegate&) = delete;
 
 		multicast_delegate(multicast_delegate&& Other)
 		{
-			invocationList = Other.invocationList;
-			Other.invocationList.empty();
+			if (Other.elements == Other.inlineElements) {
+				for (size_t index = 0; index < Other.count; ++index)
+					inlineElements[index] = Other.inlineElements[index];
+			} else {
+				elements = Other.elements;
+				capacity = Other.capacity;
+			} //if
+			count = Other.count;
+			liveCount = Other.liveCount;
+
+			Other.elements = Other.inlineElements;
+			Other.capacity = inlineCapacity;
+			Other.count = 0;
+			Other.liveCount = 0;
 		}
 
 		bool operator ==(const multicast_delegate& another) const {
-			if (invocationList.size() != another.invocationList.size()) return false;
-			auto anotherIt = another.invocationList.begin();
-			for (auto it = invocationList.begin(); it != invocationList.end(); ++it)
-				if (**it != **anotherIt) return false;
+			if (liveCount != another.liveCount) return false;
+			size_t anotherIndex = 0;
+			for (size_t index = 0; index < count; ++index) {
+				if (elements[index].stub == nullptr) continue;
+				while (another.elements[anotherIndex].stub == nullptr) ++anotherIndex;
+				if (elements[index] != another.elements[anotherIndex]) return false;
+				++anotherIndex;
+			} //loop
 			return true;
 		} //==
 		bool operator !=(const multicast_delegate& another) const { return !(*this == another); }
@@ -65,13 +88,17 @@ namespace Gordian {
 		bool operator ==(const delegate<RET(PARAMS...)>& another) const {
 			if (isNull() && another.isNull()) return true;
 			if (another.isNull() || (size() != 1)) return false;
-			return (another.invocation == **invocationList.begin());
+			for (size_t index = 0; index < count; ++index)
+				if (elements[index].stub != nullptr) return another.invocation == elements[index];
+			return false;
 		} //==
 		bool operator !=(const delegate<RET(PARAMS...)>& another) const { return !(*this == another); }
 
 		multicast_delegate& operator +=(const multicast_delegate& another) {
-			for (auto& item : another.invocationList) // clone, not copy; flattens hierarchy:
-				this->invocationList.push_back(new typename delegate_base<RET(PARAMS...)>::InvocationElement(item->object, item->stub));
+			// Only what another holds now, even if this is another
+			const size_t anotherCount = another.count;
+			for (size_t index = 0; index < anotherCount; ++index)
+				if (another.elements[index].stub != nullptr) append(another.elements[index]);
 			return *this;
 		} //operator +=
 
@@ -83,24 +110,54 @@ namespace Gordian {
 
 		multicast_delegate& operator +=(const delegate<RET(PARAMS...)>& another) {
 			if (another.isNull()) return *this;
-			this->invocationList.push_back(new typename delegate_base<RET(PARAMS...)>::InvocationElement(another.invocation.object, another.invocation.stub));
+			append(another.invocation);
 			return *this;
 		} //operator +=
 
+		// Removes the first subscriber matching another, if there is one
+		multicast_delegate& operator -=(const delegate<RET(PARAMS...)>& another) {
+			if (another.isNull()) return *this;
+			for (size_t index = 0; index < count; ++index) {
+				if (elements[index] == another.invocation) {
+					removeAt(index);
+					break;
+				} //if
+			} //loop
+			return *this;
+		} //operator -=
+
+		// Removes every subscriber
+		void clear() {
+			for (size_t index = 0; index < count; ++index)
+				elements[index] = element_type();
+			liveCount = 0;
+			compact();
+		} //clear
+
 		// will work even if RET is void, return values are ignored:
 		// (for handling return values, see operator(..., handler))
 		void operator()(PARAMS... arg) const {
-			for (auto& item : invocationList)
-				(*(item->stub))(item->object, arg...);
+			const broadcast_scope scope(broadcastDepth);
+			// Subscribers added while broadcasting land past this, and the array may move, so index it afresh each time
+			const size_t numToInvoke = count;
+			for (size_t index = 0; index < numToInvoke; ++index) {
+				const element_type item = elements[index];
+				if (item.stub != nullptr)
+					(*(item.stub))(item.object, arg...);
+			} //loop
 		} //operator()
 
 		template<typename HANDLER>
 		void operator()(PARAMS... arg, HANDLER handler) const {
-			size_t index = 0;
-			for (auto& item : invocationList) {
-				RET value = (*(item->stub))(item->object, arg...);
-				handler(index, &value);
-				++index;
+			const broadcast_scope scope(broadcastDepth);
+			const size_t numToInvoke = count;
+			size_t handlerIndex = 0;
+			for (size_t index = 0; index < numToInvoke; ++index) {
+				const element_type item = elements[index];
+				if (item.stub == nullptr) continue;
+				RET value = (*(item.stub))(item.object, arg...);
+				handler(handlerIndex, &value);
+				++handlerIndex;
 			} //loop
 		} //operator()
 
@@ -113,9 +170,54 @@ namespace Gordian {
 
 	private:
 
-		std::list<typename delegate_base<RET(PARAMS...)>::InvocationElement *> invocationList;
+		// Counts nested broadcasts for as long as it lives
+		struct broadcast_scope {
+			explicit broadcast_scope(size_t& depth) : depthRef(depth) { ++depthRef; }
+			~broadcast_scope() { --depthRef; }
+			size_t& depthRef;
+		}; //broadcast_scope
+
+		void append(const element_type& item) {
+			compact();
+			if (count == capacity) {
+				const size_t newCapacity = capacity * 2;
+				element_type* newElements = new element_type[newCapacity];
+				for (size_t index = 0; index < count; ++index)
+					newElements[index] = elements[index];
+				if (elements != inlineElements) delete[] elements;
+				elements = newElements;
+				capacity = newCapacity;
+			} //if
+			elements[count++] = item;
+			++liveCount;
+		} //append
+
+		// Removed subscribers stay in place while broadcasting, so indices hold until it ends
+		void removeAt(size_t index) {
+			elements[index] = element_type();
+			--liveCount;
+			compact();
+		} //removeAt
+
+		// Drops removed subscribers, unless a broadcast is walking the array
+		void compact() {
+			if (broadcastDepth > 0 || liveCount == count) return;
+			size_t liveIndex = 0;
+			for (size_t index = 0; index < count; ++index)
+				if (elements[index].stub != nullptr) elements[liveIndex++] = elements[index];
+			count = liveIndex;
+		} //compact
+
+		element_type inlineElements[inlineCapacity];
+		element_type* elements = inlineElements;
+		// Slots in use, including removed subscribers not yet compacted away
+		size_t count = 0;
+		// Subscribers that have not been removed
+		size_t liveCount = 0;
+		size_t capacity = inlineCapacity;
+		// Broadcasts in progress, counting ones started by subscribers
+		mutable size_t broadcastDepth = 0;
 
 	}; //class multicast_delegate
 
 } /* namespace SA */
-
@@ -0,0 +1,136 @@
+// Gordian by Daniel Luna (2019)
+
+#include "GordianEngine/FileIO/Public/MappedFile.h"
+
+#include <cerrno>
+
+#include "GordianEngine/Debug/Public/Logging.h"
+
+#ifdef WINDOWS
+	#include <Windows.h>
+#else
+	#include <fcntl.h>
+	#include <sys/mman.h>
+	#include <sys/stat.h>
+	#include <unistd.h>
+#endif	// WINDOWS
+
+using namespace Gordian;
+
+FMappedFile::FMappedFile()
+	: _Data(nullptr)
+	, _Size(0)
+	, _bIsOpen(false)
+{
+}
+
+FMappedFile::~FMappedFile()
+{
+	Close();
+}
+
+bool FMappedFile::Open(const std::string& FilePath)
+{
+	Close();
+
+#ifdef WINDOWS
+	HANDLE FileHandle = CreateFileA(FilePath.c_str(),
+									GENERIC_READ,
+									FILE_SHARE_READ,
+									nullptr,
+									OPEN_EXISTING,
+									FILE_ATTRIBUTE_NORMAL,
+									nullptr);
+	if (FileHandle == INVALID_HANDLE_VALUE)
+	{
+		GE_LOG(LogFileIO, Warning, "Could not open %s to map it! Error code: %lu!", FilePath.c_str(), GetLastError());
+		return false;
+	}
+
+	LARGE_INTEGER FileSize;
+	if (!GetFileSizeEx(FileHandle, &FileSize))
+	{
+		GE_LOG(LogFileIO, Warning, "Could not get the size of %s! Error code: %lu!", FilePath.c_str(), GetLastError());
+		CloseHandle(FileHandle);
+		return false;
+	}
+
+	// Empty files can't be mapped, but there is nothing to read from them anyway
+	if (FileSize.QuadPart > 0)
+	{
+		HANDLE MappingHandle = CreateFileMappingA(FileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+		if (MappingHandle == nullptr)
+		{
+			GE_LOG(LogFileIO, Warning, "Could not map %s! Error code: %lu!", FilePath.c_str(), GetLastError());
+			CloseHandle(FileHandle);
+			return false;
+		}
+
+		// The view keeps the mapping and file alive, so neither handle is needed past this
+		_Data = static_cast<const char*>(MapViewOfFile(MappingHandle, FILE_MAP_READ, 0, 0, 0));
+		CloseHandle(MappingHandle);
+
+		if (_Data == nullptr)
+		{
+			GE_LOG(LogFileIO, Warning, "Could not map a view of %s! Error code: %lu!", FilePath.c_str(), GetLastError());
+			CloseHandle(FileHandle);
+			return false;
+		}
+	}
+
+	CloseHandle(FileHandle);
+	_Size = static_cast<size_t>(FileSize.QuadPart);
+#else
+	const int FileDescriptor = open(FilePath.c_str(), O_RDONLY);
+	if (FileDescriptor < 0)
+	{
+		GE_LOG(LogFileIO, Warning, "Could not open %s to map it! Error code: %d!", FilePath.c_str(), errno);
+		return false;
+	}
+
+	struct stat FileStats;
+	if (fstat(FileDescriptor, &FileStats) != 0)
+	{
+		GE_LOG(LogFileIO, Warning, "Could not get the size of %s! Error code: %d!", FilePath.c_str(), errno);
+		close(FileDescriptor);
+		return false;
+	}
+
+	// Empty files can't be mapped, but there is nothing to read from them anyway
+	if (FileStats.st_size > 0)
+	{
+		void* MappedData = mmap(nullptr, static_cast<size_t>(FileStats.st_size), PROT_READ, MAP_PRIVATE, FileDescriptor, 0);
+		if (MappedData == MAP_FAILED)
+		{
+			GE_LOG(LogFileIO, Warning, "Could not map %s! Error code: %d!", FilePath.c_str(), errno);
+			close(FileDescriptor);
+			return false;
+		}
+
+		_Data = static_cast<const char*>(MappedData);
+	}
+
+	// The mapping keeps the file alive on its own
+	close(FileDescriptor);
+	_Size = static_cast<size_t>(FileStats.st_size);
+#endif	// WINDOWS
+
+	_bIsOpen = true;
+	return true;
+}
+
+void FMappedFile::Close()
+{
+	if (_Data != nullptr)
+	{
+#ifdef WINDOWS
+		UnmapViewOfFile(_Data);
+#else
+		munmap(const_cast<char*>(_Data), _Size);
+#endif	// WINDOWS
+	}
+
+	_Data = nullptr;
+	_Size = 0;
+	_bIsOpen = false;
+}
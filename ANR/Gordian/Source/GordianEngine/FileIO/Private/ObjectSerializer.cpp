@@ -0,0 +1,1327 @@
+// Gordian by Daniel Luna (2019)
+
+#include "GordianEngine/FileIO/Public/ObjectSerializer.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <limits>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+
+#include "SFML/Config.hpp"
+
+#include "GordianEngine/Core/Public/Object.h"
+#include "GordianEngine/Debug/Public/Asserts.h"
+#include "GordianEngine/Debug/Public/Logging.h"
+#include "GordianEngine/FileIO/Public/MappedFile.h"
+#include "GordianEngine/GlobalLibraries/Public/GlobalObjectLibrary.h"
+#include "GordianEngine/Reflection/Public/Type.h"
+#include "GordianEngine/Reflection/Public/Type_Struct.h"
+
+using namespace Gordian;
+
+DECLARE_LOG_CATEGORY_STATIC(LogObjectSerializer, All, Verbose)
+
+// Saves are laid out as:
+//	u32 magic, u16 version
+//	u32 type count, then each type: its name, u16 block member count, then each block
+//		member's name and kind, then u16 member count, then each member's name and value description
+//	u32 object count, then each object: u32 index of its type and u32 index of its owner.
+//		The root always comes first.
+//	Each object's member values, in the order its type lists them
+//
+// Bools, ints, floats and doubles are block members. Their values are copied straight out of each struct
+//	into a single block, in the order they sit in memory, and come before any other member
+//	values. When a class's layout hasn't changed, loading copies the block back in a single
+//	memcpy straight from the file.
+//
+// Other values are described by a u8 EValueKind. Vectors follow this with a description
+//	of their items, and structs with a u32 type index. All values are little-endian, and
+//	names are a u16 length followed by that many chars.
+//
+// Members of any other type can't be saved, and fail the whole save rather than being
+//	quietly left out of it.
+namespace
+{
+	// Spells GOBJ when read as bytes
+	const sf::Uint32 k_SaveMagic = 0x4A424F47;
+	const sf::Uint16 k_SaveVersion = 2;
+
+	// Object references are an index into the saved objects plus one, or one of these
+	const sf::Uint32 k_NullObjectReference = 0;
+	const sf::Uint32 k_ExternalObjectReference = 0xFFFFFFFF;
+
+	enum class EValueKind : sf::Uint8
+	{
+		Unsupported = 0,
+		// u8
+		Bool,
+		// i32
+		Int,
+		// u32 length followed by that many chars
+		String,
+		// u32 item count, then each item. Block kinds are copied as one block.
+		Vector,
+		// Each member value of the struct's type
+		Struct,
+		// u32 object reference
+		ObjectPointer,
+		// Name of the class, empty for nullptr
+		TypePointer,
+		// IEEE 754 single precision
+		Float,
+		// IEEE 754 double precision
+		Double,
+	};
+
+	EValueKind GetValueKind(const OType* Type)
+	{
+		if (Type == FTypeResolver<bool>::Get())
+		{
+			return EValueKind::Bool;
+		}
+		if (Type == FTypeResolver<int>::Get())
+		{
+			return EValueKind::Int;
+		}
+		if (Type == FTypeResolver<float>::Get())
+		{
+			return EValueKind::Float;
+		}
+		if (Type == FTypeResolver<double>::Get())
+		{
+			return EValueKind::Double;
+		}
+		if (Type == FTypeResolver<std::string>::Get())
+		{
+			return EValueKind::String;
+		}
+		if (Type->IsStruct())
+		{
+			return EValueKind::Struct;
+		}
+		if (const OType_StdVector* VectorType = dynamic_cast<const OType_StdVector*>(Type))
+		{
+			const bool bCanSaveItems = GetValueKind(VectorType->GetItemType()) != EValueKind::Unsupported;
+			return bCanSaveItems ? EValueKind::Vector : EValueKind::Unsupported;
+		}
+		const OType_Pointer* PointerType = dynamic_cast<const OType_Pointer*>(Type);
+		if (PointerType != nullptr && PointerType->GetItemType()->IsStruct())
+		{
+			// Pointed to classes may not have been used yet, and don't know their parents until they are
+			const OType_Struct* PointedType = static_cast<const OType_Struct*>(PointerType->GetItemType());
+			PointedType->EnsureInitialization();
+
+			// Types are objects too, so they have to be checked first
+			if (PointedType->IsChildClassOf(OType::GetStaticType()))
+			{
+				return EValueKind::TypePointer;
+			}
+			if (PointedType->IsChildClassOf(OObject::GetStaticType()))
+			{
+				return EValueKind::ObjectPointer;
+			}
+		}
+
+		return EValueKind::Unsupported;
+	}
+
+	// Bools, ints, floats and doubles are copied as blocks of this many bytes each
+	size_t GetBlockItemSize(EValueKind Kind)
+	{
+		static_assert(sizeof(int) == sizeof(sf::Int32), "Saved ints are expected to be 32 bits!");
+		static_assert(std::numeric_limits<float>::is_iec559 && sizeof(float) == 4,
+					  "Saved floats are expected to be 32 bit IEEE 754!");
+		static_assert(std::numeric_limits<double>::is_iec559 && sizeof(double) == 8,
+					  "Saved doubles are expected to be 64 bit IEEE 754!");
+
+		switch (Kind)
+		{
+		case EValueKind::Bool:
+			return sizeof(bool);
+		case EValueKind::Int:
+			return sizeof(sf::Int32);
+		case EValueKind::Float:
+			return sizeof(float);
+		case EValueKind::Double:
+			return sizeof(double);
+		default:
+			return 0;
+		}
+	}
+
+	// A single memcpy between a struct and its block
+	struct FBlockCopy
+	{
+		size_t BlockOffset;
+		size_t StructOffset;
+		size_t Size;
+	};
+
+	// Adds a copy, merging it into the last one if both sides pick up right where it left off
+	void AddBlockCopy(std::vector<FBlockCopy>& BlockCopies, size_t BlockOffset, size_t StructOffset, size_t Size)
+	{
+		if (!BlockCopies.empty())
+		{
+			FBlockCopy& LastCopy = BlockCopies.back();
+			if (LastCopy.BlockOffset + LastCopy.Size == BlockOffset
+				&& LastCopy.StructOffset + LastCopy.Size == StructOffset)
+			{
+				LastCopy.Size += Size;
+				return;
+			}
+		}
+
+		BlockCopies.push_back({ BlockOffset, StructOffset, Size });
+	}
+
+	// Looks up a reflected class, making sure it knows its members and parents before it is used
+	const OType_Struct* FindClassByName(const std::string& TypeName)
+	{
+		const OType* Type = FGlobalObjectLibrary::FetchTypeByName(TypeName);
+		if (Type == nullptr || !Type->IsStruct())
+		{
+			return nullptr;
+		}
+
+		const OType_Struct* StructType = static_cast<const OType_Struct*>(Type);
+		StructType->EnsureInitialization();
+		return StructType;
+	}
+
+	// Pointer members are read as OObject*, the same way OType_Pointer dumps them
+	const OObject* ReadObjectPointer(const void* Data)
+	{
+		return *static_cast<const OObject* const*>(Data);
+	}
+
+
+	///////////////////////////////////////////////////////////////////////
+	// Saving
+	///////////////////////////////////////////////////////////////////////
+
+	class FSaveContext
+	{
+	public:
+
+		explicit FSaveContext(const OObject* Root)
+			: _bHasError(false)
+		{
+			AddObject(Root);
+		}
+
+		bool Save(std::vector<char>& OutData)
+		{
+			// Writing an object can find more objects, so the list grows as we go
+			for (size_t ObjectIndex = 0; ObjectIndex < _Objects.size() && !_bHasError; ++ObjectIndex)
+			{
+				const OObject* Object = _Objects[ObjectIndex];
+				WriteStruct(_ObjectData, _ObjectTypeIndices[ObjectIndex], Object);
+			}
+
+			// Same goes for describing types
+			std::vector<char> TypeData;
+			for (sf::Uint32 TypeIndex = 0; TypeIndex < _Types.size() && !_bHasError; ++TypeIndex)
+			{
+				WriteType(TypeData, TypeIndex);
+			}
+
+			if (_bHasError)
+			{
+				return false;
+			}
+
+			WriteValue(OutData, k_SaveMagic);
+			WriteValue(OutData, k_SaveVersion);
+			WriteValue(OutData, static_cast<sf::Uint32>(_Types.size()));
+			OutData.insert(OutData.end(), TypeData.begin(), TypeData.end());
+			WriteValue(OutData, static_cast<sf::Uint32>(_Objects.size()));
+			for (size_t ObjectIndex = 0; ObjectIndex < _Objects.size(); ++ObjectIndex)
+			{
+				WriteValue(OutData, _ObjectTypeIndices[ObjectIndex]);
+				WriteValue(OutData, ObjectIndex != 0 ? GetOwnerIndex(_Objects[ObjectIndex]) : sf::Uint32(0));
+			}
+			OutData.insert(OutData.end(), _ObjectData.begin(), _ObjectData.end());
+			return true;
+		}
+
+	private:
+
+		// Members of a type that can be saved, found once per type
+		struct FSavedMember
+		{
+			const FStructMember* Member;
+			EValueKind Kind;
+		};
+
+		struct FSavedType
+		{
+			const OType_Struct* Type;
+			// Sorted by offset, so neighbors in memory are neighbors in the block
+			std::vector<FSavedMember> BlockMembers;
+			std::vector<FBlockCopy> BlockCopies;
+			std::vector<FSavedMember> Members;
+		};
+
+		template <typename T>
+		static void WriteValue(std::vector<char>& OutData, const T& Value)
+		{
+			static_assert(std::is_trivially_copyable<T>::value, "Saved values must be trivially copyable!");
+			const char* ValueBytes = reinterpret_cast<const char*>(&Value);
+			OutData.insert(OutData.end(), ValueBytes, ValueBytes + sizeof(T));
+		}
+
+		static void WriteName(std::vector<char>& OutData, const std::string& Name)
+		{
+			checkMsgf(Name.size() <= 0xFFFF, "Name is too long to save!");
+			WriteValue(OutData, static_cast<sf::Uint16>(Name.size()));
+			OutData.insert(OutData.end(), Name.begin(), Name.end());
+		}
+
+		sf::Uint32 AddObject(const OObject* Object)
+		{
+			auto IndexIt = _ObjectIndices.find(Object);
+			if (IndexIt != _ObjectIndices.end())
+			{
+				return IndexIt->second;
+			}
+
+			const sf::Uint32 ObjectIndex = static_cast<sf::Uint32>(_Objects.size());
+			_Objects.push_back(Object);
+			_ObjectTypeIndices.push_back(AddType(Object->GetType()));
+			_ObjectIndices.emplace(Object, ObjectIndex);
+			return ObjectIndex;
+		}
+
+		sf::Uint32 AddType(const OType_Struct* Type)
+		{
+			auto IndexIt = _TypeIndices.find(Type);
+			if (IndexIt != _TypeIndices.end())
+			{
+				return IndexIt->second;
+			}
+
+			Type->EnsureInitialization();
+
+			FSavedType SavedType;
+			SavedType.Type = Type;
+			for (const FStructMember& Member : Type->GetMembers())
+			{
+				const EValueKind Kind = GetValueKind(Member.Type);
+				if (GetBlockItemSize(Kind) != 0)
+				{
+					SavedType.BlockMembers.push_back({ &Member, Kind });
+				}
+				else if (Kind != EValueKind::Unsupported)
+				{
+					SavedType.Members.push_back({ &Member, Kind });
+				}
+				else
+				{
+					GE_LOG(LogObjectSerializer, Error, "Can't save %s::%s, %s is not a type that can be saved!",
+						   Type->GetName().c_str(), Member.Name, Member.Type->GetFullName().c_str());
+					_bHasError = true;
+				}
+			}
+
+			std::stable_sort(SavedType.BlockMembers.begin(), SavedType.BlockMembers.end(),
+							 [](const FSavedMember& Lhs, const FSavedMember& Rhs)
+							 {
+								 return Lhs.Member->Offset < Rhs.Member->Offset;
+							 });
+
+			size_t BlockOffset = 0;
+			for (const FSavedMember& BlockMember : SavedType.BlockMembers)
+			{
+				const size_t Size = GetBlockItemSize(BlockMember.Kind);
+				AddBlockCopy(SavedType.BlockCopies, BlockOffset, BlockMember.Member->Offset, Size);
+				BlockOffset += Size;
+			}
+
+			const sf::Uint32 TypeIndex = static_cast<sf::Uint32>(_Types.size());
+			_Types.push_back(std::move(SavedType));
+			_TypeIndices.emplace(Type, TypeIndex);
+			return TypeIndex;
+		}
+
+		// Objects are only saved if the root owns them, anything else is left for the loader
+		bool IsOwnedByRoot(const OObject* Object) const
+		{
+			for (const OObject* Owner = Object->GetOwningObject(); Owner != nullptr; Owner = Owner->GetOwningObject())
+			{
+				// The root is the first object found, so this covers it too
+				if (_ObjectIndices.count(Owner) != 0)
+				{
+					return true;
+				}
+			}
+
+			return false;
+		}
+
+		// Objects owned by something we didn't save go to the nearest owner we did
+		sf::Uint32 GetOwnerIndex(const OObject* Object) const
+		{
+			for (const OObject* Owner = Object->GetOwningObject(); Owner != nullptr; Owner = Owner->GetOwningObject())
+			{
+				auto IndexIt = _ObjectIndices.find(Owner);
+				if (IndexIt != _ObjectIndices.end())
+				{
+					return IndexIt->second;
+				}
+			}
+
+			checkNoEntry();
+			return 0;
+		}
+
+		void WriteType(std::vector<char>& OutData, sf::Uint32 TypeIndex)
+		{
+			const FSavedType& SavedType = _Types[TypeIndex];
+			WriteName(OutData, SavedType.Type->GetName());
+
+			WriteValue(OutData, static_cast<sf::Uint16>(SavedType.BlockMembers.size()));
+			for (const FSavedMember& BlockMember : SavedType.BlockMembers)
+			{
+				WriteName(OutData, BlockMember.Member->Name);
+				WriteValue(OutData, BlockMember.Kind);
+			}
+
+			// Indexed, since describing a member can add types and move _Types around
+			WriteValue(OutData, static_cast<sf::Uint16>(SavedType.Members.size()));
+			for (size_t MemberIndex = 0; MemberIndex < _Types[TypeIndex].Members.size(); ++MemberIndex)
+			{
+				const FStructMember* Member = _Types[TypeIndex].Members[MemberIndex].Member;
+				WriteName(OutData, Member->Name);
+				WriteDescription(OutData, Member->Type);
+			}
+		}
+
+		void WriteDescription(std::vector<char>& OutData, const OType* Type)
+		{
+			const EValueKind Kind = GetValueKind(Type);
+			WriteValue(OutData, Kind);
+
+			if (Kind == EValueKind::Vector)
+			{
+				WriteDescription(OutData, static_cast<const OType_StdVector*>(Type)->GetItemType());
+			}
+			else if (Kind == EValueKind::Struct)
+			{
+				WriteValue(OutData, AddType(static_cast<const OType_Struct*>(Type)));
+			}
+		}
+
+		void WriteStruct(std::vector<char>& OutData, sf::Uint32 TypeIndex, const void* Data)
+		{
+			for (const FBlockCopy& BlockCopy : _Types[TypeIndex].BlockCopies)
+			{
+				const char* BlockData = static_cast<const char*>(Data) + BlockCopy.StructOffset;
+				OutData.insert(OutData.end(), BlockData, BlockData + BlockCopy.Size);
+			}
+
+			// Indexed, since writing a member can add types and move _Types around
+			for (size_t MemberIndex = 0; MemberIndex < _Types[TypeIndex].Members.size(); ++MemberIndex)
+			{
+				const FSavedMember SavedMember = _Types[TypeIndex].Members[MemberIndex];
+				const char* MemberData = static_cast<const char*>(Data) + SavedMember.Member->Offset;
+				WriteMember(OutData, SavedMember.Kind, SavedMember.Member->Type, MemberData);
+			}
+		}
+
+		void WriteMember(std::vector<char>& OutData, EValueKind Kind, const OType* Type, const void* Data)
+		{
+			switch (Kind)
+			{
+			case EValueKind::Bool:
+				WriteValue(OutData, static_cast<sf::Uint8>(*static_cast<const bool*>(Data) ? 1 : 0));
+				break;
+
+			case EValueKind::Int:
+				WriteValue(OutData, static_cast<sf::Int32>(*static_cast<const int*>(Data)));
+				break;
+
+			case EValueKind::Float:
+				WriteValue(OutData, *static_cast<const float*>(Data));
+				break;
+
+			case EValueKind::Double:
+				WriteValue(OutData, *static_cast<const double*>(Data));
+				break;
+
+			case EValueKind::String:
+			{
+				const std::string& String = *static_cast<const std::string*>(Data);
+				WriteValue(OutData, static_cast<sf::Uint32>(String.size()));
+				OutData.insert(OutData.end(), String.begin(), String.end());
+				break;
+			}
+
+			case EValueKind::Vector:
+			{
+				const OType_StdVector* VectorType = static_cast<const OType_StdVector*>(Type);
+				const OType* ItemType = VectorType->GetItemType();
+				const EValueKind ItemKind = GetValueKind(ItemType);
+
+				const size_t NumItems = VectorType->GetNumItems(Data);
+				WriteValue(OutData, static_cast<sf::Uint32>(NumItems));
+
+				const size_t BlockItemSize = GetBlockItemSize(ItemKind);
+				if (BlockItemSize != 0)
+				{
+					if (NumItems > 0)
+					{
+						const char* ItemData = static_cast<const char*>(VectorType->GetItemData(Data, 0));
+						OutData.insert(OutData.end(), ItemData, ItemData + NumItems * BlockItemSize);
+					}
+				}
+				else
+				{
+					for (size_t ItemIndex = 0; ItemIndex < NumItems; ++ItemIndex)
+					{
+						WriteMember(OutData, ItemKind, ItemType, VectorType->GetItemData(Data, ItemIndex));
+					}
+				}
+				break;
+			}
+
+			case EValueKind::Struct:
+				WriteStruct(OutData, AddType(static_cast<const OType_Struct*>(Type)), Data);
+				break;
+
+			case EValueKind::ObjectPointer:
+			{
+				const OObject* Target = ReadObjectPointer(Data);
+				if (Target == nullptr)
+				{
+					WriteValue(OutData, k_NullObjectReference);
+				}
+				else if (_ObjectIndices.count(Target) != 0 || IsOwnedByRoot(Target))
+				{
+					WriteValue(OutData, AddObject(Target) + 1);
+				}
+				else
+				{
+					WriteValue(OutData, k_ExternalObjectReference);
+				}
+				break;
+			}
+
+			case EValueKind::TypePointer:
+			{
+				// Only classes can be found by name again, anything else loads as nullptr
+				const OType* TargetType = *static_cast<const OType* const*>(Data);
+				const bool bCanFindAgain = TargetType != nullptr && TargetType->IsStruct();
+				WriteName(OutData, bCanFindAgain ? TargetType->GetName() : std::string());
+				break;
+			}
+
+			default:
+				checkNoEntry();
+				break;
+			}
+		}
+
+		std::vector<const OObject*> _Objects;
+		std::vector<sf::Uint32> _ObjectTypeIndices;
+		std::unordered_map<const OObject*, sf::Uint32> _ObjectIndices;
+
+		std::vector<FSavedType> _Types;
+		std::unordered_map<const OType_Struct*, sf::Uint32> _TypeIndices;
+
+		// Member values of every object, written out after the type list
+		std::vector<char> _ObjectData;
+
+		// Set once a member is found that can't be saved
+		bool _bHasError;
+	};
+
+
+	///////////////////////////////////////////////////////////////////////
+	// Loading
+	///////////////////////////////////////////////////////////////////////
+
+	class FLoadContext
+	{
+	public:
+
+		FLoadContext(const char* Data, size_t DataSize)
+			: _Cursor(Data)
+			, _End(Data + DataSize)
+			, _bHasError(false)
+		{
+		}
+
+		bool Load(OObject* Root, std::vector<OObject*>* OutLoadedObjects)
+		{
+			if (!ReadHeader() || !ReadTypes() || !ReadObjectTypes())
+			{
+				return false;
+			}
+
+			const OType_Struct* SavedRootType = _Types[_ObjectTypeIndices[0]].CurrentType;
+			if (SavedRootType != Root->GetType())
+			{
+				GE_LOG(LogObjectSerializer, Warning, "Can't load a save of %s into %s!",
+					   _Types[_ObjectTypeIndices[0]].Name.c_str(), Root->GetType()->GetName().c_str());
+				return false;
+			}
+
+			// Read through once without writing anything, so bad data is found before any
+			//	objects are made or any members are changed
+			const char* ObjectDataBegin = _Cursor;
+			for (sf::Uint32 TypeIndex : _ObjectTypeIndices)
+			{
+				ReadStruct(TypeIndex, nullptr);
+			}
+
+			if (_bHasError || _Cursor != _End)
+			{
+				GE_LOG(LogObjectSerializer, Warning, "Object data is malformed!");
+				return false;
+			}
+
+			_Objects.assign(_ObjectTypeIndices.size(), nullptr);
+			_Objects[0] = Root;
+			std::vector<bool> WasConstructed(_Objects.size(), false);
+			WasConstructed[0] = true;
+			for (size_t ObjectIndex = 1; ObjectIndex < _Objects.size(); ++ObjectIndex)
+			{
+				ConstructObject(ObjectIndex, WasConstructed);
+			}
+
+			// The root is loaded into rather than made again, so it keeps its own name
+			const std::string RootName = Root->GetName();
+
+			_Cursor = ObjectDataBegin;
+			for (size_t ObjectIndex = 0; ObjectIndex < _Objects.size(); ++ObjectIndex)
+			{
+				ReadStruct(_ObjectTypeIndices[ObjectIndex], _Objects[ObjectIndex]);
+			}
+			check(!_bHasError && _Cursor == _End);
+
+			Root->SetName(RootName);
+
+			// Everything is in place, so objects can now safely look at each other
+			for (size_t ObjectIndex = 1; ObjectIndex < _Objects.size(); ++ObjectIndex)
+			{
+				if (_Objects[ObjectIndex] != nullptr)
+				{
+					_Objects[ObjectIndex]->Initialize();
+					if (OutLoadedObjects != nullptr)
+					{
+						OutLoadedObjects->push_back(_Objects[ObjectIndex]);
+					}
+				}
+			}
+
+			return true;
+		}
+
+	private:
+
+		struct FSavedDescription
+		{
+			EValueKind Kind;
+			// Index of the item description for vectors, or the saved type for structs
+			sf::Uint32 Index;
+		};
+
+		struct FSavedMember
+		{
+			std::string Name;
+			sf::Uint32 DescriptionIndex;
+			// Member the value loads into, or nullptr if it can't be loaded anymore
+			const FStructMember* CurrentMember;
+		};
+
+		struct FSavedType
+		{
+			std::string Name;
+			std::vector<FSavedMember> BlockMembers;
+			std::vector<FSavedMember> Members;
+			// Built once members are bound. Only covers members that still exist.
+			std::vector<FBlockCopy> BlockCopies;
+			size_t BlockSize;
+			// Where each saved bool sits in the block, so bad values can be caught before copying
+			std::vector<size_t> BoolBlockOffsets;
+			// Class with the same name, if there still is one
+			const OType_Struct* CurrentType;
+		};
+
+		// Reads raw bytes, flagging an error instead of reading past the end
+		template <typename T>
+		bool ReadValue(T& OutValue)
+		{
+			static_assert(std::is_trivially_copyable<T>::value, "Saved values must be trivially copyable!");
+			if (_bHasError || static_cast<size_t>(_End - _Cursor) < sizeof(T))
+			{
+				_bHasError = true;
+				return false;
+			}
+
+			std::memcpy(&OutValue, _Cursor, sizeof(T));
+			_Cursor += sizeof(T);
+			return true;
+		}
+
+		// Gets the next Size bytes, or nullptr if there aren't that many left
+		const char* ReadBytes(size_t Size)
+		{
+			if (_bHasError || static_cast<size_t>(_End - _Cursor) < Size)
+			{
+				_bHasError = true;
+				return nullptr;
+			}
+
+			const char* Bytes = _Cursor;
+			_Cursor += Size;
+			return Bytes;
+		}
+
+		bool ReadName(std::string& OutName)
+		{
+			sf::Uint16 Length = 0;
+			if (!ReadValue(Length))
+			{
+				return false;
+			}
+
+			const char* Chars = ReadBytes(Length);
+			if (Chars == nullptr)
+			{
+				return false;
+			}
+
+			OutName.assign(Chars, Length);
+			return true;
+		}
+
+		bool ReadHeader()
+		{
+			sf::Uint32 Magic = 0;
+			sf::Uint16 Version = 0;
+			if (!ReadValue(Magic) || Magic != k_SaveMagic || !ReadValue(Version))
+			{
+				GE_LOG(LogObjectSerializer, Warning, "Data is not a saved object!");
+				return false;
+			}
+
+			if (Version != k_SaveVersion)
+			{
+				GE_LOG(LogObjectSerializer, Warning, "Can't load save version %u, expected %u!",
+					   Version, k_SaveVersion);
+				return false;
+			}
+
+			return true;
+		}
+
+		bool ReadTypes()
+		{
+			sf::Uint32 NumTypes = 0;
+			ReadValue(NumTypes);
+
+			// Each type takes at least a few bytes, so a bad count can't make us allocate much
+			if (NumTypes > static_cast<size_t>(_End - _Cursor))
+			{
+				_bHasError = true;
+			}
+
+			for (sf::Uint32 TypeIndex = 0; TypeIndex < NumTypes && !_bHasError; ++TypeIndex)
+			{
+				FSavedType SavedType;
+				SavedType.BlockSize = 0;
+				sf::Uint16 NumBlockMembers = 0;
+				ReadName(SavedType.Name);
+				ReadValue(NumBlockMembers);
+
+				for (sf::Uint16 MemberIndex = 0; MemberIndex < NumBlockMembers && !_bHasError; ++MemberIndex)
+				{
+					FSavedMember SavedMember;
+					ReadName(SavedMember.Name);
+					SavedMember.DescriptionIndex = ReadDescription();
+					SavedMember.CurrentMember = nullptr;
+
+					const EValueKind Kind = _Descriptions[SavedMember.DescriptionIndex].Kind;
+					if (Kind == EValueKind::Bool)
+					{
+						SavedType.BoolBlockOffsets.push_back(SavedType.BlockSize);
+					}
+					else if (GetBlockItemSize(Kind) == 0)
+					{
+						_bHasError = true;
+					}
+
+					SavedType.BlockSize += GetBlockItemSize(Kind);
+					SavedType.BlockMembers.push_back(std::move(SavedMember));
+				}
+
+				sf::Uint16 NumMembers = 0;
+				ReadValue(NumMembers);
+
+				for (sf::Uint16 MemberIndex = 0; MemberIndex < NumMembers && !_bHasError; ++MemberIndex)
+				{
+					FSavedMember SavedMember;
+					ReadName(SavedMember.Name);
+					SavedMember.DescriptionIndex = ReadDescription();
+					SavedMember.CurrentMember = nullptr;
+					SavedType.Members.push_back(std::move(SavedMember));
+				}
+
+				SavedType.CurrentType = FindClassByName(SavedType.Name);
+				_Types.push_back(std::move(SavedType));
+			}
+
+			if (_bHasError)
+			{
+				GE_LOG(LogObjectSerializer, Warning, "Saved types are malformed!");
+				return false;
+			}
+
+			// Struct descriptions point at types, so they can only be checked once all are read
+			for (const FSavedDescription& Description : _Descriptions)
+			{
+				if (Description.Kind == EValueKind::Struct && Description.Index >= _Types.size())
+				{
+					GE_LOG(LogObjectSerializer, Warning, "Saved types are malformed!");
+					return false;
+				}
+			}
+
+			for (FSavedType& SavedType : _Types)
+			{
+				BindMembers(SavedType);
+			}
+
+			return true;
+		}
+
+		// Reads a value description, returning its index in _Descriptions
+		sf::Uint32 ReadDescription()
+		{
+			FSavedDescription Description = { EValueKind::Unsupported, 0 };
+			ReadValue(Description.Kind);
+
+			switch (Description.Kind)
+			{
+			case EValueKind::Bool:
+			case EValueKind::Int:
+			case EValueKind::Float:
+			case EValueKind::Double:
+			case EValueKind::String:
+			case EValueKind::ObjectPointer:
+			case EValueKind::TypePointer:
+				break;
+
+			case EValueKind::Vector:
+				// Vectors of vectors nest, so cap how deep a bad save can make us go
+				if (++_DescriptionDepth > k_MaxDescriptionDepth)
+				{
+					_bHasError = true;
+					break;
+				}
+				Description.Index = ReadDescription();
+				--_DescriptionDepth;
+				break;
+
+			case EValueKind::Struct:
+				ReadValue(Description.Index);
+				break;
+
+			default:
+				_bHasError = true;
+				break;
+			}
+
+			_Descriptions.push_back(Description);
+			return static_cast<sf::Uint32>(_Descriptions.size() - 1);
+		}
+
+		// Matches saved members to current members of the same name, in the order they were declared
+		void BindMembers(FSavedType& SavedType)
+		{
+			if (SavedType.CurrentType == nullptr)
+			{
+				GE_LOG(LogObjectSerializer, Warning, "Class %s no longer exists, its values will be skipped.",
+					   SavedType.Name.c_str());
+				return;
+			}
+
+			std::unordered_map<std::string, size_t> NumMatchesByName;
+			for (FSavedMember& BlockMember : SavedType.BlockMembers)
+			{
+				BindMember(SavedType, BlockMember, NumMatchesByName);
+			}
+			for (FSavedMember& SavedMember : SavedType.Members)
+			{
+				BindMember(SavedType, SavedMember, NumMatchesByName);
+			}
+
+			// If the layout hasn't changed, the block goes back in with a single copy
+			size_t BlockOffset = 0;
+			for (const FSavedMember& BlockMember : SavedType.BlockMembers)
+			{
+				const size_t Size = GetBlockItemSize(_Descriptions[BlockMember.DescriptionIndex].Kind);
+				if (BlockMember.CurrentMember != nullptr)
+				{
+					AddBlockCopy(SavedType.BlockCopies, BlockOffset, BlockMember.CurrentMember->Offset, Size);
+				}
+				BlockOffset += Size;
+			}
+		}
+
+		void BindMember(const FSavedType& SavedType,
+						FSavedMember& SavedMember,
+						std::unordered_map<std::string, size_t>& NumMatchesByName)
+		{
+			// Children can shadow a parent's member, so the nth saved one goes to the nth current one
+			size_t MatchesToSkip = NumMatchesByName[SavedMember.Name]++;
+			for (const FStructMember& CurrentMember : SavedType.CurrentType->GetMembers())
+			{
+				if (SavedMember.Name == CurrentMember.Name && MatchesToSkip-- == 0)
+				{
+					SavedMember.CurrentMember = &CurrentMember;
+					break;
+				}
+			}
+
+			if (SavedMember.CurrentMember == nullptr)
+			{
+				GE_LOG(LogObjectSerializer, Verbose, "%s::%s no longer exists, skipping it.",
+					   SavedType.Name.c_str(), SavedMember.Name.c_str());
+			}
+			else if (!IsCompatible(SavedMember.DescriptionIndex, SavedMember.CurrentMember->Type))
+			{
+				GE_LOG(LogObjectSerializer, Warning, "%s::%s changed type, skipping it.",
+					   SavedType.Name.c_str(), SavedMember.Name.c_str());
+				SavedMember.CurrentMember = nullptr;
+			}
+		}
+
+		bool IsCompatible(sf::Uint32 DescriptionIndex, const OType* CurrentType) const
+		{
+			const FSavedDescription& Description = _Descriptions[DescriptionIndex];
+			if (Description.Kind != GetValueKind(CurrentType))
+			{
+				return false;
+			}
+
+			switch (Description.Kind)
+			{
+			case EValueKind::Vector:
+				return IsCompatible(Description.Index, static_cast<const OType_StdVector*>(CurrentType)->GetItemType());
+
+			case EValueKind::Struct:
+				// Members are placed by the saved type's layout, so it has to be the same class
+				return _Types[Description.Index].CurrentType == CurrentType;
+
+			default:
+				return true;
+			}
+		}
+
+		// Constructs an object after its owners, since they have to be passed in
+		void ConstructObject(size_t ObjectIndex, std::vector<bool>& WasConstructed)
+		{
+			if (WasConstructed[ObjectIndex])
+			{
+				return;
+			}
+
+			const sf::Uint32 OwnerIndex = _ObjectOwnerIndices[ObjectIndex];
+			ConstructObject(OwnerIndex, WasConstructed);
+			WasConstructed[ObjectIndex] = true;
+
+			// Anything that lost its owner goes to the root, so it still gets cleaned up
+			OObject* Owner = _Objects[OwnerIndex] != nullptr ? _Objects[OwnerIndex] : _Objects[0];
+			const FSavedType& SavedType = _Types[_ObjectTypeIndices[ObjectIndex]];
+			if (SavedType.CurrentType != nullptr)
+			{
+				_Objects[ObjectIndex] = FGlobalObjectLibrary::ConstructObjectOfType(Owner, SavedType.CurrentType);
+			}
+
+			if (_Objects[ObjectIndex] == nullptr)
+			{
+				GE_LOG(LogObjectSerializer, Warning, "Could not create an object of class %s, "
+					   "references to it will be nullptr.", SavedType.Name.c_str());
+			}
+		}
+
+		bool ReadObjectTypes()
+		{
+			sf::Uint32 NumObjects = 0;
+			ReadValue(NumObjects);
+
+			if (_bHasError || NumObjects == 0 || NumObjects > static_cast<size_t>(_End - _Cursor) / (2 * sizeof(sf::Uint32)))
+			{
+				GE_LOG(LogObjectSerializer, Warning, "Saved objects are malformed!");
+				return false;
+			}
+
+			_ObjectTypeIndices.resize(NumObjects);
+			_ObjectOwnerIndices.resize(NumObjects);
+			for (sf::Uint32 ObjectIndex = 0; ObjectIndex < NumObjects; ++ObjectIndex)
+			{
+				ReadValue(_ObjectTypeIndices[ObjectIndex]);
+				ReadValue(_ObjectOwnerIndices[ObjectIndex]);
+				if (_ObjectTypeIndices[ObjectIndex] >= _Types.size() || _ObjectOwnerIndices[ObjectIndex] >= NumObjects)
+				{
+					GE_LOG(LogObjectSerializer, Warning, "Saved objects are malformed!");
+					return false;
+				}
+			}
+
+			// Every owner has to lead back to the root, or we could never construct them
+			_ObjectOwnerIndices[0] = 0;
+			std::vector<bool> LeadsToRoot(NumObjects, false);
+			LeadsToRoot[0] = true;
+			for (sf::Uint32 ObjectIndex = 1; ObjectIndex < NumObjects; ++ObjectIndex)
+			{
+				std::vector<sf::Uint32> Chain;
+				sf::Uint32 ChainIndex = ObjectIndex;
+				while (!LeadsToRoot[ChainIndex] && Chain.size() < NumObjects)
+				{
+					Chain.push_back(ChainIndex);
+					ChainIndex = _ObjectOwnerIndices[ChainIndex];
+				}
+
+				if (!LeadsToRoot[ChainIndex])
+				{
+					GE_LOG(LogObjectSerializer, Warning, "Saved objects are malformed!");
+					return false;
+				}
+
+				for (sf::Uint32 ChainObjectIndex : Chain)
+				{
+					LeadsToRoot[ChainObjectIndex] = true;
+				}
+			}
+
+			return true;
+		}
+
+		// Reads the members of a saved type into Data. Skips them if Data is nullptr.
+		void ReadStruct(sf::Uint32 TypeIndex, void* Data)
+		{
+			// Bad saves can nest structs in themselves
+			if (++_StructDepth > k_MaxStructDepth)
+			{
+				_bHasError = true;
+			}
+
+			const FSavedType& SavedType = _Types[TypeIndex];
+			const char* BlockData = ReadBytes(SavedType.BlockSize);
+			if (BlockData != nullptr)
+			{
+				if (Data != nullptr)
+				{
+					for (const FBlockCopy& BlockCopy : SavedType.BlockCopies)
+					{
+						std::memcpy(static_cast<char*>(Data) + BlockCopy.StructOffset,
+									BlockData + BlockCopy.BlockOffset,
+									BlockCopy.Size);
+					}
+				}
+				else
+				{
+					// Only checked while skipping, since every object is skipped once before loading
+					for (size_t BoolBlockOffset : SavedType.BoolBlockOffsets)
+					{
+						if (static_cast<sf::Uint8>(BlockData[BoolBlockOffset]) > 1)
+						{
+							_bHasError = true;
+						}
+					}
+				}
+			}
+
+			for (const FSavedMember& SavedMember : SavedType.Members)
+			{
+				if (_bHasError)
+				{
+					break;
+				}
+
+				void* MemberData = nullptr;
+				const OType* MemberType = nullptr;
+				if (Data != nullptr && SavedMember.CurrentMember != nullptr)
+				{
+					MemberData = static_cast<char*>(Data) + SavedMember.CurrentMember->Offset;
+					MemberType = SavedMember.CurrentMember->Type;
+				}
+
+				ReadMember(SavedMember.DescriptionIndex, MemberType, MemberData);
+			}
+
+			--_StructDepth;
+		}
+
+		// Reads a value into Data, which has CurrentType. Skips it if Data is nullptr.
+		void ReadMember(sf::Uint32 DescriptionIndex, const OType* CurrentType, void* Data)
+		{
+			const FSavedDescription& Description = _Descriptions[DescriptionIndex];
+			switch (Description.Kind)
+			{
+			case EValueKind::Bool:
+			{
+				sf::Uint8 Value = 0;
+				if (ReadValue(Value) && Data != nullptr)
+				{
+					*static_cast<bool*>(Data) = Value != 0;
+				}
+				break;
+			}
+
+			case EValueKind::Int:
+			{
+				sf::Int32 Value = 0;
+				if (ReadValue(Value) && Data != nullptr)
+				{
+					*static_cast<int*>(Data) = Value;
+				}
+				break;
+			}
+
+			case EValueKind::Float:
+			{
+				float Value = 0.f;
+				if (ReadValue(Value) && Data != nullptr)
+				{
+					*static_cast<float*>(Data) = Value;
+				}
+				break;
+			}
+
+			case EValueKind::Double:
+			{
+				double Value = 0.0;
+				if (ReadValue(Value) && Data != nullptr)
+				{
+					*static_cast<double*>(Data) = Value;
+				}
+				break;
+			}
+
+			case EValueKind::String:
+			{
+				sf::Uint32 Length = 0;
+				ReadValue(Length);
+				const char* Chars = ReadBytes(Length);
+				if (Chars != nullptr && Data != nullptr)
+				{
+					static_cast<std::string*>(Data)->assign(Chars, Length);
+				}
+				break;
+			}
+
+			case EValueKind::Vector:
+				ReadVector(Description, static_cast<const OType_StdVector*>(CurrentType), Data);
+				break;
+
+			case EValueKind::Struct:
+				ReadStruct(Description.Index, Data);
+				break;
+
+			case EValueKind::ObjectPointer:
+			{
+				sf::Uint32 Reference = k_NullObjectReference;
+				ReadValue(Reference);
+				if (Reference != k_NullObjectReference && Reference != k_ExternalObjectReference
+					&& Reference > _ObjectTypeIndices.size())
+				{
+					_bHasError = true;
+				}
+				else if (Data != nullptr)
+				{
+					WriteObjectPointer(Reference, static_cast<const OType_Pointer*>(CurrentType), Data);
+				}
+				break;
+			}
+
+			case EValueKind::TypePointer:
+			{
+				std::string TypeName;
+				if (ReadName(TypeName) && Data != nullptr)
+				{
+					const OType_Struct* Type = !TypeName.empty() ? FindClassByName(TypeName) : nullptr;
+					const OType* PointedType = static_cast<const OType_Pointer*>(CurrentType)->GetItemType();
+					// Names only ever find classes, so the pointer has to be able to hold one
+					if (!OType_Struct::GetStaticType()->IsChildClassOf(static_cast<const OType_Struct*>(PointedType)))
+					{
+						Type = nullptr;
+					}
+					*static_cast<const OType**>(Data) = Type;
+				}
+				break;
+			}
+
+			default:
+				checkNoEntry();
+				break;
+			}
+		}
+
+		void ReadVector(const FSavedDescription& Description, const OType_StdVector* CurrentType, void* Data)
+		{
+			sf::Uint32 NumItems = 0;
+			ReadValue(NumItems);
+
+			const FSavedDescription& ItemDescription = _Descriptions[Description.Index];
+			const size_t BlockItemSize = GetBlockItemSize(ItemDescription.Kind);
+
+			// Every item takes at least a byte, so a bad count can't make us allocate much
+			if (_bHasError || NumItems > static_cast<size_t>(_End - _Cursor))
+			{
+				_bHasError = true;
+				return;
+			}
+
+			if (Data != nullptr)
+			{
+				CurrentType->ResizeItems(Data, NumItems);
+			}
+
+			if (BlockItemSize != 0)
+			{
+				const char* ItemData = ReadBytes(NumItems * BlockItemSize);
+				if (ItemData != nullptr && Data != nullptr && NumItems > 0)
+				{
+					if (ItemDescription.Kind == EValueKind::Bool)
+					{
+						// Copied one at a time, since any byte other than 0 or 1 isn't a valid bool
+						bool* Items = static_cast<bool*>(CurrentType->GetMutableItemData(Data, 0));
+						for (size_t ItemIndex = 0; ItemIndex < NumItems; ++ItemIndex)
+						{
+							Items[ItemIndex] = ItemData[ItemIndex] != 0;
+						}
+					}
+					else
+					{
+						std::memcpy(CurrentType->GetMutableItemData(Data, 0), ItemData, NumItems * BlockItemSize);
+					}
+				}
+				return;
+			}
+
+			const OType* ItemType = Data != nullptr ? CurrentType->GetItemType() : nullptr;
+			for (size_t ItemIndex = 0; ItemIndex < NumItems && !_bHasError; ++ItemIndex)
+			{
+				void* ItemData = Data != nullptr ? CurrentType->GetMutableItemData(Data, ItemIndex) : nullptr;
+				ReadMember(Description.Index, ItemType, ItemData);
+			}
+		}
+
+		void WriteObjectPointer(sf::Uint32 Reference, const OType_Pointer* PointerType, void* Data)
+		{
+			OObject*& Pointer = *static_cast<OObject**>(Data);
+			if (Reference == k_NullObjectReference)
+			{
+				Pointer = nullptr;
+				return;
+			}
+
+			// We never had the object, so the root keeps whatever it already points at.
+			//	Anything we just made has nothing to point at, and starts as it was constructed.
+			if (Reference == k_ExternalObjectReference)
+			{
+				return;
+			}
+
+			OObject* Target = _Objects[Reference - 1];
+			const OType_Struct* PointedType = static_cast<const OType_Struct*>(PointerType->GetItemType());
+			if (Target != nullptr && !Target->IsSubclassOf(PointedType))
+			{
+				GE_LOG(LogObjectSerializer, Warning, "Can't point a %s at %s, it is a %s.",
+					   PointerType->GetName().c_str(), Target->GetName().c_str(), Target->GetType()->GetName().c_str());
+				Target = nullptr;
+			}
+
+			Pointer = Target;
+		}
+
+		const size_t k_MaxDescriptionDepth = 64;
+		const size_t k_MaxStructDepth = 256;
+
+		const char* _Cursor;
+		const char* _End;
+		bool _bHasError;
+
+		size_t _DescriptionDepth = 0;
+		size_t _StructDepth = 0;
+
+		std::vector<FSavedDescription> _Descriptions;
+		std::vector<FSavedType> _Types;
+
+		std::vector<sf::Uint32> _ObjectTypeIndices;
+		std::vector<sf::Uint32> _ObjectOwnerIndices;
+		std::vector<OObject*> _Objects;
+	};
+}
+
+/*static*/ bool FObjectSerializer::Save(const OObject* Root, std::vector<char>& OutData)
+{
+	check(Root != nullptr);
+
+	FSaveContext SaveContext(Root);
+	return SaveContext.Save(OutData);
+}
+
+/*static*/ bool FObjectSerializer::Load(OObject* Root,
+										const char* Data,
+										size_t DataSize,
+										std::vector<OObject*>* OutLoadedObjects)
+{
+	check(Root != nullptr);
+
+	if (Data == nullptr)
+	{
+		return false;
+	}
+
+	FLoadContext LoadContext(Data, DataSize);
+	return LoadContext.Load(Root, OutLoadedObjects);
+}
+
+/*static*/ bool FObjectSerializer::SaveToFile(const OObject* Root, const std::string& FilePath)
+{
+	std::vector<char> SaveData;
+	if (!Save(Root, SaveData))
+	{
+		return false;
+	}
+
+	std::FILE* SaveFile = nullptr;
+	errno_t ErrorCode = fopen_s(&SaveFile, FilePath.c_str(), "wb");
+	if (ErrorCode != 0)
+	{
+		GE_LOG(LogFileIO, Warning, "Could not open %s to save to! Error code: %d!", FilePath.c_str(), ErrorCode);
+		return false;
+	}
+
+	const bool bWroteEverything = std::fwrite(SaveData.data(), 1, SaveData.size(), SaveFile) == SaveData.size();
+	const bool bClosed = std::fclose(SaveFile) == 0;
+	if (!bWroteEverything || !bClosed)
+	{
+		GE_LOG(LogFileIO, Warning, "Could not finish saving to %s!", FilePath.c_str());
+		return false;
+	}
+
+	return true;
+}
+
+/*static*/ bool FObjectSerializer::LoadFromFile(OObject* Root,
+												const std::string& FilePath,
+												std::vector<OObject*>* OutLoadedObjects)
+{
+	FMappedFile SaveFile;
+	if (!SaveFile.Open(FilePath))
+	{
+		return false;
+	}
+
+	// Loading never keeps pointers into the data, so the mapping can go once we're done
+	return Load(Root, SaveFile.GetData(), SaveFile.GetSize(), OutLoadedObjects);
+}
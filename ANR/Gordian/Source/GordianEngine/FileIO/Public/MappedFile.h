@@ -0,0 +1,54 @@
+// Gordian by Daniel Luna (2019)
+
+#pragma once
+
+#include <string>
+
+#include "SFML/System/NonCopyable.hpp"
+
+namespace Gordian
+{
+
+
+// Maps a whole file into memory as read-only, so it can be read in place
+//	instead of being copied into a buffer first.
+class FMappedFile : sf::NonCopyable
+{
+public:
+
+	FMappedFile();
+	~FMappedFile();
+
+	// Maps the file at FilePath, unmapping any file mapped before.
+	//	Returns false if the file could not be mapped.
+	bool Open(const std::string& FilePath);
+
+	// Unmaps the current file, if there is one
+	void Close();
+
+	// Returns true while a file is mapped. Empty files count, but have no data.
+	inline bool IsOpen() const
+	{
+		return _bIsOpen;
+	}
+
+	// Gets the first byte of the file, or nullptr if nothing is mapped
+	inline const char* GetData() const
+	{
+		return _Data;
+	}
+
+	inline size_t GetSize() const
+	{
+		return _Size;
+	}
+
+private:
+
+	const char* _Data;
+	size_t _Size;
+	bool _bIsOpen;
+};
+
+
+};
@@ -0,0 +1,52 @@
+// Gordian by Daniel Luna (2019)
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+namespace Gordian
+{
+
+
+class OObject;
+
+// Saves graphs of reflected objects to a compact binary format, and loads them back.
+//
+// Saving walks the reflected members of a root object, along with every object the root
+//	owns that can be reached through reflected pointers. Object pointers are written as
+//	indices into the saved objects. Bools, ints, floats and doubles are written as one
+//	block per object, and vectors of them as one block per vector, so they load with a
+//	few memcpys. Each saved type lists its members by name, so saves still load after
+//	members have been added, removed or reordered. Members of any other type fail the save.
+class FObjectSerializer
+{
+public:
+
+	FObjectSerializer() = delete;
+
+	// Appends Root, and everything it owns, to OutData.
+	// Returns false, leaving OutData as it was, if a reflected member's type can't be saved.
+	static bool Save(const OObject* Root, std::vector<char>& OutData);
+
+	// Loads data made by Save into Root, which must be the same class as the saved root.
+	//	Every other saved object is created again, has its members loaded, then is
+	//	initialized. Pointers to objects Root did not own are left as they were.
+	//	Fills OutLoadedObjects with the new objects, if given.
+	// Returns false if the data could not be read, in which case nothing was changed.
+	static bool Load(OObject* Root,
+					 const char* Data,
+					 size_t DataSize,
+					 std::vector<OObject*>* OutLoadedObjects = nullptr);
+
+	// Saves Root to FilePath, replacing anything already there
+	static bool SaveToFile(const OObject* Root, const std::string& FilePath);
+
+	// Maps FilePath and loads it in place, without reading it into a buffer first. See Load.
+	static bool LoadFromFile(OObject* Root,
+							 const std::string& FilePath,
+							 std::vector<OObject*>* OutLoadedObjects = nullptr);
+};
+
+
+};
@@ -0,0 +1,71 @@
+// Gordian by Daniel Luna (2019)
+
+#include "../Public/FrameArena.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <new>
+
+#include "GordianEngine/Debug/Public/Asserts.h"
+
+using namespace Gordian;
+
+FFrameArena::FFrameArena(size_t InBlockSize)
+	: _Blocks{}
+	, _CurrentBlock(0)
+	, _CurrentOffset(0)
+	, _BlockSize(InBlockSize)
+	, _NumBytesAllocated(0)
+	, _NumBytesReserved(0)
+{
+	check(_BlockSize > 0);
+}
+
+FFrameArena::~FFrameArena()
+{
+	for (const FBlock& Block : _Blocks)
+	{
+		::operator delete(Block.Memory);
+	}
+}
+
+void* FFrameArena::Allocate(size_t Size, size_t Alignment)
+{
+	check(Alignment > 0 && (Alignment & (Alignment - 1)) == 0);
+
+	// Move on through the blocks until one has room, making a new one at the end if none do
+	for (;;)
+	{
+		if (_CurrentBlock < _Blocks.size())
+		{
+			// Align the address rather than the offset, since blocks are only aligned to max_align_t
+			const FBlock& Block = _Blocks[_CurrentBlock];
+			const uintptr_t BlockAddress = reinterpret_cast<uintptr_t>(Block.Memory);
+			const uintptr_t AlignedAddress = (BlockAddress + _CurrentOffset + Alignment - 1) & ~static_cast<uintptr_t>(Alignment - 1);
+			const size_t AlignedOffset = static_cast<size_t>(AlignedAddress - BlockAddress);
+			if (AlignedOffset + Size <= Block.Size)
+			{
+				_CurrentOffset = AlignedOffset + Size;
+				_NumBytesAllocated += Size;
+				return Block.Memory + AlignedOffset;
+			}
+
+			++_CurrentBlock;
+			_CurrentOffset = 0;
+			continue;
+		}
+
+		// Blocks come from operator new, so they start aligned for anything up to max_align_t.
+		//	Padding by Alignment leaves room to align past that.
+		const size_t NewBlockSize = std::max(_BlockSize, Size + Alignment);
+		_Blocks.push_back(FBlock{ static_cast<char*>(::operator new(NewBlockSize)), NewBlockSize });
+		_NumBytesReserved += NewBlockSize;
+	}
+}
+
+void FFrameArena::Reset()
+{
+	_CurrentBlock = 0;
+	_CurrentOffset = 0;
+	_NumBytesAllocated = 0;
+}
@@ -5,23 +5,110 @@
 
 using namespace Gordian;
 
-TPrefixTree<const OType*> FGlobalObjectLibrary::_AllTypesByName;
+std::unordered_map<const OType_Struct*, std::unique_ptr<FObjectPool>> FGlobalObjectLibrary::_ObjectPoolsByType;
 
 // Registers a type by name to be searched for later
 /*static*/ bool FGlobalObjectLibrary::RegisterType(const OType* TypeToRegister)
 {
 	check(TypeToRegister != nullptr);
 
-	return _AllTypesByName.Insert(TypeToRegister->GetFullName(), TypeToRegister);
+	return GetAllTypesByName().Insert(TypeToRegister->GetFullName(), TypeToRegister);
 }
 
 /*static*/ const OType* FGlobalObjectLibrary::FetchTypeByName(const std::string& TypeName)
 {
-	const OType* const * TypeMatchedToKey = _AllTypesByName.Find(TypeName);
+	const OType* const * TypeMatchedToKey = GetAllTypesByName().Find(TypeName);
 	if (TypeMatchedToKey != nullptr)
 	{
 		return *TypeMatchedToKey;
 	}
 
 	return nullptr;
-}
\ No newline at end of file
+}
+
+/*static*/ OObject* FGlobalObjectLibrary::ConstructObjectOfType(OObject* OwningObject,
+																const OType_Struct* ObjectType,
+																const std::string& ObjectName)
+{
+	check(ObjectType != nullptr);
+	ObjectType->EnsureInitialization();
+
+	if (!ObjectType->CanConstructObjects())
+	{
+		return nullptr;
+	}
+
+	void* ObjectMemory = AllocateObjectMemory(ObjectType);
+	OObject* NewObject = ObjectType->ConstructObject(ObjectMemory,
+													  ObjectName != "" ? ObjectName : ObjectType->GetName(),
+													  OwningObject);
+
+	check(NewObject != nullptr);
+	NewObject->_PrivateType = ObjectType;
+
+	return NewObject;
+}
+
+/*static*/ void FGlobalObjectLibrary::DestroyObject(OObject* ObjectToDestroy)
+{
+	if (ObjectToDestroy == nullptr)
+	{
+		return;
+	}
+
+	const OType_Struct* ObjectType = ObjectToDestroy->GetType();
+	check(ObjectType != nullptr);
+
+	// The slot starts at the most derived object, which may not be where OObject lives
+	void* ObjectMemory = dynamic_cast<void*>(ObjectToDestroy);
+
+	ObjectToDestroy->~OObject();
+	FreeObjectMemory(ObjectType, ObjectMemory);
+}
+
+/*static*/ const FObjectPoolStats* FGlobalObjectLibrary::GetObjectPoolStats(const OType_Struct* ObjectType)
+{
+	auto PoolIt = _ObjectPoolsByType.find(ObjectType);
+	if (PoolIt != _ObjectPoolsByType.end())
+	{
+		return &PoolIt->second->GetStats();
+	}
+
+	return nullptr;
+}
+
+/*static*/ void FGlobalObjectLibrary::ForEachObjectPoolStats(const std::function<void(const OType_Struct*, const FObjectPoolStats&)>& Visitor)
+{
+	for (const auto& TypeAndPool : _ObjectPoolsByType)
+	{
+		Visitor(TypeAndPool.first, TypeAndPool.second->GetStats());
+	}
+}
+
+/*static*/ void* FGlobalObjectLibrary::AllocateObjectMemory(const OType_Struct* ObjectType)
+{
+	check(ObjectType != nullptr);
+
+	std::unique_ptr<FObjectPool>& TypePool = _ObjectPoolsByType[ObjectType];
+	if (TypePool == nullptr)
+	{
+		TypePool.reset(new FObjectPool(ObjectType->GetSize()));
+	}
+
+	return TypePool->Allocate();
+}
+
+/*static*/ void FGlobalObjectLibrary::FreeObjectMemory(const OType_Struct* ObjectType, void* ObjectMemory)
+{
+	auto PoolIt = _ObjectPoolsByType.find(ObjectType);
+
+	// Objects should only ever be destroyed through the library that made them
+	check(PoolIt != _ObjectPoolsByType.end());
+	PoolIt->second->Free(ObjectMemory);
+}
+
+/*static*/ TPrefixTree<const OType*>& FGlobalObjectLibrary::GetAllTypesByName()
+{
+	static TPrefixTree<const OType*> AllTypesByName;
+	return AllTypesByName;
+}
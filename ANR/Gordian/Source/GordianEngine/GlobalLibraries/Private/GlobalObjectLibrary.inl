@@ -1,5 +1,7 @@
 // Gordian by Daniel Luna (2019)
 
+#include <new>
+
 
 template<typename TargetClass, typename std::enable_if<Gordian::FDefaultTypeResolver::IsReflected<TargetClass>::value, int>::type>
 TargetClass* Gordian::Cast(Gordian::OObject* Source)
@@ -35,9 +37,12 @@ T* Gordian::FGlobalObjectLibrary::CreateObject(Gordian::OObject* OwningObject,
 	check(ObjectType != nullptr);
 	ObjectType->EnsureInitialization();
 
-	// todo: this should eventually use pooled objects where possible
-	Gordian::OObject* NewObject = new T(ObjectName != "" ? ObjectName : ObjectType->GetName(),
-										OwningObject);
+	// Slots are sized by ObjectType, so T must fit inside of it
+	checkMsgf(sizeof(T) <= ObjectType->GetSize(), "CreateObject was given a type smaller than the class being constructed!");
+	void* ObjectMemory = AllocateObjectMemory(ObjectType);
+
+	Gordian::OObject* NewObject = new (ObjectMemory) T(ObjectName != "" ? ObjectName : ObjectType->GetName(),
+													   OwningObject);
 
 	check(NewObject != nullptr);
 	NewObject->_PrivateType = ObjectType;
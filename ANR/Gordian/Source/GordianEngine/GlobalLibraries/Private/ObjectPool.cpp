@@ -0,0 +1,108 @@
+// Gordian by Daniel Luna (2019)
+
+#include "../Public/ObjectPool.h"
+
+#include <algorithm>
+#include <new>
+
+#include "GordianEngine/Debug/Public/Asserts.h"
+
+using namespace Gordian;
+
+namespace
+{
+	// Slabs aim to be about this many bytes
+	const size_t k_TargetSlabSize = 16 * 1024;
+	// Large types still get at least this many slots per slab
+	const size_t k_MinSlotsPerSlab = 8;
+	// Every slot is aligned as strictly as the default allocator would align it
+	const size_t k_SlotAlignment = alignof(std::max_align_t);
+}
+
+FObjectPool::FObjectPool(size_t InSlotSize)
+	: _Slabs{}
+	, _FreeListHead(nullptr)
+	, _Stats{}
+{
+	check(InSlotSize > 0);
+
+	// Round up so every slot stays aligned and can hold a free list link
+	const size_t SlotSize = std::max(InSlotSize, sizeof(FFreeSlot));
+	_Stats.SlotSize = (SlotSize + k_SlotAlignment - 1) / k_SlotAlignment * k_SlotAlignment;
+	_Stats.SlotsPerSlab = std::max(k_TargetSlabSize / _Stats.SlotSize, k_MinSlotsPerSlab);
+}
+
+FObjectPool::~FObjectPool()
+{
+	// Pools usually die during static destruction, so don't report leaks from here.
+	//	Anything still live is simply dropped with its slab.
+	for (char* Slab : _Slabs)
+	{
+		::operator delete(Slab);
+	}
+}
+
+void* FObjectPool::Allocate()
+{
+	if (_FreeListHead == nullptr)
+	{
+		AllocateSlab();
+	}
+
+	check(_FreeListHead != nullptr);
+	FFreeSlot* Slot = _FreeListHead;
+	_FreeListHead = Slot->Next;
+
+	--_Stats.FreeSlots;
+	++_Stats.LiveSlots;
+	_Stats.PeakLiveSlots = std::max(_Stats.PeakLiveSlots, _Stats.LiveSlots);
+
+	return Slot;
+}
+
+void FObjectPool::Free(void* Slot)
+{
+	check(Slot != nullptr);
+	check(_Stats.LiveSlots > 0);
+	check(Owns(Slot));
+
+	FFreeSlot* FreedSlot = static_cast<FFreeSlot*>(Slot);
+	FreedSlot->Next = _FreeListHead;
+	_FreeListHead = FreedSlot;
+
+	--_Stats.LiveSlots;
+	++_Stats.FreeSlots;
+}
+
+bool FObjectPool::Owns(const void* Address) const
+{
+	const char* AddressAsBytes = static_cast<const char*>(Address);
+	const size_t SlabSize = _Stats.SlotSize * _Stats.SlotsPerSlab;
+
+	for (const char* Slab : _Slabs)
+	{
+		if (AddressAsBytes >= Slab && AddressAsBytes < Slab + SlabSize)
+		{
+			return (AddressAsBytes - Slab) % _Stats.SlotSize == 0;
+		}
+	}
+
+	return false;
+}
+
+void FObjectPool::AllocateSlab()
+{
+	char* NewSlab = static_cast<char*>(::operator new(_Stats.SlotSize * _Stats.SlotsPerSlab));
+	_Slabs.push_back(NewSlab);
+
+	// Push in reverse so slots are handed out in ascending address order
+	for (size_t SlotIndex = _Stats.SlotsPerSlab; SlotIndex > 0; --SlotIndex)
+	{
+		FFreeSlot* Slot = reinterpret_cast<FFreeSlot*>(NewSlab + (SlotIndex - 1) * _Stats.SlotSize);
+		Slot->Next = _FreeListHead;
+		_FreeListHead = Slot;
+	}
+
+	++_Stats.SlabCount;
+	_Stats.FreeSlots += _Stats.SlotsPerSlab;
+}
@@ -0,0 +1,63 @@
+// Gordian by Daniel Luna (2019)
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include "SFML/System/NonCopyable.hpp"
+
+namespace Gordian
+{
+
+
+// Hands out memory by bumping a pointer through large blocks, and takes it all back at once.
+// Nothing allocated here is destroyed, so it should only hold trivially destructible data
+//	that lives until the next Reset, such as one frame's worth of events.
+class FFrameArena : public sf::NonCopyable
+{
+public:
+
+	explicit FFrameArena(size_t InBlockSize = 64 * 1024);
+	~FFrameArena();
+
+	// Returns Size bytes aligned to Alignment, which must be a power of two
+	void* Allocate(size_t Size, size_t Alignment = alignof(std::max_align_t));
+
+	// Frees everything allocated so far. Blocks are kept, so the next frame does not allocate again.
+	void Reset();
+
+	// Bytes handed out since the last reset, not counting padding
+	inline size_t GetNumBytesAllocated() const
+	{
+		return _NumBytesAllocated;
+	}
+
+	// Bytes held in blocks, used or not
+	inline size_t GetNumBytesReserved() const
+	{
+		return _NumBytesReserved;
+	}
+
+private:
+
+	struct FBlock
+	{
+		char* Memory;
+		size_t Size;
+	};
+
+	// Usually _BlockSize bytes, but larger allocations get a block to themselves
+	std::vector<FBlock> _Blocks;
+	// Block currently being allocated from
+	size_t _CurrentBlock;
+	// Offset of the first free byte in the current block
+	size_t _CurrentOffset;
+
+	size_t _BlockSize;
+	size_t _NumBytesAllocated;
+	size_t _NumBytesReserved;
+};
+
+
+};
@@ -2,10 +2,14 @@
 
 #pragma once
 
+#include <functional>
+#include <memory>
 #include <type_traits>
+#include <unordered_map>
 
 #include "GordianEngine/Containers/Public/TPrefixTree.h"
 #include "GordianEngine/Debug/Public/Asserts.h"
+#include "GordianEngine/GlobalLibraries/Public/ObjectPool.h"
 #include "GordianEngine/Reflection/Public/Type.h"
 #include "GordianEngine/Reflection/Public/Type_Struct.h"
 
@@ -24,20 +28,49 @@ class FGlobalObjectLibrary
 public:
 
 	// WIP, intended to initialize objects
+	// Memory comes from the object pool of ObjectType.
 	template<typename T, typename std::enable_if<std::is_base_of<OObject, T>::value, int>::type = 0>
 	static T* CreateObject(OObject* OwningObject,
 						   const OType_Struct* ObjectType,
 						   const std::string& ObjectName = "");
 
-	// Registers a type by name to be searched for later
+	// Constructs an object of ObjectType without initializing it, for when the object's
+	//	state has to be filled in first (such as when loading). The caller is expected to
+	//	call Initialize once it is ready. Returns nullptr if ObjectType can't be constructed.
+	static OObject* ConstructObjectOfType(OObject* OwningObject,
+										  const OType_Struct* ObjectType,
+										  const std::string& ObjectName = "");
+
+	// Destructs an object made by CreateObject and returns its memory to the pool.
+	static void DestroyObject(OObject* ObjectToDestroy);
+
+	// Returns the pool counters for the given type, or nullptr if no object 
+	//	of that type has been created yet.
+	static const FObjectPoolStats* GetObjectPoolStats(const OType_Struct* ObjectType);
+
+	// Calls Visitor with the pool counters of every type that has had an object created
+	static void ForEachObjectPoolStats(const std::function<void(const OType_Struct*, const FObjectPoolStats&)>& Visitor);
+
+	// Registers a type by name to be searched for later.
+	//	Reflected classes register themselves during static initialization.
 	static bool RegisterType(const OType* TypeToRegister);
 
 	static const OType* FetchTypeByName(const std::string& TypeName);
 
 private:
 
-	// Stores all types by the names of the type for easy lookup
-	static TPrefixTree<const OType*> _AllTypesByName;
+	// Fetches a slot for an object of ObjectType from that type's pool
+	static void* AllocateObjectMemory(const OType_Struct* ObjectType);
+
+	// Returns a slot fetched by AllocateObjectMemory
+	static void FreeObjectMemory(const OType_Struct* ObjectType, void* ObjectMemory);
+
+	// Stores all types by the names of the type for easy lookup.
+	//	Function local, since types register during static initialization.
+	static TPrefixTree<const OType*>& GetAllTypesByName();
+
+	// Stores one pool per type, created the first time an object of that type is made
+	static std::unordered_map<const OType_Struct*, std::unique_ptr<FObjectPool>> _ObjectPoolsByType;
 };
 
 }; // namespace Gordian
@@ -0,0 +1,80 @@
+// Gordian by Daniel Luna (2019)
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include "SFML/System/NonCopyable.hpp"
+
+namespace Gordian
+{
+
+
+// Usage counters for a single object pool
+struct FObjectPoolStats
+{
+	// Size in bytes of each slot in the pool
+	size_t SlotSize;
+	// Number of slots in each slab
+	size_t SlotsPerSlab;
+	// Number of slabs allocated so far
+	size_t SlabCount;
+	// Number of slots currently holding an object
+	size_t LiveSlots;
+	// Number of slots allocated but not holding an object
+	size_t FreeSlots;
+	// Highest number of live slots seen at once
+	size_t PeakLiveSlots;
+};
+
+
+// Fixed-size slot allocator.
+// Slots are carved out of large slabs, so everything allocated from a single pool
+//	sits next to each other in memory. Freed slots are reused before new slabs are made.
+// Slabs are only released when the pool is destroyed.
+class FObjectPool : public sf::NonCopyable
+{
+public:
+
+	FObjectPool() = delete;
+	FObjectPool(size_t InSlotSize);
+	~FObjectPool();
+
+	// Returns uninitialized memory for a single slot. Never returns nullptr.
+	void* Allocate();
+
+	// Returns a slot previously handed out by Allocate to this pool.
+	// The object in the slot must already have been destructed.
+	void Free(void* Slot);
+
+	// Returns true if the given address lies in one of this pool's slabs
+	bool Owns(const void* Address) const;
+
+	inline const FObjectPoolStats& GetStats() const
+	{
+		return _Stats;
+	}
+
+private:
+
+	// Free slots are linked through their own memory
+	struct FFreeSlot
+	{
+		FFreeSlot* Next;
+	};
+
+	// Allocates a new slab, pushing all of its slots onto the free list
+	void AllocateSlab();
+
+	// All slabs owned by this pool
+	std::vector<char*> _Slabs;
+
+	// Head of the intrusive free list
+	FFreeSlot* _FreeListHead;
+
+	FObjectPoolStats _Stats;
+};
+
+
+};	// namespace Gordian
@@ -31,7 +31,7 @@ bool FDigitalBinding::operator<(const FDigitalBinding& Other) const
 	}
 	else if (RequiredComboKeys.to_ulong() != Other.RequiredComboKeys.to_ulong())
 	{
-		return RequiredComboKeys.to_ulong() != Other.RequiredComboKeys.to_ulong();
+		return RequiredComboKeys.to_ulong() < Other.RequiredComboKeys.to_ulong();
 	}
 	else
 	{
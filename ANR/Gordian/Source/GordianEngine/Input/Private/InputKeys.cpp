@@ -242,6 +242,38 @@ bool EGenericInputKey::IsValid() const
 	return bIsValid;
 }
 
+sf::Uint32 EGenericInputKey::GetKeyIndex() const
+{
+	const sf::Uint32 FirstMouseIndex = sf::Keyboard::KeyCount;
+	const sf::Uint32 FirstGamepadIndex = FirstMouseIndex + sf::Mouse::ButtonCount;
+
+	switch (_KeyType)
+	{
+		case InputKeys::EInputKeyTypes::Keyboard:
+			if (_KeyboardKey >= 0 && _KeyboardKey < InputKeys::EKeyboardKeys::KeyCount)
+			{
+				return static_cast<sf::Uint32>(_KeyboardKey);
+			}
+			break;
+		case InputKeys::EInputKeyTypes::Mouse:
+			if (_MouseKey >= 0 && _MouseKey < InputKeys::EMouseButtons::ButtonCount)
+			{
+				return FirstMouseIndex + static_cast<sf::Uint32>(_MouseKey);
+			}
+			break;
+		case InputKeys::EInputKeyTypes::Gamepad:
+			if (_GamepadKey < sf::Joystick::ButtonCount)
+			{
+				return FirstGamepadIndex + _GamepadKey;
+			}
+			break;
+		default:
+			break;
+	}
+
+	return KeyIndexCount;
+}
+
 InputKeys::EGamepadButtons InputKeys::ConvertJoystickKeyCodeToGamepadButton(unsigned int JoystickKeyCode)
 {
 	if (JoystickKeyCode >= static_cast<unsigned int>(InputKeys::EGamepadButtons::ButtonCount))
@@ -1,14 +1,24 @@
 // Gordian by Daniel Luna (2019)
 
 #include "../Public/InputManager.h"
+#include "../Public/InputEvents.h"
+
+#include "GordianEngine/Core/Public/EventBus.h"
 
 #include "GordianEngine/Debug/Public/Asserts.h"
+#include "GordianEngine/Debug/Public/Logging.h"
 
 using namespace Gordian;
 
+DECLARE_LOG_CATEGORY_STATIC(LogInput, All, Verbose)
+
 FInputManager* FInputManager::Singleton = nullptr;
 
 FInputManager::FInputManager()
+	: _AnalogAxisStates{}
+	, _AnalogAxisDelegates()
+	, _InputRecorder()
+	, _CurrentTickIndex(0)
 {
 	FDigitalBinding TempBinding;
 	TempBinding.CommandToTrigger = "TestCommand";
@@ -18,12 +28,34 @@ FInputManager::FInputManager()
 
 	GenerateCommandDelegates();
 
+	// Sticks and triggers start at rest, so their first report is a real change.
+	//	The cursor and touches have no resting place, so they wait for their first position.
+	for (size_t AxisIndex = static_cast<size_t>(EAnalogAxis::Gamepad_X); AxisIndex <= static_cast<size_t>(EAnalogAxis::Gamepad_PovY); ++AxisIndex)
+	{
+		_AnalogAxisStates[AxisIndex].bHasPosition = true;
+	}
+
+	FEventBus& EventBus = FEventBus::Get();
+	EventBus.Subscribe<FDigitalCommandEvent, FInputManager, &FInputManager::OnDigitalCommandEvent>(this);
+	EventBus.SetCoalescing<FMouseMovedEvent>(EEventCoalescing::KeepLast);
+
 	if (Singleton == nullptr)
 	{
 		Singleton = this;
 	}
 }
 
+FInputManager::~FInputManager()
+{
+	// Anything still queued for us is dropped along with the subscription
+	FEventBus::Get().Unsubscribe<FDigitalCommandEvent, FInputManager, &FInputManager::OnDigitalCommandEvent>(this);
+
+	if (Singleton == this)
+	{
+		Singleton = nullptr;
+	}
+}
+
 /*static*/ FInputManager* FInputManager::Get()
 {
 	check(Singleton != nullptr);
@@ -37,6 +69,11 @@ void FInputManager::HandleWindowEvent(sf::Event& EventData)
 		GenerateCommandDelegates();
 	}
 
+	if (_InputRecorder.IsRecording())
+	{
+		_InputRecorder.RecordEvent(EventData, _CurrentTickIndex);
+	}
+
 	switch (EventData.type)
 	{
 		// Handle Digital Input --------------------------------------------------------------
@@ -56,19 +93,24 @@ void FInputManager::HandleWindowEvent(sf::Event& EventData)
 			// Text is currently unhandled
 			break;
 		case sf::Event::TouchBegan:
+			// Touches only move the touch axes for now
+			HandleAnalogEvent(EventData);
+			break;
 		case sf::Event::TouchEnded:
-			// Touch is currently unhandled
 			break;
 
 		// Handle all Analog / Axial Input ---------------------------------------------------------
 		case sf::Event::MouseMoved:
+			FEventBus::Get().Post(FMouseMovedEvent{ EventData.mouseMove.x, EventData.mouseMove.y });
+			HandleAnalogEvent(EventData);
 			break;
 		case sf::Event::MouseWheelMoved:
-		case sf::Event::MouseWheelScrolled:
+			// Deprecated, SFML sends a MouseWheelScrolled alongside each of these
 			break;
+		case sf::Event::MouseWheelScrolled:
 		case sf::Event::JoystickMoved:
-			break;
 		case sf::Event::TouchMoved:
+			HandleAnalogEvent(EventData);
 			break;
 		case sf::Event::SensorChanged:
 			break;
@@ -93,19 +135,75 @@ void FInputManager::HandleWindowEvent(sf::Event& EventData)
 	}
 }
 
+void FInputManager::BroadcastAnalogInput()
+{
+	for (size_t AxisIndex = 0; AxisIndex < k_NumAnalogAxes; ++AxisIndex)
+	{
+		FAnalogAxisState& AxisState = _AnalogAxisStates[AxisIndex];
+		if (!AxisState.bHasChanged)
+		{
+			continue;
+		}
+
+		// Cleared first, so anything a delegate feeds back in is kept for the next broadcast
+		const float Delta = AxisState.Delta;
+		AxisState.Delta = 0.f;
+		AxisState.bHasChanged = false;
+
+		_AnalogAxisDelegates[AxisIndex](AxisState.Value, Delta);
+	}
+}
+
+bool FInputManager::StartRecording(const std::string& FilePath, sf::Uint32 TickRate)
+{
+	return _InputRecorder.Start(FilePath, TickRate);
+}
+
+void FInputManager::StopRecording()
+{
+	_InputRecorder.Stop();
+}
+
 void FInputManager::GenerateCommandDelegates()
 {
 	check(!_bHasGeneratedDelegateMap);
 
 	_DigitalCommandDelegates.clear();
+	_DigitalBindingTable.assign(EGenericInputKey::KeyIndexCount * k_NumComboKeyStates, nullptr);
+	_PressedBroadcasters.assign(EGenericInputKey::KeyIndexCount, nullptr);
+
+	// Combo keys required by whichever binding currently fills each slot of the table
+	std::vector<int> RequiredComboKeyCounts(_DigitalBindingTable.size(), -1);
 
 	for (const FDigitalBinding& DigitalBinding : DigitalBindingSet)
 	{
-		std::map<FCommand, std::shared_ptr<FDigitalBroadcaster>>::const_iterator ExistingCommandIt;
-		ExistingCommandIt = _DigitalCommandDelegates.find(DigitalBinding.CommandToTrigger);
-		if (ExistingCommandIt == _DigitalCommandDelegates.cend())
+		const sf::Uint32 KeyIndex = DigitalBinding.TriggerKey.GetKeyIndex();
+		if (KeyIndex >= EGenericInputKey::KeyIndexCount)
+		{
+			GE_LOG(LogInput, Warning, "Command %s is bound to an unknown key, so it can never trigger.",
+				   DigitalBinding.CommandToTrigger.c_str());
+			continue;
+		}
+
+		std::unique_ptr<FDigitalBroadcaster>& Broadcaster = _DigitalCommandDelegates[DigitalBinding.CommandToTrigger];
+		if (Broadcaster == nullptr)
 		{
-			_DigitalCommandDelegates.emplace(DigitalBinding.CommandToTrigger, std::make_shared<FDigitalBroadcaster>(0));
+			Broadcaster.reset(new FDigitalBroadcaster());
+		}
+
+		// Fill in every combo key state the binding can trigger under, preferring
+		//	bindings that require more combo keys over those that require fewer.
+		const size_t RequiredComboKeys = DigitalBinding.RequiredComboKeys.to_ulong();
+		const int NumRequiredComboKeys = static_cast<int>(DigitalBinding.RequiredComboKeys.count());
+		for (size_t ComboKeyState = 0; ComboKeyState < k_NumComboKeyStates; ++ComboKeyState)
+		{
+			const size_t TableIndex = KeyIndex * k_NumComboKeyStates + ComboKeyState;
+			if ((ComboKeyState & RequiredComboKeys) == RequiredComboKeys
+				&& NumRequiredComboKeys > RequiredComboKeyCounts[TableIndex])
+			{
+				_DigitalBindingTable[TableIndex] = Broadcaster.get();
+				RequiredComboKeyCounts[TableIndex] = NumRequiredComboKeys;
+			}
 		}
 	}
 
@@ -146,40 +244,141 @@ void FInputManager::HandleDigitalEvent(const sf::Event& EventData)
 	check(IsDigitalEvent(EventData));
 
 	// Translate event to a generic key
-	EGenericInputKey KeyTranslation(EventData);
-
-	FDigitalBinding SearchBinding;
-	SearchBinding.TriggerKey = KeyTranslation;
-
-	using BindingSetItType = std::set<FDigitalBinding>::const_iterator;
+	const sf::Uint32 KeyIndex = EGenericInputKey(EventData).GetKeyIndex();
+	if (KeyIndex >= EGenericInputKey::KeyIndexCount)
+	{
+		return;
+	}
 
-	// We start the search at the first element with the same trigger key
-	BindingSetItType FirstBindingByKey = DigitalBindingSet.lower_bound(SearchBinding);
-	if (FirstBindingByKey != DigitalBindingSet.cend() && FirstBindingByKey->TriggerKey == KeyTranslation)
+	// Eventually we should expand upon input and create Controllers which decide whether or not they consume input. Here we assume all input is consumed
+	FDigitalBroadcaster* const BoundBroadcaster = _DigitalBindingTable[KeyIndex * k_NumComboKeyStates + _DigitalComboKeyState.to_ulong()];
+	switch (GetDigitalEventType(EventData))
 	{
-		// This may not be the only binding that can trigger though. We need to iterate across all possible bindings.
-		// Since bindings are sorted by key, then by combo state, we can find the binding with the most 'complicated' 
-		// yet possibly triggerable state and start the search there, working back to the simple case.
-		SearchBinding.RequiredComboKeys = _DigitalComboKeyState;
-		SearchBinding.CommandToTrigger = char(127);
-		BindingSetItType LastApplicableBinding = DigitalBindingSet.upper_bound(SearchBinding);
+		case EDigitalEventType::Pressed:
+			_PressedBroadcasters[KeyIndex] = BoundBroadcaster;
+			if (BoundBroadcaster != nullptr)
+			{
+				FEventBus::Get().Post(FDigitalCommandEvent{ this, BoundBroadcaster, EDigitalEventType::Pressed });
+			}
+			break;
+		case EDigitalEventType::Released:
+		{
+			// Combo keys are ignored in release events, so release whatever the press triggered.
+			//	Keys pressed before we were listening fall back to the current combo key state.
+			FDigitalBroadcaster* const PressedBroadcaster = _PressedBroadcasters[KeyIndex];
+			_PressedBroadcasters[KeyIndex] = nullptr;
 
-		// We will search across these its in reverse fasion (reverse its seem to be crashing here, so we just do it by hand)
-		const BindingSetItType SearchLocationStart = --LastApplicableBinding;
-		const BindingSetItType SearchLocationEnd = --FirstBindingByKey;
+			FDigitalBroadcaster* const ReleasedBroadcaster = PressedBroadcaster != nullptr ? PressedBroadcaster : BoundBroadcaster;
+			if (ReleasedBroadcaster != nullptr)
+			{
+				FEventBus::Get().Post(FDigitalCommandEvent{ this, ReleasedBroadcaster, EDigitalEventType::Released });
+			}
+			break;
+		}
+		default:
+			checkNoEntry();
+			break;
+	}
+}
 
-		// Prefer triggerable bindings with more complex combo key state over those with simpler ones.
-		// Eventually we should expand upon input and create Controllers which decide whether or not they consume input. Here we assume all input is consumed
-		for (BindingSetItType It = SearchLocationStart; It != SearchLocationEnd; --It)
+void FInputManager::HandleAnalogEvent(const sf::Event& EventData)
+{
+	switch (EventData.type)
+	{
+		case sf::Event::MouseMoved:
+			MoveAnalogAxis(EAnalogAxis::MouseX, static_cast<float>(EventData.mouseMove.x));
+			MoveAnalogAxis(EAnalogAxis::MouseY, static_cast<float>(EventData.mouseMove.y));
+			break;
+		case sf::Event::MouseWheelScrolled:
+			OffsetAnalogAxis(EventData.mouseWheelScroll.wheel == sf::Mouse::VerticalWheel ? EAnalogAxis::MouseWheel
+																						   : EAnalogAxis::MouseHorizontalWheel,
+							 EventData.mouseWheelScroll.delta);
+			break;
+		case sf::Event::JoystickMoved:
 		{
-			if (It->ShouldInputTriggerBinding(KeyTranslation, _DigitalComboKeyState))
+			// SFML reports positions from -100 to 100
+			const size_t AxisIndex = static_cast<size_t>(EAnalogAxis::Gamepad_X) + static_cast<size_t>(EventData.joystickMove.axis);
+			if (AxisIndex <= static_cast<size_t>(EAnalogAxis::Gamepad_PovY))
 			{
-				TriggerDigitalCommand(It->CommandToTrigger, GetDigitalEventType(EventData));
-				return;
+				MoveAnalogAxis(static_cast<EAnalogAxis>(AxisIndex), EventData.joystickMove.position / 100.f);
 			}
+			break;
 		}
+		case sf::Event::TouchBegan:
+			if (EventData.touch.finger == 0)
+			{
+				PlaceAnalogAxis(EAnalogAxis::TouchX, static_cast<float>(EventData.touch.x));
+				PlaceAnalogAxis(EAnalogAxis::TouchY, static_cast<float>(EventData.touch.y));
+			}
+			break;
+		case sf::Event::TouchMoved:
+			if (EventData.touch.finger == 0)
+			{
+				MoveAnalogAxis(EAnalogAxis::TouchX, static_cast<float>(EventData.touch.x));
+				MoveAnalogAxis(EAnalogAxis::TouchY, static_cast<float>(EventData.touch.y));
+			}
+			break;
+		default:
+			checkNoEntry();
+			break;
 	}
+}
 
+void FInputManager::MoveAnalogAxis(EAnalogAxis Axis, float Value)
+{
+	FAnalogAxisState& AxisState = _AnalogAxisStates[static_cast<size_t>(Axis)];
+	if (!AxisState.bHasPosition)
+	{
+		PlaceAnalogAxis(Axis, Value);
+		return;
+	}
+
+	if (AxisState.Value == Value)
+	{
+		return;
+	}
+
+	AxisState.Delta += Value - AxisState.Value;
+	AxisState.Value = Value;
+	AxisState.bHasChanged = true;
+}
+
+void FInputManager::OffsetAnalogAxis(EAnalogAxis Axis, float Delta)
+{
+	FAnalogAxisState& AxisState = _AnalogAxisStates[static_cast<size_t>(Axis)];
+	AxisState.Delta += Delta;
+	AxisState.Value += Delta;
+	AxisState.bHasChanged = true;
+}
+
+void FInputManager::PlaceAnalogAxis(EAnalogAxis Axis, float Value)
+{
+	FAnalogAxisState& AxisState = _AnalogAxisStates[static_cast<size_t>(Axis)];
+	AxisState.Value = Value;
+	AxisState.bHasChanged = true;
+	AxisState.bHasPosition = true;
+}
+
+void FInputManager::OnDigitalCommandEvent(const FDigitalCommandEvent& Event)
+{
+	// Every input manager hears every command, so skip those another one posted
+	if (Event.InputManager != this)
+	{
+		return;
+	}
+
+	switch (Event.EventType)
+	{
+		case EDigitalEventType::Pressed:
+			Event.Broadcaster->OnPressed();
+			break;
+		case EDigitalEventType::Released:
+			Event.Broadcaster->OnReleased();
+			break;
+		default:
+			checkNoEntry();
+			break;
+	}
 }
 
 bool FInputManager::IsDigitalEvent(const sf::Event& EventData) const
@@ -226,24 +425,29 @@ EDigitalEventType FInputManager::GetDigitalEventType(const sf::Event& EventData)
 	}
 }
 
-void FInputManager::TriggerDigitalCommand(const FCommand& CommandToTrigger, EDigitalEventType EventType)
+bool FInputManager::AddDigitalDelegate(const FCommand& CommandToBind,
+									   const EDigitalEventType& EventType,
+									   const delegate<void()>& Delegate)
 {
-	using CommandMapItType = std::map<FCommand, std::shared_ptr<FDigitalBroadcaster>>::iterator;
-	CommandMapItType CommandDelegatePair = _DigitalCommandDelegates.find(CommandToTrigger);
-	if (CommandDelegatePair != _DigitalCommandDelegates.end())
+	const auto MatchingCommandPair = _DigitalCommandDelegates.find(CommandToBind);
+	if (MatchingCommandPair == _DigitalCommandDelegates.end())
 	{
-		check(CommandDelegatePair->second != nullptr);
-		switch (EventType)
-		{
-			case EDigitalEventType::Pressed:
-				CommandDelegatePair->second->OnPressed();
-				break;
-			case EDigitalEventType::Released:
-				CommandDelegatePair->second->OnReleased();
-				break;
-			default:
-				checkNoEntry();
-				break;
-		}
+		return false;
+	}
+
+	check(MatchingCommandPair->second != nullptr);
+	switch (EventType)
+	{
+		case EDigitalEventType::Pressed:
+			MatchingCommandPair->second->OnPressed += Delegate;
+			return true;
+		case EDigitalEventType::Released:
+			MatchingCommandPair->second->OnReleased += Delegate;
+			return true;
+		default:
+			checkNoEntry();
+			break;
 	}
+
+	return false;
 }
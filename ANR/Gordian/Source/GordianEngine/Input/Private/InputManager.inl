@@ -1,31 +1,9 @@
-
 template <class T, void(T::*TMethod)() const>
 bool Gordian::FInputManager::BindToDigitalCommand(const FCommand& CommandToBind,
 												  const EDigitalEventType& EventType,
 												  const T* ObjectToBindTo)
 {
-	const std::map<FCommand, FDigitalBroadcaster>::iterator MatchingCommandPair = _DigitalCommandDelegates.find(CommandToBind);
-	if (MatchingCommandPair != _DigitalCommandDelegates.cend())
-	{
-		delegate<void()> ConstDelegate = delegate<void()>::create<T, TMethod>(ObjectToBindTo);
-
-		switch (EventType)
-		{
-			case EDigitalEventType::Pressed:
-				MatchingCommandPair->second.OnPressed += ConstDelegate;
-				return true;
-				break;
-			case EDigitalEventType::Released:
-				MatchingCommandPair->second.OnReleased += ConstDelegate;
-				return true;
-				break;
-			default:
-				checkNoEntry();
-				break;
-		}
-	}
-
-	return false;
+	return AddDigitalDelegate(CommandToBind, EventType, delegate<void()>::create<T, TMethod>(ObjectToBindTo));
 }
 
 template <class T, void(T::*TMethod)()>
@@ -33,54 +11,30 @@ bool Gordian::FInputManager::BindToDigitalCommand(const FCommand& CommandToBind,
 												  const EDigitalEventType& EventType,
 												  T* ObjectToBindTo)
 {
-	const std::map<FCommand, std::shared_ptr<FDigitalBroadcaster>>::iterator MatchingCommandPair = _DigitalCommandDelegates.find(CommandToBind);
-	if (MatchingCommandPair != _DigitalCommandDelegates.cend())
-	{
-		delegate<void()> Delegate = delegate<void()>::create<T, TMethod>(ObjectToBindTo);
-		check(MatchingCommandPair->second != nullptr);
-		switch (EventType)
-		{
-			case EDigitalEventType::Pressed:
-				MatchingCommandPair->second->OnPressed += Delegate;
-				return true;
-				break;
-			case EDigitalEventType::Released:
-				MatchingCommandPair->second->OnReleased += Delegate;
-				return true;
-				break;
-			default:
-				checkNoEntry();
-				break;
-		}
-	}
-
-	return false;
+	return AddDigitalDelegate(CommandToBind, EventType, delegate<void()>::create<T, TMethod>(ObjectToBindTo));
 }
 
 template <void(*TMethod)()>
 bool Gordian::FInputManager::BindToDigitalCommand(const FCommand& CommandToBind,
 												  const EDigitalEventType& EventType)
 {
-	const std::map<FCommand, FDigitalBroadcaster>::iterator MatchingCommandPair = _DigitalCommandDelegates.find(CommandToBind);
-	if (MatchingCommandPair != _DigitalCommandDelegates.cend())
-	{
-		delegate<void()> StaticDelegate = delegate<void()>::create<TMethod>();
+	return AddDigitalDelegate(CommandToBind, EventType, delegate<void()>::create<TMethod>());
+}
 
-		switch (EventType)
-		{
-			case EDigitalEventType::Pressed:
-				MatchingCommandPair->second.OnPressed += StaticDelegate;
-				return true;
-				break;
-			case EDigitalEventType::Released:
-				MatchingCommandPair->second.OnReleased += StaticDelegate;
-				return true;
-				break;
-			default:
-				checkNoEntry();
-				break;
-		}
-	}
+template <class T, void(T::*TMethod)(float, float) const>
+void Gordian::FInputManager::BindToAnalogAxis(EAnalogAxis Axis, const T* ObjectToBindTo)
+{
+	_AnalogAxisDelegates[static_cast<size_t>(Axis)] += delegate<void(float, float)>::create<T, TMethod>(ObjectToBindTo);
+}
 
-	return false;
+template <class T, void(T::*TMethod)(float, float)>
+void Gordian::FInputManager::BindToAnalogAxis(EAnalogAxis Axis, T* ObjectToBindTo)
+{
+	_AnalogAxisDelegates[static_cast<size_t>(Axis)] += delegate<void(float, float)>::create<T, TMethod>(ObjectToBindTo);
+}
+
+template <void(*TMethod)(float, float)>
+void Gordian::FInputManager::BindToAnalogAxis(EAnalogAxis Axis)
+{
+	_AnalogAxisDelegates[static_cast<size_t>(Axis)] += delegate<void(float, float)>::create<TMethod>();
 }
@@ -0,0 +1,289 @@
+// Gordian by Daniel Luna (2019)
+
+#include "GordianEngine/Input/Public/InputRecording.h"
+
+#include <cstring>
+
+#include "GordianEngine/Debug/Public/Asserts.h"
+#include "GordianEngine/Debug/Public/Logging.h"
+
+using namespace Gordian;
+
+namespace
+{
+	// "GEIR" read as a little-endian u32
+	const sf::Uint32 k_InputRecordingMagic = 0x52494547;
+	// Version 2 added the tick rate to the header
+	const sf::Uint16 k_InputRecordingVersion = 2;
+	const size_t k_InputRecordingHeaderSize = sizeof(sf::Uint32) + sizeof(sf::Uint16) + sizeof(sf::Uint32);
+
+	// Buffered records are written out once there are this many bytes of them
+	const size_t k_RecorderFlushSize = 64 * 1024;
+
+	// Bytes of the event union used by each event type
+	size_t GetEventPayloadSize(sf::Event::EventType EventType)
+	{
+		switch (EventType)
+		{
+			case sf::Event::Resized:
+				return sizeof(sf::Event::SizeEvent);
+			case sf::Event::TextEntered:
+				return sizeof(sf::Event::TextEvent);
+			case sf::Event::KeyPressed:
+			case sf::Event::KeyReleased:
+				return sizeof(sf::Event::KeyEvent);
+			case sf::Event::MouseWheelMoved:
+				return sizeof(sf::Event::MouseWheelEvent);
+			case sf::Event::MouseWheelScrolled:
+				return sizeof(sf::Event::MouseWheelScrollEvent);
+			case sf::Event::MouseButtonPressed:
+			case sf::Event::MouseButtonReleased:
+				return sizeof(sf::Event::MouseButtonEvent);
+			case sf::Event::MouseMoved:
+				return sizeof(sf::Event::MouseMoveEvent);
+			case sf::Event::JoystickButtonPressed:
+			case sf::Event::JoystickButtonReleased:
+				return sizeof(sf::Event::JoystickButtonEvent);
+			case sf::Event::JoystickMoved:
+				return sizeof(sf::Event::JoystickMoveEvent);
+			case sf::Event::JoystickConnected:
+			case sf::Event::JoystickDisconnected:
+				return sizeof(sf::Event::JoystickConnectEvent);
+			case sf::Event::TouchBegan:
+			case sf::Event::TouchMoved:
+			case sf::Event::TouchEnded:
+				return sizeof(sf::Event::TouchEvent);
+			case sf::Event::SensorChanged:
+				return sizeof(sf::Event::SensorEvent);
+			default:
+				// Closed, focus and mouse enter/leave events carry nothing
+				return 0;
+		}
+	}
+
+	// Appends Value 7 bits at a time, lowest first, with the high bit set on all but the last byte
+	void WriteVarint(std::vector<char>& Buffer, sf::Uint64 Value)
+	{
+		while (Value >= 0x80)
+		{
+			Buffer.push_back(static_cast<char>((Value & 0x7F) | 0x80));
+			Value >>= 7;
+		}
+		Buffer.push_back(static_cast<char>(Value));
+	}
+
+	bool ReadVarint(const char* Data, size_t DataSize, size_t& InOutOffset, sf::Uint64& OutValue)
+	{
+		OutValue = 0;
+		for (unsigned int Shift = 0; Shift < 64 && InOutOffset < DataSize; Shift += 7)
+		{
+			const sf::Uint8 Byte = static_cast<sf::Uint8>(Data[InOutOffset++]);
+			OutValue |= static_cast<sf::Uint64>(Byte & 0x7F) << Shift;
+			if ((Byte & 0x80) == 0)
+			{
+				return true;
+			}
+		}
+
+		return false;
+	}
+}
+
+FInputRecorder::FInputRecorder()
+	: _OutputFile(nullptr)
+	, _Buffer()
+	, _RecordingClock()
+	, _LastTickIndex(0)
+	, _LastMicroseconds(0)
+	, _NumRecordedEvents(0)
+{
+}
+
+FInputRecorder::~FInputRecorder()
+{
+	Stop();
+}
+
+bool FInputRecorder::Start(const std::string& FilePath, sf::Uint32 TickRate)
+{
+	check(TickRate > 0);
+	Stop();
+
+	errno_t ErrorCode = fopen_s(&_OutputFile, FilePath.c_str(), "wb");
+	if (ErrorCode != 0 || _OutputFile == nullptr)
+	{
+		GE_LOG(LogFileIO, Error, "Could not open %s to record input to. (Code: %d)", FilePath.c_str(), ErrorCode);
+		_OutputFile = nullptr;
+		return false;
+	}
+
+	_Buffer.clear();
+	_Buffer.resize(k_InputRecordingHeaderSize);
+	std::memcpy(_Buffer.data(), &k_InputRecordingMagic, sizeof(k_InputRecordingMagic));
+	std::memcpy(_Buffer.data() + sizeof(k_InputRecordingMagic), &k_InputRecordingVersion, sizeof(k_InputRecordingVersion));
+	std::memcpy(_Buffer.data() + sizeof(k_InputRecordingMagic) + sizeof(k_InputRecordingVersion), &TickRate, sizeof(TickRate));
+
+	_RecordingClock.restart();
+	_LastTickIndex = 0;
+	_LastMicroseconds = 0;
+	_NumRecordedEvents = 0;
+
+	GE_LOG(LogFileIO, Log, "Recording input to %s at %u ticks per second", FilePath.c_str(), TickRate);
+	return true;
+}
+
+void FInputRecorder::Stop()
+{
+	if (_OutputFile == nullptr)
+	{
+		return;
+	}
+
+	Flush();
+	std::fclose(_OutputFile);
+	_OutputFile = nullptr;
+
+	GE_LOG(LogFileIO, Log, "Recorded %zu input events.", _NumRecordedEvents);
+}
+
+void FInputRecorder::RecordEvent(const sf::Event& Event, sf::Uint64 TickIndex)
+{
+	if (_OutputFile == nullptr)
+	{
+		return;
+	}
+
+	check(TickIndex >= _LastTickIndex);
+
+	const sf::Int64 Microseconds = _RecordingClock.getElapsedTime().asMicroseconds();
+	WriteVarint(_Buffer, TickIndex - _LastTickIndex);
+	WriteVarint(_Buffer, static_cast<sf::Uint64>(Microseconds - _LastMicroseconds));
+	_LastTickIndex = TickIndex;
+	_LastMicroseconds = Microseconds;
+
+	_Buffer.push_back(static_cast<char>(Event.type));
+
+	// Every member of the event's union starts at the same address
+	const char* Payload = reinterpret_cast<const char*>(&Event.size);
+	_Buffer.insert(_Buffer.end(), Payload, Payload + GetEventPayloadSize(Event.type));
+
+	++_NumRecordedEvents;
+
+	if (_Buffer.size() >= k_RecorderFlushSize)
+	{
+		Flush();
+	}
+}
+
+void FInputRecorder::Flush()
+{
+	check(_OutputFile != nullptr);
+
+	if (!_Buffer.empty())
+	{
+		std::fwrite(_Buffer.data(), 1, _Buffer.size(), _OutputFile);
+		_Buffer.clear();
+	}
+}
+
+FInputReplayer::FInputReplayer()
+	: _File()
+	, _ReadOffset(0)
+	, _NextEvent()
+	, _NextTickIndex(0)
+	, _bHasNextEvent(false)
+	, _TickRate(0)
+{
+}
+
+bool FInputReplayer::Open(const std::string& FilePath)
+{
+	Close();
+
+	if (!_File.Open(FilePath))
+	{
+		GE_LOG(LogFileIO, Error, "Could not open input recording %s", FilePath.c_str());
+		return false;
+	}
+
+	sf::Uint32 Magic = 0;
+	sf::Uint16 Version = 0;
+	sf::Uint32 TickRate = 0;
+	if (_File.GetSize() >= k_InputRecordingHeaderSize)
+	{
+		std::memcpy(&Magic, _File.GetData(), sizeof(Magic));
+		std::memcpy(&Version, _File.GetData() + sizeof(Magic), sizeof(Version));
+		std::memcpy(&TickRate, _File.GetData() + sizeof(Magic) + sizeof(Version), sizeof(TickRate));
+	}
+
+	if (Magic != k_InputRecordingMagic || Version != k_InputRecordingVersion || TickRate == 0)
+	{
+		GE_LOG(LogFileIO, Error, "%s is not an input recording this build can replay.", FilePath.c_str());
+		Close();
+		return false;
+	}
+
+	_TickRate = TickRate;
+	_ReadOffset = k_InputRecordingHeaderSize;
+	_bHasNextEvent = ReadNextEvent();
+
+	GE_LOG(LogFileIO, Log, "Replaying input from %s at %u ticks per second", FilePath.c_str(), _TickRate);
+	return true;
+}
+
+void FInputReplayer::Close()
+{
+	_File.Close();
+	_ReadOffset = 0;
+	_NextTickIndex = 0;
+	_bHasNextEvent = false;
+	_TickRate = 0;
+}
+
+bool FInputReplayer::PollEvent(sf::Uint64 TickIndex, sf::Event& OutEvent)
+{
+	if (!_bHasNextEvent || _NextTickIndex > TickIndex)
+	{
+		return false;
+	}
+
+	OutEvent = _NextEvent;
+	_bHasNextEvent = ReadNextEvent();
+	return true;
+}
+
+bool FInputReplayer::ReadNextEvent()
+{
+	const char* Data = _File.GetData();
+	const size_t DataSize = _File.GetSize();
+	if (_ReadOffset >= DataSize)
+	{
+		return false;
+	}
+
+	sf::Uint64 TickDelta = 0;
+	sf::Uint64 MicrosecondDelta = 0;
+	if (!ReadVarint(Data, DataSize, _ReadOffset, TickDelta)
+		|| !ReadVarint(Data, DataSize, _ReadOffset, MicrosecondDelta)
+		|| _ReadOffset >= DataSize)
+	{
+		GE_LOG(LogFileIO, Warning, "Input recording ends partway through an event, stopping the replay.");
+		return false;
+	}
+
+	const sf::Event::EventType EventType = static_cast<sf::Event::EventType>(static_cast<sf::Uint8>(Data[_ReadOffset++]));
+	const size_t PayloadSize = GetEventPayloadSize(EventType);
+	if (EventType >= sf::Event::Count || _ReadOffset + PayloadSize > DataSize)
+	{
+		GE_LOG(LogFileIO, Warning, "Input recording ends partway through an event, stopping the replay.");
+		return false;
+	}
+
+	_NextEvent = sf::Event();
+	_NextEvent.type = EventType;
+	std::memcpy(reinterpret_cast<char*>(&_NextEvent.size), Data + _ReadOffset, PayloadSize);
+	_ReadOffset += PayloadSize;
+
+	_NextTickIndex += TickDelta;
+	return true;
+}
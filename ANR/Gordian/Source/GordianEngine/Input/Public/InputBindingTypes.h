@@ -30,6 +30,31 @@ enum class EDigitalEventType : sf::Uint8
 	MAX_VALUE
 };
 
+// Every analog input is aggregated into one of these each frame.
+//	Gamepad axes follow sf::Joystick::Axis and hold the latest value from any gamepad.
+enum class EAnalogAxis : sf::Uint8
+{
+	// Cursor position, in pixels from the window's top left corner
+	MouseX,
+	MouseY,
+	// Wheels have no position, so their value counts notches scrolled since startup
+	MouseWheel,
+	MouseHorizontalWheel,
+	// Stick and trigger positions, from -1 to 1
+	Gamepad_X,
+	Gamepad_Y,
+	Gamepad_Z,
+	Gamepad_R,
+	Gamepad_U,
+	Gamepad_V,
+	Gamepad_PovX,
+	Gamepad_PovY,
+	// Position of the first finger down, in pixels from the window's top left corner
+	TouchX,
+	TouchY,
+	MAX_VALUE
+};
+
 using FCommand = std::string;
 
 
@@ -0,0 +1,21 @@
+// Gordian by Daniel Luna (2019)
+
+#pragma once
+
+#include "SFML/Config.hpp"
+
+namespace Gordian
+{
+
+
+// Posted to the event bus when the mouse moves over the window.
+//	Only the last move of each frame is dispatched.
+struct FMouseMovedEvent
+{
+	// Position relative to the window's top left corner, in pixels
+	sf::Int32 X;
+	sf::Int32 Y;
+};
+
+
+};
@@ -79,6 +79,15 @@ public:
 
 	bool IsValid() const;
 
+	// Keys of every type packed one after another, so each has its own index
+	static constexpr sf::Uint32 KeyIndexCount = sf::Keyboard::KeyCount
+											  + sf::Mouse::ButtonCount
+											  + sf::Joystick::ButtonCount;
+
+	// Returns an index in [0, KeyIndexCount) unique to this key, for use in lookup tables.
+	//	Returns KeyIndexCount for unknown keys.
+	sf::Uint32 GetKeyIndex() const;
+
 private:
 	
 	InputKeys::EInputKeyTypes _KeyType;
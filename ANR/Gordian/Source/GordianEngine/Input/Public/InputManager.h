@@ -2,16 +2,18 @@
 
 #pragma once
 
+#include <array>
 #include <cassert>
-#include <list>
 #include <map>
 #include <memory>
 #include <set>
 #include <string>
+#include <vector>
 
 #include <SFML/Window/Event.hpp>
 
 #include "InputBindingTypes.h"
+#include "InputRecording.h"
 #include "GordianEngine/Core/Public/Object.h"
 #include "GordianEngine/Delegates/MulticastDelegate.h"
 #include "GordianEngine/Debug/Public/Asserts.h"
@@ -21,18 +23,45 @@ namespace Gordian
 
 
 using DigitalDelegate = multicast_delegate<void(void)>;
+// Called with an axis' latest value and how much it changed since the last broadcast
+using AnalogDelegate = multicast_delegate<void(float, float)>;
 
 // Translates raw SFML input events to Commands that are then broadcasted via delegates
 class FInputManager
 {
 public:
 	FInputManager();
+	~FInputManager();
 
 	// Temp static fn for finding an input handler.
 	static FInputManager* Get();
 
+	// Commands triggered by EventData are posted to FEventBus, and broadcast when it next dispatches.
+	//	Analog input is only aggregated, and broadcast by BroadcastAnalogInput.
 	void HandleWindowEvent(sf::Event& EventData);
 
+	// Calls each analog axis' delegate once with everything handled since the last call.
+	//	Axes that have not moved are skipped.
+	void BroadcastAnalogInput();
+
+	inline float GetAxisValue(EAnalogAxis Axis) const
+	{
+		return _AnalogAxisStates[static_cast<size_t>(Axis)].Value;
+	}
+
+	// Tells the manager which tick the events it handles arrive before, so recordings can be replayed in step
+	inline void SetCurrentTickIndex(sf::Uint64 TickIndex)
+	{
+		_CurrentTickIndex = TickIndex;
+	}
+
+	// Starts writing every handled event to FilePath, tagged with the tick rate they are handled at.
+	//	Returns false if the file could not be opened.
+	bool StartRecording(const std::string& FilePath, sf::Uint32 TickRate);
+
+	// Finishes writing the current recording, if there is one
+	void StopRecording();
+
 	// Bind to a digital command using a const member function
 	template <class T, void(T::*TMethod)() const>
 	inline bool BindToDigitalCommand(const FCommand& CommandToBind,
@@ -50,10 +79,41 @@ public:
 	inline bool BindToDigitalCommand(const FCommand& CommandToBind,
 									 const EDigitalEventType& EventType);
 
+	// Bind to an analog axis using a const member function
+	template <class T, void(T::*TMethod)(float, float) const>
+	inline void BindToAnalogAxis(EAnalogAxis Axis, const T* ObjectToBindTo);
+
+	// Bind to an analog axis using a non-const member function
+	template <class T, void(T::*TMethod)(float, float)>
+	inline void BindToAnalogAxis(EAnalogAxis Axis, T* ObjectToBindTo);
+
+	// Bind to an analog axis using a non-member function
+	template <void(*TMethod)(float, float)>
+	inline void BindToAnalogAxis(EAnalogAxis Axis);
+
 private:
 
 	static FInputManager* Singleton;
 
+	// Number of distinct combinations of held combo keys
+	static constexpr size_t k_NumComboKeyStates = size_t(1) << static_cast<size_t>(EComboKey::MAX_VALUE);
+
+	struct FDigitalBroadcaster
+	{
+		DigitalDelegate OnPressed;
+		DigitalDelegate OnReleased;
+	};
+
+	// Posted for each triggered command, so its delegates are broadcast with the rest of the frame's events
+	struct FDigitalCommandEvent
+	{
+		const FInputManager* InputManager;
+		FDigitalBroadcaster* Broadcaster;
+		EDigitalEventType EventType;
+	};
+
+	void OnDigitalCommandEvent(const FDigitalCommandEvent& Event);
+
 	// Given a generic key, returns commands to trigger.
 	// Loaded from an ini file
 	std::set<FDigitalBinding> DigitalBindingSet;
@@ -61,6 +121,7 @@ private:
 	// Runtime state of all combo keys
 	TBitSet<EComboKey> _DigitalComboKeyState;
 
+	// Creates a broadcaster per command and compiles the binding table from DigitalBindingSet
 	void GenerateCommandDelegates();
 
 	// Call when key state might have changed. Do not pass in non-key sf::events.
@@ -71,20 +132,55 @@ private:
 	bool IsDigitalEvent(const sf::Event& EventData) const;
 	EDigitalEventType GetDigitalEventType(const sf::Event& EventData) const;
 
-	void TriggerDigitalCommand(const FCommand& CommandToTrigger, EDigitalEventType EventType);
+	// Adds Delegate to the broadcaster of CommandToBind. Returns false if no binding triggers that command.
+	bool AddDigitalDelegate(const FCommand& CommandToBind,
+							const EDigitalEventType& EventType,
+							const delegate<void()>& Delegate);
 
-	struct FDigitalBroadcaster
-	{
-		// Defined so an empty initializer list can be used to emplace this into maps
-		FDigitalBroadcaster(int) {}
+	// Owns one broadcaster per bound command. Only searched when binding to a command.
+	std::map<FCommand, std::unique_ptr<FDigitalBroadcaster>> _DigitalCommandDelegates;
 
-		DigitalDelegate OnPressed;
-		DigitalDelegate OnReleased;
+	// The broadcaster each key triggers under each combo key state, or nullptr if none.
+	//	Indexed by KeyIndex * k_NumComboKeyStates + the combo key state's bits.
+	std::vector<FDigitalBroadcaster*> _DigitalBindingTable;
+
+	// The broadcaster each held key was pressed into, so releasing the key reaches the same one
+	//	even if combo keys changed while it was held. Indexed by KeyIndex.
+	std::vector<FDigitalBroadcaster*> _PressedBroadcasters;
+
+	static constexpr size_t k_NumAnalogAxes = static_cast<size_t>(EAnalogAxis::MAX_VALUE);
+
+	struct FAnalogAxisState
+	{
+		float Value;
+		// Sum of changes since the last broadcast
+		float Delta;
+		bool bHasChanged;
+		// False until the axis first reports a position, which is not counted as a change
+		bool bHasPosition;
 	};
 
-	// Maps commands to the delegates they fire.
-	std::map<FCommand, std::shared_ptr<FDigitalBroadcaster>> _DigitalCommandDelegates;
-	std::map<FCommand, std::shared_ptr<int>> _A;
+	void HandleAnalogEvent(const sf::Event& EventData);
+
+	// Moves an axis that reports positions, adding the change to its delta.
+	//	The first position an axis reports only places it.
+	void MoveAnalogAxis(EAnalogAxis Axis, float Value);
+
+	// Moves an axis that reports changes
+	void OffsetAnalogAxis(EAnalogAxis Axis, float Delta);
+
+	// Moves an axis without counting it as a change, such as a finger landing somewhere new
+	void PlaceAnalogAxis(EAnalogAxis Axis, float Value);
+
+	// Indexed by EAnalogAxis
+	std::array<FAnalogAxisState, k_NumAnalogAxes> _AnalogAxisStates;
+	std::array<AnalogDelegate, k_NumAnalogAxes> _AnalogAxisDelegates;
+
+	// Records handled events while recording
+	FInputRecorder _InputRecorder;
+
+	// Tick the events being handled arrive before
+	sf::Uint64 _CurrentTickIndex;
 
 	bool _bHasGeneratedDelegateMap;
 };
@@ -0,0 +1,117 @@
+// Gordian by Daniel Luna (2019)
+
+#pragma once
+
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include "SFML/System/Clock.hpp"
+#include "SFML/System/NonCopyable.hpp"
+#include "SFML/Window/Event.hpp"
+
+#include "GordianEngine/FileIO/Public/MappedFile.h"
+
+namespace Gordian
+{
+
+
+// Input recordings start with a u32 magic, a u16 version and the u32 tick rate they were recorded at,
+//	followed by one record per event:
+//	a varint of ticks since the previous event, a varint of microseconds since the previous event,
+//	a u8 sf::Event::EventType, then the raw bytes of the event member that type uses.
+//	Recordings are only meant to be replayed by the build that made them.
+
+// Writes the events handed to the input manager to a file, tagged with the tick they arrived before
+class FInputRecorder : sf::NonCopyable
+{
+public:
+
+	FInputRecorder();
+	~FInputRecorder();
+
+	// Starts recording to FilePath, replacing anything already there.
+	//	TickRate must stay the same for the whole recording, so ticks mean the same thing when replayed.
+	//	Returns false if the file could not be opened.
+	bool Start(const std::string& FilePath, sf::Uint32 TickRate);
+
+	// Writes out any buffered events and closes the file
+	void Stop();
+
+	inline bool IsRecording() const
+	{
+		return _OutputFile != nullptr;
+	}
+
+	// Records Event as arriving before tick TickIndex is simulated. Ticks must not go backwards.
+	void RecordEvent(const sf::Event& Event, sf::Uint64 TickIndex);
+
+	inline size_t GetNumRecordedEvents() const
+	{
+		return _NumRecordedEvents;
+	}
+
+private:
+
+	// Writes buffered records to the file
+	void Flush();
+
+	std::FILE* _OutputFile;
+	// Records waiting to be written
+	std::vector<char> _Buffer;
+
+	// Started with the recording, used to timestamp events
+	sf::Clock _RecordingClock;
+	sf::Uint64 _LastTickIndex;
+	sf::Int64 _LastMicroseconds;
+
+	size_t _NumRecordedEvents;
+};
+
+
+// Plays back a file written by FInputRecorder, handing out each event before the tick it was recorded at
+class FInputReplayer : sf::NonCopyable
+{
+public:
+
+	FInputReplayer();
+
+	// Starts replaying FilePath. Returns false if it could not be read or is not a recording.
+	bool Open(const std::string& FilePath);
+
+	void Close();
+
+	// True from a successful Open until every event has been handed out
+	inline bool IsReplaying() const
+	{
+		return _bHasNextEvent;
+	}
+
+	// Ticks per second the recording was made at. Replays must tick at the same rate.
+	inline sf::Uint32 GetTickRate() const
+	{
+		return _TickRate;
+	}
+
+	// Fetches the next event recorded on or before tick TickIndex.
+	//	Returns false once no more are due, so it can be polled like a window.
+	bool PollEvent(sf::Uint64 TickIndex, sf::Event& OutEvent);
+
+private:
+
+	// Decodes the record at the read offset into the next event. Returns false at the end of the file.
+	bool ReadNextEvent();
+
+	FMappedFile _File;
+	size_t _ReadOffset;
+
+	// Timestamps are only there for tools, replays go by tick
+	sf::Event _NextEvent;
+	sf::Uint64 _NextTickIndex;
+	bool _bHasNextEvent;
+
+	sf::Uint32 _TickRate;
+};
+
+
+};
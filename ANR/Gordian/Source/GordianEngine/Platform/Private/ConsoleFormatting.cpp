@@ -12,7 +12,7 @@ using namespace Gordian;
 
 FScopedConsoleFormat FConsoleFormatting::DefaultFormat;
 const FScopedConsoleFormat* FConsoleFormatting::CurrentScopeFormat = nullptr;
-bool FConsoleFormatting::bHasInitializedFormatting = false;
+std::atomic<bool> FConsoleFormatting::bHasInitializedFormatting(false);
 
 // Formatting comes from these docs:
 // https://docs.microsoft.com/en-us/windows/console/console-virtual-terminal-sequences
@@ -29,6 +29,9 @@ namespace
 //////////////////////////////////////////////////////////////////////////////////
 
 FScopedConsoleFormat::FScopedConsoleFormat()
+	: _TextColorOverride()
+	, _FormatOverrides()
+	, _PreviousScopeFormat(nullptr)
 {
 
 }
@@ -254,6 +257,11 @@ FScopedConsoleFormat::~FScopedConsoleFormat()
 	return 0;
 }
 
+/*static*/ bool FConsoleFormatting::IsInitialized()
+{
+	return bHasInitializedFormatting;
+}
+
 /*static*/ void FConsoleFormatting::GetColorString(char* OutFormat, EConsoleColor NewTextColor)
 {
 	check(bHasInitializedFormatting);
@@ -2,6 +2,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <map>
 
 #include <SFML/System/NonCopyable.hpp>
@@ -96,6 +97,9 @@ public:
 	// Returns 0 if we were able to successfully initialize
 	static int InitializeFormatting();
 
+	// Returns true once InitializeFormatting has succeeded
+	static bool IsInitialized();
+
 	// Fills the InOutBuffer with a format string that sets text foreground color
 	static void GetColorString(char* OutFormat, EConsoleColor NewTextColor);
 
@@ -129,7 +133,8 @@ private:
 	// Reference to the current scope's format
 	static const FScopedConsoleFormat* CurrentScopeFormat;
 	// Denotes whether or not console formatting has successfully initialized
-	static bool bHasInitializedFormatting;
+	// Atomic since the log writer thread checks it
+	static std::atomic<bool> bHasInitializedFormatting;
 };
 
 
@@ -87,6 +87,49 @@ OType* GetPrimitiveDescriptor<int>()
 }
 
 
+//////////////////////////////////////////////////////////////
+// Type Info for floating point numbers
+//////////////////////////////////////////////////////////////
+
+class OType_Float : public OType
+{
+public:
+	OType_Float() : OType{ "float", sizeof(float) } {}
+
+protected:
+	virtual void Dump_Internal(const void* Data, size_t MaxDumpDepth, int, bool) const override
+	{
+		std::clog << "float {" << *(static_cast<const float*>(Data)) << "}";
+	}
+};
+
+template<>
+OType* GetPrimitiveDescriptor<float>()
+{
+	static OType_Float TypeDescription;
+	return &TypeDescription;
+}
+
+class OType_Double : public OType
+{
+public:
+	OType_Double() : OType{ "double", sizeof(double) } {}
+
+protected:
+	virtual void Dump_Internal(const void* Data, size_t MaxDumpDepth, int, bool) const override
+	{
+		std::clog << "double {" << *(static_cast<const double*>(Data)) << "}";
+	}
+};
+
+template<>
+OType* GetPrimitiveDescriptor<double>()
+{
+	static OType_Double TypeDescription;
+	return &TypeDescription;
+}
+
+
 //////////////////////////////////////////////////////////////
 // Type info for std::strings
 //////////////////////////////////////////////////////////////
@@ -2,14 +2,45 @@
 
 #include "GordianEngine/Reflection/Public/Type_Struct.h"
 
+#include <cstring>
 #include <iostream>
+#include <mutex>
 #include <string>
+#include <utility>
 
 #include "GordianEngine/Core/Public/Object.h"
 #include "GordianEngine/Debug/Public/Asserts.h"
+#include "GordianEngine/GlobalLibraries/Public/GlobalObjectLibrary.h"
+#include "GordianEngine/Utility/Public/StringUtility.h"
 
 using namespace Gordian;
 
+namespace
+{
+	// Marks an empty slot in the member index
+	const sf::Int32 k_EmptyIndexSlot = -1;
+
+	// Held while class ids are assigned.
+	// Function local so types can be declared during static initialization.
+	std::mutex& GetClassIdMutex()
+	{
+		static std::mutex ClassIdMutex;
+		return ClassIdMutex;
+	}
+
+	// Every struct type declared with an initialize function
+	std::vector<OType_Struct*>& GetDeclaredStructTypes()
+	{
+		static std::vector<OType_Struct*> DeclaredStructTypes;
+		return DeclaredStructTypes;
+	}
+
+	// Types partway through their initialize function. Their parents may not be known yet.
+	std::atomic<int> GNumTypesInitializing(0);
+}
+
+std::atomic<bool> OType_Struct::_bHasClassIds(false);
+
 FStructMember OType_Struct::NullMember{};
 
 OType_Struct::OType_Struct()
@@ -19,11 +50,14 @@ OType_Struct::OType_Struct()
 	, ClassDepth(0)
 	, _InitializationState(EInitializationState::Uninitialized)
 	, _InitializeFunc(nullptr)
+	, _ObjectConstructor(nullptr)
+	, _ClassIdBegin(0)
+	, _ClassIdEnd(0)
 {
 	bIsStructType = true;
 }
 
-OType_Struct::OType_Struct(void(*Initialize)(OType_Struct*))
+OType_Struct::OType_Struct(void(*Initialize)(OType_Struct*), const char* Name)
 	: OType_Struct()
 {
 	bIsStructType = true;
@@ -31,6 +65,12 @@ OType_Struct::OType_Struct(void(*Initialize)(OType_Struct*))
 	check(Initialize != nullptr);
 
 	_InitializeFunc = Initialize;
+
+	// Named now rather than on initialization, so the type can be looked up before it is used
+	SetName(Name);
+	FGlobalObjectLibrary::RegisterType(this);
+
+	GetDeclaredStructTypes().push_back(this);
 }
 
 void OType_Struct::EnsureInitialization() const
@@ -48,15 +88,179 @@ void OType_Struct::EnsureInitialization() const
 void OType_Struct::_InternalInitialize()
 {
 	_InitializationState = EInitializationState::MidInitialization;
+	++GNumTypesInitializing;
 
 	_InitializeFunc(this);
 
+	BuildMemberIndex();
+
+	--GNumTypesInitializing;
 	_InitializationState = EInitializationState::FullyInitialized;
 
 	_InitializeFunc = nullptr;
 }
 
-bool OType_Struct::IsChildClassOf(const OType_Struct* PossibleParent) const
+void OType_Struct::BuildMemberIndex()
+{
+	// Keep the table at most half full so probes stay short
+	size_t IndexSize = 1;
+	while (IndexSize < Members.size() * 2)
+	{
+		IndexSize <<= 1;
+	}
+
+	_MemberHashes.clear();
+	_MemberHashes.reserve(Members.size());
+	_MemberIndex.assign(IndexSize, k_EmptyIndexSlot);
+	_MemberLayout.clear();
+	_MemberLayout.reserve(Members.size());
+
+	const size_t IndexMask = IndexSize - 1;
+	for (size_t MemberIndex = 0; MemberIndex < Members.size(); ++MemberIndex)
+	{
+		const FStructMember& Member = Members[MemberIndex];
+		const sf::Uint32 Hash = FStringUtil::HashString(Member.Name);
+		_MemberHashes.push_back(Hash);
+		_MemberLayout.push_back(FMemberLayout{ static_cast<sf::Uint32>(Member.Offset),
+											   static_cast<sf::Uint32>(Member.Type != nullptr ? Member.Type->GetSize() : 0),
+											   Member.Type });
+
+		size_t Slot = Hash & IndexMask;
+		while (_MemberIndex[Slot] != k_EmptyIndexSlot)
+		{
+			const sf::Int32 ExistingIndex = _MemberIndex[Slot];
+			if (_MemberHashes[ExistingIndex] == Hash
+				&& std::strcmp(Members[ExistingIndex].Name, Member.Name) == 0)
+			{
+				// Lookups return the first member with a name, so leave the original
+				break;
+			}
+
+			Slot = (Slot + 1) & IndexMask;
+		}
+
+		if (_MemberIndex[Slot] == k_EmptyIndexSlot)
+		{
+			_MemberIndex[Slot] = static_cast<sf::Int32>(MemberIndex);
+		}
+	}
+}
+
+const FStructMember* OType_Struct::GetMember(const char* MemberName) const
+{
+	if (_InitializationState != EInitializationState::FullyInitialized)
+	{
+		return FindMemberLinear(MemberName);
+	}
+
+	const sf::Uint32 Hash = FStringUtil::HashString(MemberName);
+	const size_t IndexMask = _MemberIndex.size() - 1;
+
+	// The table always has empty slots, so this ends
+	for (size_t Slot = Hash & IndexMask; _MemberIndex[Slot] != k_EmptyIndexSlot; Slot = (Slot + 1) & IndexMask)
+	{
+		const sf::Int32 MemberIndex = _MemberIndex[Slot];
+		if (_MemberHashes[MemberIndex] == Hash
+			&& std::strcmp(Members[MemberIndex].Name, MemberName) == 0)
+		{
+			return &Members[MemberIndex];
+		}
+	}
+
+	return nullptr;
+}
+
+bool OType_Struct::DoesMemberExist(const char* MemberName) const
+{
+	return GetMember(MemberName) != nullptr;
+}
+
+const FStructMember* OType_Struct::FindMemberLinear(const char* MemberName) const
+{
+	for (const FStructMember& Member : Members)
+	{
+		if (std::strcmp(MemberName, Member.Name) == 0)
+		{
+			return &Member;
+		}
+	}
+
+	return nullptr;
+}
+
+/*static*/ bool OType_Struct::AssignClassIds()
+{
+	// Parent checks made while a type initializes can't wait for every parent to be known
+	if (GNumTypesInitializing.load() > 0)
+	{
+		return false;
+	}
+
+	// Another thread is assigning ids, so walk parents until it is done
+	std::unique_lock<std::mutex> Lock(GetClassIdMutex(), std::try_to_lock);
+	if (!Lock.owns_lock())
+	{
+		return false;
+	}
+
+	if (_bHasClassIds.load(std::memory_order_relaxed))
+	{
+		return true;
+	}
+
+	// Parents are only known once a type is initialized. Initializing may declare more
+	//	types, so the list is walked by index.
+	std::vector<OType_Struct*>& DeclaredStructTypes = GetDeclaredStructTypes();
+	for (size_t TypeIndex = 0; TypeIndex < DeclaredStructTypes.size(); ++TypeIndex)
+	{
+		DeclaredStructTypes[TypeIndex]->EnsureInitialization();
+	}
+
+	std::vector<OType_Struct*> RootClasses;
+	for (OType_Struct* DeclaredType : DeclaredStructTypes)
+	{
+		if (DeclaredType->ParentClass != nullptr)
+		{
+			const_cast<OType_Struct*>(DeclaredType->ParentClass)->_ChildClasses.push_back(DeclaredType);
+		}
+		else
+		{
+			RootClasses.push_back(DeclaredType);
+		}
+	}
+
+	// Number every class in pre-order, so each subtree gets a contiguous range of ids
+	sf::Uint32 NextClassId = 0;
+	std::vector<std::pair<OType_Struct*, size_t>> VisitStack;
+	for (OType_Struct* RootClass : RootClasses)
+	{
+		RootClass->_ClassIdBegin = NextClassId++;
+		VisitStack.emplace_back(RootClass, 0);
+
+		while (!VisitStack.empty())
+		{
+			OType_Struct* VisitedClass = VisitStack.back().first;
+			const size_t ChildIndex = VisitStack.back().second++;
+
+			if (ChildIndex < VisitedClass->_ChildClasses.size())
+			{
+				OType_Struct* ChildClass = VisitedClass->_ChildClasses[ChildIndex];
+				ChildClass->_ClassIdBegin = NextClassId++;
+				VisitStack.emplace_back(ChildClass, 0);
+			}
+			else
+			{
+				VisitedClass->_ClassIdEnd = NextClassId;
+				VisitStack.pop_back();
+			}
+		}
+	}
+
+	_bHasClassIds.store(true, std::memory_order_release);
+	return true;
+}
+
+bool OType_Struct::IsChildClassOfByParentWalk(const OType_Struct* PossibleParent) const
 {
 	const OType_Struct* CurrentClass = this;
 	unsigned int PossibleParentDepth = PossibleParent->ClassDepth;
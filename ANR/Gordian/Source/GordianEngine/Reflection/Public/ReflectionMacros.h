@@ -38,7 +38,7 @@ public:																					\
 
 //	Starts a Reflection Chunk. Should be followed by *_END()
 #define RSTRUCT_MEMBER_BEGIN(STRUCT)										\
-	__RSTRUCT_TYPE __RSTRUCT_MEMBER_STATIC{STRUCT::__RSTRUCT_FN_INIT};		\
+	__RSTRUCT_TYPE __RSTRUCT_MEMBER_STATIC{STRUCT::__RSTRUCT_FN_INIT, #STRUCT};	\
 																			\
 	void STRUCT::__RSTRUCT_FN_INIT(__RSTRUCT_TYPE* TypeDesc)				\
 	{																		\
@@ -100,13 +100,14 @@ public:																					\
 
 //	Starts a Reflection Member Chunk.
 #define RCLASS_INITIALIZE(CLASS)											\
-	__RCLASS_TYPE CLASS::__RCLASS_MEMBER_STATIC(CLASS::__RCLASS_FN_INIT);	\
+	__RCLASS_TYPE CLASS::__RCLASS_MEMBER_STATIC(CLASS::__RCLASS_FN_INIT, #CLASS);	\
 	void CLASS::__RCLASS_FN_INIT(__RCLASS_TYPE* TypeDesc)					\
 	{																		\
 		using T = CLASS;													\
 		TypeDesc->SetName(#CLASS);											\
 		TypeDesc->SetSize(sizeof(T));										\
 		TypeDesc->SetParentClass<T::Parent>((T::Parent*) nullptr);			\
+		TypeDesc->SetObjectConstructor<T>();								\
 
 //	Used to define a reflection chunk that contains no new members or functions
 #define RCLASS_INITIALIZE_EMPTY(CLASS)										\
@@ -2,6 +2,8 @@
 
 #pragma once
 
+#include <SFML/Config.hpp>
+
 namespace Gordian
 {
 
@@ -16,5 +18,14 @@ struct FStructMember
 	const OType* Type;
 };
 
+// Flattened view of a member's placement, for code that walks every member of a type
+struct FMemberLayout
+{
+	sf::Uint32 Offset;
+	// Copied out of Type so walking the layout does not need to touch it
+	sf::Uint32 Size;
+	const OType* Type;
+};
+
 
 };
@@ -94,6 +94,36 @@ public:
 			const std::vector<ItemType>& VectorData = *(const std::vector<ItemType>*) VectorPtr;
 			return &VectorData.at(Index);
 		};
+		GetMutableItem = [](void* VectorPtr, size_t Index) -> void*
+		{
+			std::vector<ItemType>& VectorData = *(std::vector<ItemType>*) VectorPtr;
+			return &VectorData.at(Index);
+		};
+		Resize = [](void* VectorPtr, size_t NewSize)
+		{
+			std::vector<ItemType>& VectorData = *(std::vector<ItemType>*) VectorPtr;
+			VectorData.resize(NewSize);
+		};
+	}
+
+	// Gets the number of items in the vector at VectorPtr
+	inline size_t GetNumItems(const void* VectorPtr) const
+	{
+		return GetSize(VectorPtr);
+	}
+	// Gets the item at Index of the vector at VectorPtr. Items are contiguous.
+	inline const void* GetItemData(const void* VectorPtr, size_t Index) const
+	{
+		return GetItem(VectorPtr, Index);
+	}
+	inline void* GetMutableItemData(void* VectorPtr, size_t Index) const
+	{
+		return GetMutableItem(VectorPtr, Index);
+	}
+	// Resizes the vector at VectorPtr, default constructing any new items
+	inline void ResizeItems(void* VectorPtr, size_t NewSize) const
+	{
+		Resize(VectorPtr, NewSize);
 	}
 
 	virtual std::string GetFullName() const override
@@ -141,6 +171,8 @@ protected:
 	const OType* ItemType;
 	size_t(*GetSize)(const void*);
 	const void* (*GetItem)(const void*, size_t);
+	void* (*GetMutableItem)(void*, size_t);
+	void(*Resize)(void*, size_t);
 	const size_t k_MaxItemDisplayCount = 5;
 
 };
@@ -20,7 +20,7 @@ typename std::enable_if<!std::is_pointer<T>::value, OType*>::type GetPrimitiveDe
 // Deduces FTypes
 struct FDefaultTypeResolver
 {
-	template<typename T> static char func(decltype(T::__RSTRUCT_MEMBER_STATIC));
+	template<typename T> static char func(decltype(&T::__RSTRUCT_MEMBER_STATIC));
 	template<typename T> static int func(...);
 	template<typename T>
 	struct IsReflected
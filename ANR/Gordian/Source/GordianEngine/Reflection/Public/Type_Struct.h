@@ -4,6 +4,9 @@
 
 #include "Type.h"
 
+#include <atomic>
+#include <new>
+#include <string>
 #include <vector>
 
 #include "StructMember.h"
@@ -24,7 +27,8 @@ public:
 	static FStructMember NullMember;
 
 	OType_Struct();
-	OType_Struct(void(*Initialize)(OType_Struct*));
+	// Registers the type under Name with FGlobalObjectLibrary, so it can be found before it is initialized
+	OType_Struct(void(*Initialize)(OType_Struct*), const char* Name);
 
 	// Ensures this has been initialized
 	// Uses const cast to avoid const issues
@@ -70,6 +74,36 @@ public:
 	}
 
 
+	// Lets objects of this type be built from the type alone, as long as T can be
+	//	constructed like any other object. Abstract classes and ones with their own
+	//	constructor signatures are left unconstructable.
+	template<typename T>
+	void SetObjectConstructor()
+	{
+		if constexpr (!std::is_abstract<T>::value
+					  && std::is_base_of<OObject, T>::value
+					  && std::is_constructible<T, const std::string&, OObject*>::value)
+		{
+			_ObjectConstructor = [](void* Memory, const std::string& Name, OObject* OwningObject) -> OObject*
+			{
+				return new (Memory) T(Name, OwningObject);
+			};
+		}
+	}
+
+	// Returns true if ConstructObject can be used with this type
+	inline bool CanConstructObjects() const
+	{
+		return _ObjectConstructor != nullptr;
+	}
+
+	// Constructs an object of this type in Memory, which must be at least GetSize() bytes
+	inline OObject* ConstructObject(void* Memory, const std::string& Name, OObject* OwningObject) const
+	{
+		check(_ObjectConstructor != nullptr);
+		return _ObjectConstructor(Memory, Name, OwningObject);
+	}
+
 	// Adds non-inherited members to class
 	inline void DeclareMembers(const std::initializer_list<FStructMember>& InMembers)
 	{
@@ -81,35 +115,22 @@ public:
 		return Members;
 	}
 	// Returns the first member with the given name
-	inline const FStructMember* GetMember(const char* MemberName) const
-	{
-		for (const FStructMember& Member : Members)
-		{
-			if (std::strcmp(MemberName, Member.Name) == 0)
-			{
-				return &Member;
-			}
-		}
-
-		return nullptr;
-	}
+	const FStructMember* GetMember(const char* MemberName) const;
 	// Returns true if a member with the given name exists
-	inline bool DoesMemberExist(const char* MemberName) const
+	bool DoesMemberExist(const char* MemberName) const;
+	// Returns the offset, size and type of every member, in the same order as GetMembers.
+	//	Empty until this type is fully initialized.
+	inline const std::vector<FMemberLayout>& GetMemberLayout() const
 	{
-		for (const FStructMember& Member : Members)
-		{
-			if (std::strcmp(MemberName, Member.Name) == 0)
-			{
-				return true;
-			}
-		}
-
-		return false;
+		return _MemberLayout;
 	}
 
 	// Returns true if this class is a child of PossibleParent or if they 
 	//	are the same class.
-	virtual bool IsChildClassOf(const OType_Struct* PossibleParent) const override;
+	// Compares class ids instead of walking parents. The first check assigns them.
+	virtual bool IsChildClassOf(const OType_Struct* PossibleParent) const override final;
+	// Answers IsChildClassOf by walking parents. IsChildClassOf falls back to this for types without class ids.
+	bool IsChildClassOfByParentWalk(const OType_Struct* PossibleParent) const;
 
 	// Gets the parent type. Prefer to AttemptToGetParentType where possible.
 	inline const OType_Struct* GetParentType() const
@@ -153,9 +174,54 @@ private:
 
 	void(*_InitializeFunc)(OType_Struct*);
 
+	// Builds an object of this type in place, if it can be built from just a name and owner
+	OObject*(*_ObjectConstructor)(void*, const std::string&, OObject*);
+
 	// Private Initialization Method
 	void _InternalInitialize();
+
+	// Builds the member name index and layout once all members are known
+	void BuildMemberIndex();
+
+	// Initializes every declared struct type and gives each one its class ids. Only runs once,
+	//	returning false if it can't yet, such as while a type is initializing.
+	static bool AssignClassIds();
+
+	// Scans Members for a name. Used before the index is built.
+	const FStructMember* FindMemberLinear(const char* MemberName) const;
+
+	// Name hash of each member, matching Members
+	std::vector<sf::Uint32> _MemberHashes;
+	// Open addressing table of indices into Members. Size is a power of two.
+	std::vector<sf::Int32> _MemberIndex;
+
+	std::vector<FMemberLayout> _MemberLayout;
+
+	// Classes that name this as their parent. Filled in when class ids are assigned.
+	std::vector<OType_Struct*> _ChildClasses;
+
+	// Pre-order position of this class in the hierarchy. Every child class has an id
+	//	in [_ClassIdBegin, _ClassIdEnd), so a parent check is two compares.
+	//	_ClassIdEnd stays 0 for classes declared after ids were assigned.
+	sf::Uint32 _ClassIdBegin;
+	sf::Uint32 _ClassIdEnd;
+
+	// Set once class ids are assigned. They never change after that.
+	static std::atomic<bool> _bHasClassIds;
 };
 
 
+inline bool OType_Struct::IsChildClassOf(const OType_Struct* PossibleParent) const
+{
+	if ((_bHasClassIds.load(std::memory_order_acquire) || AssignClassIds())
+		&& _ClassIdEnd != 0
+		&& PossibleParent->_ClassIdEnd != 0)
+	{
+		return PossibleParent->_ClassIdBegin <= _ClassIdBegin && _ClassIdBegin < PossibleParent->_ClassIdEnd;
+	}
+
+	return IsChildClassOfByParentWalk(PossibleParent);
+}
+
+
 };	// namespace Gordian
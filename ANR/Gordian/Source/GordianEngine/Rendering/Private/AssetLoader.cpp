@@ -0,0 +1,181 @@
+// Gordian by Daniel Luna (2019)
+
+#include "GordianEngine/Rendering/Public/AssetLoader.h"
+
+#include <algorithm>
+#include <iterator>
+
+#include "GordianEngine/Debug/Public/Asserts.h"
+#include "GordianEngine/Debug/Public/Logging.h"
+
+using namespace Gordian;
+
+FAssetLoader::FAssetLoader()
+	: _LoaderThreads{}
+	, _QueuedRequests()
+	, _DecodedRequests()
+	, _NumDecoding(0)
+	, _bIsStopping(false)
+{
+}
+
+FAssetLoader::~FAssetLoader()
+{
+	Stop();
+}
+
+/*static*/ FAssetLoader& FAssetLoader::Get()
+{
+	static FAssetLoader Singleton;
+
+	return Singleton;
+}
+
+void FAssetLoader::Start(sf::Uint32 NumThreads)
+{
+	check(_LoaderThreads.empty());
+
+	_bIsStopping = false;
+	for (sf::Uint32 ThreadIndex = 0; ThreadIndex < NumThreads; ++ThreadIndex)
+	{
+		_LoaderThreads.emplace_back(&FAssetLoader::LoaderMain, this);
+	}
+
+	GE_LOG(LogRendering, Log, "Asset loader started with %u threads.", NumThreads);
+}
+
+void FAssetLoader::Stop()
+{
+	{
+		std::lock_guard<std::mutex> Lock(_Mutex);
+		_bIsStopping = true;
+	}
+	_RequestCondition.notify_all();
+
+	for (std::thread& LoaderThread : _LoaderThreads)
+	{
+		LoaderThread.join();
+	}
+	_LoaderThreads.clear();
+
+	// Callbacks may point at objects that are about to go away, so none are kept
+	std::deque<FRequest> DroppedRequests;
+	{
+		std::lock_guard<std::mutex> Lock(_Mutex);
+		DroppedRequests.swap(_QueuedRequests);
+		std::move(_DecodedRequests.begin(), _DecodedRequests.end(), std::back_inserter(DroppedRequests));
+		_DecodedRequests.clear();
+		_bIsStopping = false;
+	}
+
+	// Requesters still have to hear about it, or they would wait on these forever
+	for (const FRequest& DroppedRequest : DroppedRequests)
+	{
+		if (DroppedRequest.OnDropped)
+		{
+			DroppedRequest.OnDropped(DroppedRequest.FilePath);
+		}
+	}
+}
+
+void FAssetLoader::RequestImage(const std::string& FilePath,
+								const FOnImageDecoded& OnDecoded,
+								const FOnRequestDropped& OnDropped)
+{
+	FRequest Request{ FilePath, OnDecoded, OnDropped, nullptr };
+
+	if (_LoaderThreads.empty())
+	{
+		Decode(Request);
+
+		std::lock_guard<std::mutex> Lock(_Mutex);
+		_DecodedRequests.push_back(std::move(Request));
+		return;
+	}
+
+	{
+		std::lock_guard<std::mutex> Lock(_Mutex);
+		_QueuedRequests.push_back(std::move(Request));
+	}
+	_RequestCondition.notify_one();
+}
+
+size_t FAssetLoader::DeliverDecodedImages(size_t MaxImages)
+{
+	size_t NumDelivered = 0;
+	while (NumDelivered < MaxImages)
+	{
+		FRequest Request;
+		{
+			std::lock_guard<std::mutex> Lock(_Mutex);
+			if (_DecodedRequests.empty())
+			{
+				break;
+			}
+
+			Request = std::move(_DecodedRequests.front());
+			_DecodedRequests.pop_front();
+		}
+
+		// Called without the lock, so callbacks are free to request more images
+		Request.OnDecoded(Request.FilePath, Request.Image.get());
+		++NumDelivered;
+	}
+
+	return NumDelivered;
+}
+
+void FAssetLoader::WaitForDecoding()
+{
+	std::unique_lock<std::mutex> Lock(_Mutex);
+	_DecodedCondition.wait(Lock, [this]() { return _QueuedRequests.empty() && _NumDecoding == 0; });
+}
+
+size_t FAssetLoader::GetNumPendingRequests() const
+{
+	std::lock_guard<std::mutex> Lock(_Mutex);
+	return _QueuedRequests.size() + _NumDecoding + _DecodedRequests.size();
+}
+
+void FAssetLoader::LoaderMain()
+{
+	while (true)
+	{
+		FRequest Request;
+		{
+			std::unique_lock<std::mutex> Lock(_Mutex);
+			_RequestCondition.wait(Lock, [this]() { return _bIsStopping || !_QueuedRequests.empty(); });
+			if (_bIsStopping)
+			{
+				return;
+			}
+
+			Request = std::move(_QueuedRequests.front());
+			_QueuedRequests.pop_front();
+			++_NumDecoding;
+		}
+
+		Decode(Request);
+
+		// Kept even while stopping, so Stop can tell the requester it was dropped
+		{
+			std::lock_guard<std::mutex> Lock(_Mutex);
+			--_NumDecoding;
+			_DecodedRequests.push_back(std::move(Request));
+		}
+		_DecodedCondition.notify_all();
+	}
+}
+
+/*static*/ void FAssetLoader::Decode(FRequest& Request)
+{
+	std::unique_ptr<sf::Image> Image = std::make_unique<sf::Image>();
+	if (Image->loadFromFile(Request.FilePath))
+	{
+		Request.Image = std::move(Image);
+	}
+	else
+	{
+		GE_LOG(LogRendering, Warning, "Failed to decode image %s", Request.FilePath.c_str());
+	}
+}
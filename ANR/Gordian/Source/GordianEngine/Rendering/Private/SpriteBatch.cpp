@@ -0,0 +1,122 @@
+// Gordian by Daniel Luna (2019)
+
+#include "GordianEngine/Rendering/Public/SpriteBatch.h"
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+
+#include "SFML/Graphics/PrimitiveType.hpp"
+#include "SFML/Graphics/Rect.hpp"
+
+using namespace Gordian;
+
+FSpriteBatch::FSpriteBatch()
+	: _QueuedSprites()
+	, _SortedSprites()
+	, _Vertices()
+	, _NumDrawCalls(0)
+{
+}
+
+void FSpriteBatch::Submit(const sf::Sprite& Sprite, const sf::Transform& ParentTransform, sf::Int32 Layer)
+{
+	const sf::Texture* Texture = Sprite.getTexture();
+	if (Texture == nullptr)
+	{
+		return;
+	}
+
+	// Matches how sf::Sprite lays out its own vertices
+	const sf::IntRect TextureRect = Sprite.getTextureRect();
+	const float Width = static_cast<float>(std::abs(TextureRect.width));
+	const float Height = static_cast<float>(std::abs(TextureRect.height));
+
+	const float Left = static_cast<float>(TextureRect.left);
+	const float Right = Left + TextureRect.width;
+	const float Top = static_cast<float>(TextureRect.top);
+	const float Bottom = Top + TextureRect.height;
+
+	const sf::Transform Transform = ParentTransform * Sprite.getTransform();
+	const sf::Color& Color = Sprite.getColor();
+
+	const sf::Vertex TopLeft(Transform.transformPoint(0.f, 0.f), Color, sf::Vector2f(Left, Top));
+	const sf::Vertex BottomLeft(Transform.transformPoint(0.f, Height), Color, sf::Vector2f(Left, Bottom));
+	const sf::Vertex TopRight(Transform.transformPoint(Width, 0.f), Color, sf::Vector2f(Right, Top));
+	const sf::Vertex BottomRight(Transform.transformPoint(Width, Height), Color, sf::Vector2f(Right, Bottom));
+
+	FQueuedSprite QueuedSprite;
+	QueuedSprite.Layer = Layer;
+	QueuedSprite.Order = static_cast<sf::Uint32>(_QueuedSprites.size());
+	QueuedSprite.Texture = Texture;
+	QueuedSprite.Vertices[0] = TopLeft;
+	QueuedSprite.Vertices[1] = BottomLeft;
+	QueuedSprite.Vertices[2] = TopRight;
+	QueuedSprite.Vertices[3] = TopRight;
+	QueuedSprite.Vertices[4] = BottomLeft;
+	QueuedSprite.Vertices[5] = BottomRight;
+
+	_QueuedSprites.push_back(QueuedSprite);
+}
+
+void FSpriteBatch::Flush(sf::RenderTarget& Target, sf::RenderStates States)
+{
+	_NumDrawCalls = 0;
+
+	if (_QueuedSprites.empty())
+	{
+		return;
+	}
+
+	// Sorting pointers keeps the vertices where they are
+	_SortedSprites.clear();
+	for (const FQueuedSprite& QueuedSprite : _QueuedSprites)
+	{
+		_SortedSprites.push_back(&QueuedSprite);
+	}
+
+	std::sort(_SortedSprites.begin(), _SortedSprites.end(),
+			  [](const FQueuedSprite* Lhs, const FQueuedSprite* Rhs)
+			  {
+				  if (Lhs->Layer != Rhs->Layer)
+				  {
+					  return Lhs->Layer < Rhs->Layer;
+				  }
+				  if (Lhs->Texture != Rhs->Texture)
+				  {
+					  return std::less<const sf::Texture*>()(Lhs->Texture, Rhs->Texture);
+				  }
+				  return Lhs->Order < Rhs->Order;
+			  });
+
+	_Vertices.clear();
+	_Vertices.reserve(_SortedSprites.size() * k_VerticesPerSprite);
+	for (const FQueuedSprite* QueuedSprite : _SortedSprites)
+	{
+		_Vertices.insert(_Vertices.end(), QueuedSprite->Vertices, QueuedSprite->Vertices + k_VerticesPerSprite);
+	}
+
+	// Each run of sprites sharing a texture goes out in one call, even across layers
+	size_t RunBegin = 0;
+	while (RunBegin < _SortedSprites.size())
+	{
+		const sf::Texture* RunTexture = _SortedSprites[RunBegin]->Texture;
+
+		size_t RunEnd = RunBegin + 1;
+		while (RunEnd < _SortedSprites.size() && _SortedSprites[RunEnd]->Texture == RunTexture)
+		{
+			++RunEnd;
+		}
+
+		States.texture = RunTexture;
+		Target.draw(&_Vertices[RunBegin * k_VerticesPerSprite],
+					(RunEnd - RunBegin) * k_VerticesPerSprite,
+					sf::Triangles,
+					States);
+		++_NumDrawCalls;
+
+		RunBegin = RunEnd;
+	}
+
+	_QueuedSprites.clear();
+}
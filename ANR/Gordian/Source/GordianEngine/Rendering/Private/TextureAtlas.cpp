@@ -0,0 +1,232 @@
+// Gordian by Daniel Luna (2019)
+
+#include "GordianEngine/Rendering/Public/TextureAtlas.h"
+
+#include <algorithm>
+
+#include "GordianEngine/Debug/Public/Asserts.h"
+#include "GordianEngine/Debug/Public/Logging.h"
+
+using namespace Gordian;
+
+namespace
+{
+	// Keeps neighbouring images from bleeding into each other when filtered
+	const unsigned int k_AtlasPadding = 1;
+}
+
+FShelfPacker::FShelfPacker(unsigned int InWidth, unsigned int InHeight, unsigned int InPadding)
+	: _Shelves()
+	, _Width(InWidth)
+	, _Height(InHeight)
+	, _Padding(InPadding)
+	, _NextShelfTop(0)
+{
+}
+
+bool FShelfPacker::Insert(unsigned int Width, unsigned int Height, sf::Vector2u& OutPosition)
+{
+	const unsigned int PaddedWidth = Width + _Padding;
+	const unsigned int PaddedHeight = Height + _Padding;
+
+	// Padding can hang off the right and bottom edges
+	if (Width == 0 || Height == 0 || Width > _Width || Height > _Height)
+	{
+		return false;
+	}
+
+	FShelf* BestShelf = nullptr;
+	for (FShelf& Shelf : _Shelves)
+	{
+		if (Shelf.Height >= PaddedHeight
+			&& Shelf.NextLeft + Width <= _Width
+			&& (BestShelf == nullptr || Shelf.Height < BestShelf->Height))
+		{
+			BestShelf = &Shelf;
+		}
+	}
+
+	if (BestShelf == nullptr)
+	{
+		if (_NextShelfTop + Height > _Height)
+		{
+			return false;
+		}
+
+		_Shelves.push_back(FShelf{ _NextShelfTop, PaddedHeight, 0 });
+		_NextShelfTop += PaddedHeight;
+		BestShelf = &_Shelves.back();
+	}
+
+	OutPosition = sf::Vector2u(BestShelf->NextLeft, BestShelf->Top);
+	BestShelf->NextLeft += PaddedWidth;
+	return true;
+}
+
+void FShelfPacker::Reset()
+{
+	_Shelves.clear();
+	_NextShelfTop = 0;
+}
+
+FTextureAtlas::FTextureAtlas(unsigned int PageSize)
+	: _Pages()
+	, _Regions()
+	, _PageSize(std::min(PageSize, sf::Texture::getMaximumSize()))
+{
+}
+
+bool FTextureAtlas::AddImage(const std::string& Key, const sf::Image& Image, const sf::IntRect& SourceRect)
+{
+	if (_Regions.find(Key) != _Regions.end())
+	{
+		return true;
+	}
+
+	const sf::Vector2u ImageSize = Image.getSize();
+	if (SourceRect.left < 0 || SourceRect.top < 0 || SourceRect.width <= 0 || SourceRect.height <= 0
+		|| static_cast<unsigned int>(SourceRect.left + SourceRect.width) > ImageSize.x
+		|| static_cast<unsigned int>(SourceRect.top + SourceRect.height) > ImageSize.y)
+	{
+		GE_LOG(LogRendering, Warning, "Cannot add %s to atlas: source rect is outside the image", Key.c_str());
+		return false;
+	}
+
+	const unsigned int Width = static_cast<unsigned int>(SourceRect.width);
+	const unsigned int Height = static_cast<unsigned int>(SourceRect.height);
+
+	size_t PageIndex = 0;
+	sf::Vector2u Position;
+	if (!Allocate(Width, Height, PageIndex, Position))
+	{
+		GE_LOG(LogRendering, Warning, "Cannot add %s to atlas: %ux%u is larger than a page", Key.c_str(), Width, Height);
+		return false;
+	}
+
+	sf::Texture& PageTexture = *_Pages[PageIndex].Texture;
+	if (SourceRect.width == static_cast<int>(ImageSize.x) && SourceRect.height == static_cast<int>(ImageSize.y))
+	{
+		PageTexture.update(Image, Position.x, Position.y);
+	}
+	else
+	{
+		sf::Image Cell;
+		Cell.create(Width, Height);
+		Cell.copy(Image, 0, 0, SourceRect);
+		PageTexture.update(Cell, Position.x, Position.y);
+	}
+
+	FAtlasRegion& Region = _Regions[Key];
+	Region.Texture = &PageTexture;
+	Region.TextureRect = sf::IntRect(Position.x, Position.y, Width, Height);
+	Region.PageIndex = PageIndex;
+	return true;
+}
+
+bool FTextureAtlas::AddImage(const std::string& Key, const sf::Image& Image)
+{
+	const sf::Vector2u ImageSize = Image.getSize();
+	return AddImage(Key, Image, sf::IntRect(0, 0, ImageSize.x, ImageSize.y));
+}
+
+bool FTextureAtlas::AddImageFromFile(const std::string& FilePath)
+{
+	if (_Regions.find(FilePath) != _Regions.end())
+	{
+		return true;
+	}
+
+	sf::Image Image;
+	if (!Image.loadFromFile(FilePath))
+	{
+		GE_LOG(LogRendering, Warning, "Failed to load %s into atlas", FilePath.c_str());
+		return false;
+	}
+
+	return AddImage(FilePath, Image);
+}
+
+size_t FTextureAtlas::AddSpriteSheet(const std::string& FilePath, const sf::Vector2u& CellSize)
+{
+	if (CellSize.x == 0 || CellSize.y == 0)
+	{
+		return 0;
+	}
+
+	sf::Image SpriteSheet;
+	if (!SpriteSheet.loadFromFile(FilePath))
+	{
+		GE_LOG(LogRendering, Warning, "Failed to load sprite sheet %s into atlas", FilePath.c_str());
+		return 0;
+	}
+
+	const sf::Vector2u SheetSize = SpriteSheet.getSize();
+	const unsigned int NumColumns = SheetSize.x / CellSize.x;
+	const unsigned int NumRows = SheetSize.y / CellSize.y;
+
+	size_t NumCellsAdded = 0;
+	for (unsigned int Row = 0; Row < NumRows; ++Row)
+	{
+		for (unsigned int Column = 0; Column < NumColumns; ++Column)
+		{
+			const sf::IntRect CellRect(Column * CellSize.x, Row * CellSize.y, CellSize.x, CellSize.y);
+			const size_t CellIndex = Row * NumColumns + Column;
+			if (AddImage(GetSpriteSheetKey(FilePath, CellIndex), SpriteSheet, CellRect))
+			{
+				++NumCellsAdded;
+			}
+		}
+	}
+
+	return NumCellsAdded;
+}
+
+/*static*/ std::string FTextureAtlas::GetSpriteSheetKey(const std::string& FilePath, size_t CellIndex)
+{
+	return FilePath + "#" + std::to_string(CellIndex);
+}
+
+const FAtlasRegion* FTextureAtlas::FindRegion(const std::string& Key) const
+{
+	auto FoundRegion = _Regions.find(Key);
+	return (FoundRegion != _Regions.end()) ? &FoundRegion->second : nullptr;
+}
+
+const sf::Texture& FTextureAtlas::GetPageTexture(size_t PageIndex) const
+{
+	check(PageIndex < _Pages.size());
+	return *_Pages[PageIndex].Texture;
+}
+
+bool FTextureAtlas::Allocate(unsigned int Width, unsigned int Height, size_t& OutPageIndex, sf::Vector2u& OutPosition)
+{
+	if (Width > _PageSize || Height > _PageSize)
+	{
+		return false;
+	}
+
+	// Earlier pages may still have gaps for smaller images
+	for (size_t PageIndex = 0; PageIndex < _Pages.size(); ++PageIndex)
+	{
+		if (_Pages[PageIndex].Packer.Insert(Width, Height, OutPosition))
+		{
+			OutPageIndex = PageIndex;
+			return true;
+		}
+	}
+
+	std::unique_ptr<sf::Texture> PageTexture = std::make_unique<sf::Texture>();
+	if (!PageTexture->create(_PageSize, _PageSize))
+	{
+		GE_LOG(LogRendering, Error, "Failed to create %ux%u atlas page", _PageSize, _PageSize);
+		return false;
+	}
+	PageTexture->setSmooth(true);
+
+	_Pages.push_back(FPage{ std::move(PageTexture), FShelfPacker(_PageSize, _PageSize, k_AtlasPadding) });
+	OutPageIndex = _Pages.size() - 1;
+
+	const bool bInserted = _Pages.back().Packer.Insert(Width, Height, OutPosition);
+	check(bInserted);
+	return bInserted;
+}
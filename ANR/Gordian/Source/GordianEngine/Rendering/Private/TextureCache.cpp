@@ -0,0 +1,239 @@
+// Gordian by Daniel Luna (2019)
+
+#include "GordianEngine/Rendering/Public/TextureCache.h"
+
+#include "GordianEngine/Debug/Public/Logging.h"
+#include "GordianEngine/Rendering/Public/AssetLoader.h"
+
+using namespace Gordian;
+
+namespace
+{
+	// Textures are uploaded as 8 bit RGBA
+	const size_t k_BytesPerTexel = 4;
+
+	const sf::Color k_PlaceholderColor(96, 96, 96);
+}
+
+/*static*/ FTextureCache& FTextureCache::Get()
+{
+	static FTextureCache TextureCache;
+	return TextureCache;
+}
+
+FTextureCache::FTextureCache(size_t InMemoryBudget)
+	: _Entries()
+	, _RecentlyUsed()
+	, _MemoryBudget(InMemoryBudget)
+	, _PlaceholderImage()
+	, _Stats{ 0, 0, 0, 0, 0, 0 }
+{
+	_PlaceholderImage.create(1, 1, k_PlaceholderColor);
+}
+
+FTextureHandle FTextureCache::Load(const std::string& FilePath)
+{
+	auto FoundEntry = _Entries.find(FilePath);
+	if (FoundEntry != _Entries.end() && !FoundEntry->second.bIsStreaming)
+	{
+		++_Stats.Hits;
+		_RecentlyUsed.splice(_RecentlyUsed.begin(), _RecentlyUsed, FoundEntry->second.RecentUse);
+		return FoundEntry->second.Texture;
+	}
+
+	++_Stats.Misses;
+
+	// A texture still streaming is loaded in place, so existing handles see it too
+	std::shared_ptr<sf::Texture> Texture = (FoundEntry != _Entries.end()) ? FoundEntry->second.Texture
+																		  : std::make_shared<sf::Texture>();
+	if (!Texture->loadFromFile(FilePath))
+	{
+		GE_LOG(LogRendering, Warning, "Failed to load texture %s", FilePath.c_str());
+		return nullptr;
+	}
+
+	if (FoundEntry != _Entries.end())
+	{
+		RemoveEntry(FoundEntry);
+	}
+
+	AddEntry(FilePath, Texture, false);
+	return Texture;
+}
+
+FTextureHandle FTextureCache::LoadAsync(const std::string& FilePath, FAssetLoader& AssetLoader)
+{
+	auto FoundEntry = _Entries.find(FilePath);
+	if (FoundEntry != _Entries.end())
+	{
+		++_Stats.Hits;
+		_RecentlyUsed.splice(_RecentlyUsed.begin(), _RecentlyUsed, FoundEntry->second.RecentUse);
+
+		if (FoundEntry->second.bIsStreaming && !FoundEntry->second.bIsRequested)
+		{
+			RequestImage(FilePath, AssetLoader);
+		}
+		return FoundEntry->second.Texture;
+	}
+
+	++_Stats.Misses;
+
+	std::shared_ptr<sf::Texture> Texture = std::make_shared<sf::Texture>();
+	if (!Texture->loadFromImage(_PlaceholderImage))
+	{
+		GE_LOG(LogRendering, Warning, "Failed to create placeholder texture for %s", FilePath.c_str());
+		return nullptr;
+	}
+
+	AddEntry(FilePath, Texture, true);
+	RequestImage(FilePath, AssetLoader);
+
+	return Texture;
+}
+
+FTextureHandle FTextureCache::LoadAsync(const std::string& FilePath)
+{
+	return LoadAsync(FilePath, FAssetLoader::Get());
+}
+
+bool FTextureCache::IsCached(const std::string& FilePath) const
+{
+	return _Entries.find(FilePath) != _Entries.end();
+}
+
+bool FTextureCache::IsStreaming(const std::string& FilePath) const
+{
+	auto FoundEntry = _Entries.find(FilePath);
+	return FoundEntry != _Entries.end() && FoundEntry->second.bIsStreaming;
+}
+
+void FTextureCache::SetMemoryBudget(size_t InMemoryBudget)
+{
+	_MemoryBudget = InMemoryBudget;
+	Trim();
+}
+
+void FTextureCache::Trim()
+{
+	EvictUnusedTextures(_MemoryBudget);
+}
+
+void FTextureCache::Clear()
+{
+	EvictUnusedTextures(0);
+}
+
+void FTextureCache::ResetCounters()
+{
+	_Stats.Hits = 0;
+	_Stats.Misses = 0;
+	_Stats.Evictions = 0;
+}
+
+void FTextureCache::RequestImage(const std::string& FilePath, FAssetLoader& AssetLoader)
+{
+	_Entries.at(FilePath).bIsRequested = true;
+
+	AssetLoader.RequestImage(FilePath,
+		[this](const std::string& DecodedFilePath, const sf::Image* Image)
+		{
+			OnImageDecoded(DecodedFilePath, Image);
+		},
+		[this](const std::string& DroppedFilePath)
+		{
+			OnImageDropped(DroppedFilePath);
+		});
+}
+
+void FTextureCache::OnImageDecoded(const std::string& FilePath, const sf::Image* Image)
+{
+	// The texture may have been evicted, or loaded synchronously, while it was decoding
+	auto FoundEntry = _Entries.find(FilePath);
+	if (FoundEntry == _Entries.end() || !FoundEntry->second.bIsStreaming)
+	{
+		return;
+	}
+
+	if (Image == nullptr || !FoundEntry->second.Texture->loadFromImage(*Image))
+	{
+		GE_LOG(LogRendering, Warning, "Failed to stream texture %s, keeping its placeholder", FilePath.c_str());
+		RemoveEntry(FoundEntry);
+		return;
+	}
+
+	FEntry& UploadedEntry = FoundEntry->second;
+	const size_t NumBytes = GetNumBytes(*UploadedEntry.Texture);
+	_Stats.ResidentBytes += NumBytes - UploadedEntry.NumBytes;
+	--_Stats.NumStreaming;
+
+	UploadedEntry.NumBytes = NumBytes;
+	UploadedEntry.bIsStreaming = false;
+	UploadedEntry.bIsRequested = false;
+
+	Trim();
+}
+
+void FTextureCache::OnImageDropped(const std::string& FilePath)
+{
+	auto FoundEntry = _Entries.find(FilePath);
+	if (FoundEntry != _Entries.end() && FoundEntry->second.bIsStreaming)
+	{
+		FoundEntry->second.bIsRequested = false;
+	}
+}
+
+void FTextureCache::AddEntry(const std::string& FilePath, const std::shared_ptr<sf::Texture>& Texture, bool bIsStreaming)
+{
+	const size_t NumBytes = GetNumBytes(*Texture);
+
+	// Make room before adding, so the new texture is not the one evicted
+	EvictUnusedTextures(NumBytes < _MemoryBudget ? _MemoryBudget - NumBytes : 0);
+
+	_RecentlyUsed.push_front(FilePath);
+	_Entries.emplace(FilePath, FEntry{ Texture, NumBytes, bIsStreaming, false, _RecentlyUsed.begin() });
+
+	++_Stats.NumTextures;
+	_Stats.NumStreaming += bIsStreaming ? 1 : 0;
+	_Stats.ResidentBytes += NumBytes;
+
+	if (_Stats.ResidentBytes > _MemoryBudget)
+	{
+		GE_LOG(LogRendering, Warning, "Texture cache is over budget: %zu of %zu bytes are in use", _Stats.ResidentBytes, _MemoryBudget);
+	}
+}
+
+void FTextureCache::RemoveEntry(std::unordered_map<std::string, FEntry>::iterator Entry)
+{
+	--_Stats.NumTextures;
+	_Stats.NumStreaming -= Entry->second.bIsStreaming ? 1 : 0;
+	_Stats.ResidentBytes -= Entry->second.NumBytes;
+
+	_RecentlyUsed.erase(Entry->second.RecentUse);
+	_Entries.erase(Entry);
+}
+
+/*static*/ size_t FTextureCache::GetNumBytes(const sf::Texture& Texture)
+{
+	const sf::Vector2u TextureSize = Texture.getSize();
+	return static_cast<size_t>(TextureSize.x) * TextureSize.y * k_BytesPerTexel;
+}
+
+void FTextureCache::EvictUnusedTextures(size_t MaxBytes)
+{
+	auto RecentUse = _RecentlyUsed.end();
+	while (_Stats.ResidentBytes > MaxBytes && RecentUse != _RecentlyUsed.begin())
+	{
+		--RecentUse;
+
+		auto Entry = _Entries.find(*RecentUse);
+		if (Entry->second.Texture.use_count() > 1)
+		{
+			continue;
+		}
+
+		// Step past the entry first, since removing it erases its place in the list
+		++RecentUse;
+		RemoveEntry(Entry);
+		++_Stats.Evictions;
+	}
+}
@@ -0,0 +1,93 @@
+// Gordian by Daniel Luna (2019)
+
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "SFML/Config.hpp"
+#include "SFML/Graphics/Image.hpp"
+#include "SFML/System/NonCopyable.hpp"
+
+namespace Gordian
+{
+
+
+// Decodes images from disk on background threads, then hands them back on the main thread.
+//	Uploading to the graphics card has to happen on the thread that renders, so decoded
+//	images wait until DeliverDecodedImages is called, which can spread uploads over frames.
+// Until Start is called (or if it is started with no threads) images are decoded inline.
+class FAssetLoader : public sf::NonCopyable
+{
+public:
+
+	// Called on the delivering thread. Image is nullptr if the file could not be decoded.
+	typedef std::function<void(const std::string& FilePath, const sf::Image* Image)> FOnImageDecoded;
+	// Called on the stopping thread for requests Stop drops before they are delivered
+	typedef std::function<void(const std::string& FilePath)> FOnRequestDropped;
+
+	FAssetLoader();
+	~FAssetLoader();
+
+	static FAssetLoader& Get();
+
+	// Spins up the loader threads. Must not already be running.
+	void Start(sf::Uint32 NumThreads);
+	// Joins the loader threads, dropping every request that has not been delivered yet.
+	//	OnDropped is called for each of them, but OnDecoded never is.
+	void Stop();
+
+	// Queues FilePath to be decoded. OnDecoded is called from DeliverDecodedImages,
+	//	or OnDropped from Stop if the request never gets that far.
+	void RequestImage(const std::string& FilePath,
+					  const FOnImageDecoded& OnDecoded,
+					  const FOnRequestDropped& OnDropped = FOnRequestDropped());
+
+	// Calls back up to MaxImages requests that have finished decoding, oldest first.
+	//	Returns the number delivered.
+	size_t DeliverDecodedImages(size_t MaxImages);
+
+	// Blocks until every requested image has been decoded, though not delivered
+	void WaitForDecoding();
+
+	// Requests that have not been delivered yet
+	size_t GetNumPendingRequests() const;
+
+private:
+
+	struct FRequest
+	{
+		std::string FilePath;
+		FOnImageDecoded OnDecoded;
+		FOnRequestDropped OnDropped;
+		// Null until decoded, and left null if decoding failed
+		std::unique_ptr<sf::Image> Image;
+	};
+
+	void LoaderMain();
+
+	static void Decode(FRequest& Request);
+
+	std::vector<std::thread> _LoaderThreads;
+
+	mutable std::mutex _Mutex;
+	// Loader threads sleep on this while there is nothing to decode
+	std::condition_variable _RequestCondition;
+	// Signalled whenever a request finishes decoding
+	std::condition_variable _DecodedCondition;
+
+	std::deque<FRequest> _QueuedRequests;
+	std::deque<FRequest> _DecodedRequests;
+	size_t _NumDecoding;
+
+	bool _bIsStopping;
+};
+
+
+};
@@ -0,0 +1,73 @@
+// Gordian by Daniel Luna (2019)
+
+#pragma once
+
+#include <vector>
+
+#include "SFML/Config.hpp"
+#include "SFML/Graphics/RenderStates.hpp"
+#include "SFML/Graphics/RenderTarget.hpp"
+#include "SFML/Graphics/Sprite.hpp"
+#include "SFML/Graphics/Transform.hpp"
+#include "SFML/Graphics/Vertex.hpp"
+#include "SFML/System/NonCopyable.hpp"
+
+namespace Gordian
+{
+
+
+// Collects sprites over a render pass and draws them with one draw call per texture.
+//	Sprites are sorted by layer, then grouped by texture within each layer. Anything
+//	that has to draw over another sprite in the same layer should go in a higher layer.
+// Sprites sharing a texture page from FTextureAtlas end up in the same draw call.
+class FSpriteBatch : sf::NonCopyable
+{
+public:
+
+	FSpriteBatch();
+
+	// Queues a sprite, baking ParentTransform and the sprite's own transform into its
+	//	vertices. Lower layers are drawn first. Sprites without a texture are ignored.
+	void Submit(const sf::Sprite& Sprite, const sf::Transform& ParentTransform, sf::Int32 Layer = 0);
+
+	// Draws everything queued, then empties the queue. States applies to every draw,
+	//	apart from its texture.
+	void Flush(sf::RenderTarget& Target, sf::RenderStates States = sf::RenderStates::Default);
+
+	// Number of sprites waiting for the next flush
+	inline size_t GetNumQueuedSprites() const
+	{
+		return _QueuedSprites.size();
+	}
+
+	// Number of draw calls made by the last flush
+	inline size_t GetNumDrawCalls() const
+	{
+		return _NumDrawCalls;
+	}
+
+private:
+
+	// Sprites are drawn as two triangles each
+	static const size_t k_VerticesPerSprite = 6;
+
+	struct FQueuedSprite
+	{
+		sf::Int32 Layer;
+		// Submission order, so equal sprites keep the order they were queued in
+		sf::Uint32 Order;
+		const sf::Texture* Texture;
+		sf::Vertex Vertices[k_VerticesPerSprite];
+	};
+
+	std::vector<FQueuedSprite> _QueuedSprites;
+
+	// Sorted into draw order at flush. Kept around so it can reuse its memory.
+	std::vector<const FQueuedSprite*> _SortedSprites;
+	std::vector<sf::Vertex> _Vertices;
+
+	size_t _NumDrawCalls;
+};
+
+
+};
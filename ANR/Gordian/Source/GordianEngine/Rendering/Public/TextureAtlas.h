@@ -0,0 +1,116 @@
+// Gordian by Daniel Luna (2019)
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "SFML/Graphics/Image.hpp"
+#include "SFML/Graphics/Rect.hpp"
+#include "SFML/Graphics/Texture.hpp"
+#include "SFML/System/NonCopyable.hpp"
+#include "SFML/System/Vector2.hpp"
+
+namespace Gordian
+{
+
+
+// Where an image ended up in an FTextureAtlas
+struct FAtlasRegion
+{
+	const sf::Texture* Texture;
+	sf::IntRect TextureRect;
+	size_t PageIndex;
+};
+
+// Packs rectangles into a fixed size area, row by row.
+//	Rectangles go on the shortest shelf they fit on, and a new shelf is opened below the
+//	last one when none fit. Works best when rectangles are close in height, like cards.
+class FShelfPacker
+{
+public:
+
+	// Padding is left to the right of and below every rectangle
+	FShelfPacker(unsigned int InWidth, unsigned int InHeight, unsigned int InPadding = 1);
+
+	// Finds space for a Width x Height rectangle, returning false if there was none left
+	bool Insert(unsigned int Width, unsigned int Height, sf::Vector2u& OutPosition);
+
+	// Forgets every rectangle inserted so far
+	void Reset();
+
+private:
+
+	struct FShelf
+	{
+		unsigned int Top;
+		unsigned int Height;
+		unsigned int NextLeft;
+	};
+
+	std::vector<FShelf> _Shelves;
+
+	unsigned int _Width;
+	unsigned int _Height;
+	unsigned int _Padding;
+
+	// Where the next shelf will be opened
+	unsigned int _NextShelfTop;
+};
+
+// Packs many small images into a few large texture pages, so sprites using them can be
+//	drawn together by FSpriteBatch. Images are found again by the key they were added with.
+class FTextureAtlas : sf::NonCopyable
+{
+public:
+
+	// Pages are PageSize x PageSize, or as large as the graphics card allows
+	explicit FTextureAtlas(unsigned int PageSize = 4096);
+
+	// Copies SourceRect of Image into the atlas under Key. Adding a key twice does nothing.
+	// Returns false if the image could not fit on an empty page.
+	bool AddImage(const std::string& Key, const sf::Image& Image, const sf::IntRect& SourceRect);
+	bool AddImage(const std::string& Key, const sf::Image& Image);
+
+	// Loads FilePath into the atlas, using the path as its key
+	bool AddImageFromFile(const std::string& FilePath);
+
+	// Loads FilePath and adds each CellSize cell of it, left to right then top to bottom.
+	//	Cells are keyed by GetSpriteSheetKey. Returns the number of cells added.
+	size_t AddSpriteSheet(const std::string& FilePath, const sf::Vector2u& CellSize);
+
+	static std::string GetSpriteSheetKey(const std::string& FilePath, size_t CellIndex);
+
+	// Returns the region Key was packed into, or nullptr if it was never added.
+	//	Regions stay valid for as long as the atlas does.
+	const FAtlasRegion* FindRegion(const std::string& Key) const;
+
+	inline size_t GetNumPages() const
+	{
+		return _Pages.size();
+	}
+
+	const sf::Texture& GetPageTexture(size_t PageIndex) const;
+
+private:
+
+	struct FPage
+	{
+		std::unique_ptr<sf::Texture> Texture;
+		FShelfPacker Packer;
+	};
+
+	// Finds room for a Width x Height image, opening a new page if needed
+	bool Allocate(unsigned int Width, unsigned int Height, size_t& OutPageIndex, sf::Vector2u& OutPosition);
+
+	std::vector<FPage> _Pages;
+
+	std::unordered_map<std::string, FAtlasRegion> _Regions;
+
+	unsigned int _PageSize;
+};
+
+
+};
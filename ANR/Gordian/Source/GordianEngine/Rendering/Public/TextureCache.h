@@ -0,0 +1,138 @@
+// Gordian by Daniel Luna (2019)
+
+#pragma once
+
+#include <list>
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+#include "SFML/Config.hpp"
+#include "SFML/Graphics/Image.hpp"
+#include "SFML/Graphics/Texture.hpp"
+#include "SFML/System/NonCopyable.hpp"
+
+namespace Gordian
+{
+
+
+// Shared reference to a cached texture. The texture stays alive while any handle to it does.
+typedef std::shared_ptr<const sf::Texture> FTextureHandle;
+
+class FAssetLoader;
+
+struct FTextureCacheStats
+{
+	// Loads answered by a texture that was already cached
+	sf::Uint64 Hits;
+	// Loads that had to read the file
+	sf::Uint64 Misses;
+	sf::Uint64 Evictions;
+
+	size_t NumTextures;
+	// Textures still showing a placeholder while their file is decoded
+	size_t NumStreaming;
+	// Estimated graphics memory used by the cached textures
+	size_t ResidentBytes;
+};
+
+// Loads each texture file once and hands out shared handles to it.
+//	Textures nobody holds a handle to are kept around for later loads, and are evicted
+//	least recently used first once the cache is over its memory budget. Textures still
+//	in use are never evicted, so the budget can be exceeded while they are held.
+// Only use the cache from the thread that renders.
+class FTextureCache : sf::NonCopyable
+{
+public:
+
+	// The cache used by the engine
+	static FTextureCache& Get();
+
+	explicit FTextureCache(size_t InMemoryBudget = 256 * 1024 * 1024);
+
+	// Returns the texture loaded from FilePath, loading it if it is not already cached.
+	//	Returns nullptr if the file could not be loaded.
+	FTextureHandle Load(const std::string& FilePath);
+
+	// Returns the texture for FilePath right away, decoding the file on AssetLoader's threads.
+	//	Until the decoded image is delivered, the texture holds a single placeholder texel,
+	//	which fills whatever texture rect it is drawn with. It is then updated in place.
+	// If the file cannot be decoded, the placeholder is kept and the file is dropped from the cache.
+	//	If AssetLoader is stopped first, the texture keeps streaming and is requested again by the next LoadAsync.
+	FTextureHandle LoadAsync(const std::string& FilePath, FAssetLoader& AssetLoader);
+	FTextureHandle LoadAsync(const std::string& FilePath);
+
+	bool IsCached(const std::string& FilePath) const;
+
+	// True while FilePath is cached but still showing its placeholder
+	bool IsStreaming(const std::string& FilePath) const;
+
+	// Evicts unused textures until the cache fits in MemoryBudget bytes
+	void SetMemoryBudget(size_t InMemoryBudget);
+	inline size_t GetMemoryBudget() const
+	{
+		return _MemoryBudget;
+	}
+
+	// Evicts unused textures until the cache is back under its budget
+	void Trim();
+
+	// Evicts every unused texture
+	void Clear();
+
+	inline const FTextureCacheStats& GetStats() const
+	{
+		return _Stats;
+	}
+
+	// Zeroes the hit, miss and eviction counts
+	void ResetCounters();
+
+private:
+
+	struct FEntry
+	{
+		std::shared_ptr<sf::Texture> Texture;
+		size_t NumBytes;
+		// True until the decoded image has been uploaded
+		bool bIsStreaming;
+		// True while an asset loader has the file to decode. Streaming textures lose their
+		//	request if the loader is stopped before delivering it.
+		bool bIsRequested;
+		// Where this entry sits in _RecentlyUsed
+		std::list<std::string>::iterator RecentUse;
+	};
+
+	// Asks AssetLoader to decode FilePath for its streaming texture
+	void RequestImage(const std::string& FilePath, FAssetLoader& AssetLoader);
+
+	// Uploads an image decoded for LoadAsync, if its texture is still wanted
+	void OnImageDecoded(const std::string& FilePath, const sf::Image* Image);
+	// Marks the texture as needing a new request, since its loader stopped before delivering it
+	void OnImageDropped(const std::string& FilePath);
+
+	// Adds a new entry for FilePath as the most recently used texture
+	void AddEntry(const std::string& FilePath, const std::shared_ptr<sf::Texture>& Texture, bool bIsStreaming);
+
+	void RemoveEntry(std::unordered_map<std::string, FEntry>::iterator Entry);
+
+	static size_t GetNumBytes(const sf::Texture& Texture);
+
+	// Evicts unused textures, least recently used first, until at most MaxBytes are left
+	void EvictUnusedTextures(size_t MaxBytes);
+
+	std::unordered_map<std::string, FEntry> _Entries;
+
+	// Cached file paths, most recently used first
+	std::list<std::string> _RecentlyUsed;
+
+	size_t _MemoryBudget;
+
+	// Uploaded into every texture that is still streaming
+	sf::Image _PlaceholderImage;
+
+	FTextureCacheStats _Stats;
+};
+
+
+};
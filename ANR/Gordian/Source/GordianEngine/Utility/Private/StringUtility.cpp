@@ -25,4 +25,16 @@ void FStringUtil::RightTrim(sf::String& InOutTrimTarget, const char* TrimCharact
 void FStringUtil::Trim(sf::String& InOutTrimTarget, const char* TrimCharacters)
 {
 
-}
\ No newline at end of file
+}
+
+sf::Uint32 FStringUtil::HashString(const char* String)
+{
+	sf::Uint32 Hash = 2166136261u;
+	for (const char* Character = String; *Character != '\0'; ++Character)
+	{
+		Hash ^= static_cast<unsigned char>(*Character);
+		Hash *= 16777619u;
+	}
+
+	return Hash;
+}
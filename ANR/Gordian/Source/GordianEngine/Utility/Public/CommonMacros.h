@@ -107,4 +107,12 @@ namespace Gordian
 #endif	// ifndef __TOSTRING
 // ----------------------------------------------------------------
 
+// ----------------------------------------------------------------
+// Pastes two tokens together. The double wrapping expands macros
+//	like __LINE__ before they are pasted.
+// ----------------------------------------------------------------
+#define __GE_CONCAT_INNER(x, y) x##y
+#define __GE_CONCAT(x, y) __GE_CONCAT_INNER(x, y)
+// ----------------------------------------------------------------
+
 };	// namespace Gordian
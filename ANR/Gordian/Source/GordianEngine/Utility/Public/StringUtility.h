@@ -24,6 +24,9 @@ struct FStringUtil
 	// Trims both sides of the passed string, remove characters until we hit a non-TrimCharacter
 	static inline void Trim(sf::String& InOutTrimTarget, const char* TrimCharacters);
 
+	// Hashes a null terminated string (32-bit FNV-1a). Stable across runs and platforms.
+	static sf::Uint32 HashString(const char* String);
+
 };
 
 
@@ -3,9 +3,8 @@
 #include "GordianEngine/World/Public/Level.h"
 #include "GordianEngine/Core/Public/Gordian.h"
 
-#include <cstdio>
-
 #include "GordianEngine/Actor/Public/Actor.h"
+#include "GordianEngine/FileIO/Public/ObjectSerializer.h"
 
 using namespace Gordian;
 
@@ -20,19 +19,22 @@ OLevel::OLevel(const std::string& InName)
 
 bool OLevel::LoadLevel(const std::string& InFilePath)
 {
-	std::FILE* LevelFile = nullptr;
-	_ErrorCode = fopen_s(&LevelFile, InFilePath.c_str(), "r");
-	if (_ErrorCode != 0)
+	if (!FObjectSerializer::LoadFromFile(this, InFilePath))
 	{
-		GE_LOG(LogFileIO, Warning, "LogOutput file could not be set up! Error code: %d!", _ErrorCode);
+		GE_LOG(LogFileIO, Warning, "Level %s could not be loaded!", InFilePath.c_str());
+		_ErrorCode = -1;
 		return false;
 	}
 
-	
-
+	_ErrorCode = 0;
 	return true;
 }
 
+bool OLevel::SaveLevel(const std::string& InFilePath) const
+{
+	return FObjectSerializer::SaveToFile(this, InFilePath);
+}
+
 RCLASS_INITIALIZE(OLevel)
 RCLASS_BEGIN_MEMBER_LIST()
 RCLASS_MEMBER_ADD(_Specifications)
@@ -0,0 +1,441 @@
+// Gordian by Daniel Luna (2019)
+
+#include "GordianEngine/World/Public/TickManager.h"
+#include "GordianEngine/Core/Public/Gordian.h"
+
+#include <algorithm>
+
+#include "GordianEngine/Actor/Public/Actor.h"
+#include "GordianEngine/Actor/Public/ActorComponent.h"
+#include "GordianEngine/Core/Public/JobSystem.h"
+#include "GordianEngine/Debug/Public/Profiler.h"
+#include "GordianEngine/Reflection/Public/Type_Struct.h"
+
+using namespace Gordian;
+
+DECLARE_LOG_CATEGORY_STATIC(LogTickManager, All, Verbose)
+
+namespace
+{
+	// Tickables of one type handed to a worker at a time
+	const size_t k_TickBatchSize = 16;
+
+	// Marks a tickable that has not been given a wave yet
+	const sf::Int32 k_WaveUnresolved = -1;
+	// Marks a tickable whose wave is being worked out, used to catch cycles
+	const sf::Int32 k_WaveResolving = -2;
+}
+
+FTickManager::FTickManager()
+	: _TickGroups{}
+	, _PendingRegistrations{}
+	, _TickBatches{}
+	, _NumTickables(0)
+	, _bIsTicking(false)
+{
+	for (FTickGroupSchedule& Schedule : _TickGroups)
+	{
+		Schedule.bIsDirty = false;
+	}
+}
+
+FTickManager::~FTickManager()
+{
+	// Anything still registered outlives us, so make sure it won't call back in
+	for (FTickGroupSchedule& Schedule : _TickGroups)
+	{
+		for (ITickable* Tickable : Schedule.Registered)
+		{
+			Tickable->_TickManager = nullptr;
+		}
+	}
+
+	for (ITickable* Tickable : _PendingRegistrations)
+	{
+		Tickable->_TickManager = nullptr;
+	}
+}
+
+void FTickManager::RegisterActor(AActor* Actor)
+{
+	check(Actor != nullptr);
+	RegisterTickable(Actor, Actor->GetType());
+}
+
+void FTickManager::UnregisterActor(AActor* Actor)
+{
+	check(Actor != nullptr);
+	UnregisterTickable(Actor);
+}
+
+void FTickManager::RegisterComponent(OActorComponent* Component)
+{
+	check(Component != nullptr);
+	RegisterTickable(Component, Component->GetType());
+}
+
+void FTickManager::UnregisterComponent(OActorComponent* Component)
+{
+	check(Component != nullptr);
+	UnregisterTickable(Component);
+}
+
+void FTickManager::Tick(const sf::Time& DeltaSeconds)
+{
+	{
+		std::lock_guard<std::mutex> Lock(_Mutex);
+		check(!_bIsTicking);
+		_bIsTicking = true;
+	}
+
+	// Without workers nothing is gained by splitting, so each run ticks as one batch
+	const bool bHasWorkers = FJobSystem::Get().GetNumWorkers() > 0;
+
+	for (size_t GroupIndex = 0; GroupIndex < _TickGroups.size(); ++GroupIndex)
+	{
+		FTickGroupSchedule& Schedule = _TickGroups[GroupIndex];
+
+		{
+			std::lock_guard<std::mutex> Lock(_Mutex);
+			if (Schedule.bIsDirty)
+			{
+				RebuildSchedule(static_cast<ETickGroup>(GroupIndex));
+			}
+		}
+
+		// Waves only grow while ticking has stopped, so they can be walked without the lock
+		for (FTickWave& Wave : Schedule.Waves)
+		{
+			// Batches never span runs, so each one only holds a single type
+			_TickBatches.clear();
+			for (FTickRun& Run : Wave.Runs)
+			{
+				const size_t BatchSize = bHasWorkers ? k_TickBatchSize : std::max<size_t>(Run.Tickables.size(), 1);
+				for (size_t Begin = 0; Begin < Run.Tickables.size(); Begin += BatchSize)
+				{
+					_TickBatches.push_back(FTickBatch{ &Run, Begin, std::min(Begin + BatchSize, Run.Tickables.size()) });
+				}
+			}
+
+			FJobSystem::Get().ParallelFor(_TickBatches.size(), 1, [this, &DeltaSeconds](size_t BatchIndex)
+			{
+				const FTickBatch& Batch = _TickBatches[BatchIndex];
+
+				// One marker per batch rather than per tickable, so big boards do not flood the profiler.
+				//	Type names live as long as their types, so they can name markers.
+				GE_PROFILE_SCOPE(Batch.Run->Type->GetName().c_str());
+				for (size_t RunSlot = Batch.Begin; RunSlot < Batch.End; ++RunSlot)
+				{
+					ITickable* Tickable = Batch.Run->Tickables[RunSlot].load(std::memory_order_acquire);
+					if (Tickable != nullptr)
+					{
+						Tickable->Tick(DeltaSeconds);
+					}
+				}
+			});
+		}
+	}
+
+	std::lock_guard<std::mutex> Lock(_Mutex);
+	_bIsTicking = false;
+
+	for (FTickGroupSchedule& Schedule : _TickGroups)
+	{
+		RemoveClearedSlots(Schedule);
+	}
+
+	for (ITickable* Tickable : _PendingRegistrations)
+	{
+		AddToGroup(Tickable);
+	}
+	_PendingRegistrations.clear();
+}
+
+size_t FTickManager::GetNumTickWaves(ETickGroup TickGroup) const
+{
+	check(TickGroup < ETickGroup::Count);
+	return _TickGroups[static_cast<size_t>(TickGroup)].Waves.size();
+}
+
+void FTickManager::RegisterTickable(ITickable* Tickable, const OType_Struct* TickType)
+{
+	check(Tickable != nullptr && TickType != nullptr);
+
+	std::lock_guard<std::mutex> Lock(_Mutex);
+
+	if (Tickable->_TickManager != nullptr)
+	{
+		check(Tickable->_TickManager == this);
+		return;
+	}
+
+	Tickable->_TickManager = this;
+	Tickable->_TickType = TickType;
+	++_NumTickables;
+
+	if (_bIsTicking)
+	{
+		_PendingRegistrations.push_back(Tickable);
+	}
+	else
+	{
+		AddToGroup(Tickable);
+	}
+}
+
+void FTickManager::UnregisterTickable(ITickable* Tickable)
+{
+	check(Tickable != nullptr);
+
+	std::lock_guard<std::mutex> Lock(_Mutex);
+
+	if (Tickable->_TickManager == nullptr)
+	{
+		return;
+	}
+
+	check(Tickable->_TickManager == this);
+
+	if (Tickable->_TickSlot < 0)
+	{
+		// Never made it out of the pending list
+		auto PendingIt = std::find(_PendingRegistrations.begin(), _PendingRegistrations.end(), Tickable);
+		check(PendingIt != _PendingRegistrations.end());
+		_PendingRegistrations.erase(PendingIt);
+	}
+	else
+	{
+		FTickGroupSchedule& Schedule = _TickGroups[static_cast<size_t>(Tickable->_TickGroup)];
+		check(Schedule.Registered[Tickable->_TickSlot] == Tickable);
+
+		// Swap the last tickable into the vacated slot
+		ITickable* MovedTickable = Schedule.Registered.back();
+		Schedule.Registered[Tickable->_TickSlot] = MovedTickable;
+		MovedTickable->_TickSlot = Tickable->_TickSlot;
+		Schedule.Registered.pop_back();
+
+		if (Tickable->_TickRunIndex >= 0)
+		{
+			const FClearedSlot Slot{ Tickable->_TickWave, Tickable->_TickRunIndex, Tickable->_TickRunSlot };
+			if (_bIsTicking)
+			{
+				// The run may be mid-walk, so clear the entry rather than moving anything
+				Schedule.Waves[Slot.Wave].Runs[Slot.RunIndex].Tickables[Slot.RunSlot].store(nullptr, std::memory_order_release);
+				Schedule.ClearedSlots.push_back(Slot);
+			}
+			else
+			{
+				RemoveFromRun(Schedule, Slot);
+			}
+		}
+	}
+
+	Tickable->_TickManager = nullptr;
+	Tickable->_TickType = nullptr;
+	Tickable->_TickSlot = -1;
+	Tickable->_TickRunIndex = -1;
+	Tickable->_TickRunSlot = -1;
+	--_NumTickables;
+}
+
+void FTickManager::MarkScheduleDirty(ETickGroup TickGroup)
+{
+	std::lock_guard<std::mutex> Lock(_Mutex);
+	_TickGroups[static_cast<size_t>(TickGroup)].bIsDirty = true;
+}
+
+void FTickManager::AddToGroup(ITickable* Tickable)
+{
+	FTickGroupSchedule& Schedule = _TickGroups[static_cast<size_t>(Tickable->_TickGroup)];
+	Tickable->_TickSlot = static_cast<sf::Int32>(Schedule.Registered.size());
+	Schedule.Registered.push_back(Tickable);
+	Tickable->_TickRunIndex = -1;
+	Tickable->_TickRunSlot = -1;
+
+	if (Schedule.bIsDirty)
+	{
+		// Placed along with everything else once the schedule is rebuilt
+		return;
+	}
+
+	// Everything placed already has its wave, so this goes right after its latest prerequisite
+	sf::Int32 Wave = 0;
+	for (ITickable* Prerequisite : Tickable->_TickPrerequisites)
+	{
+		if (IsWaitingOn(Tickable, Prerequisite))
+		{
+			Wave = std::max(Wave, Prerequisite->_TickWave + 1);
+		}
+	}
+
+	// Dependents placed in the same wave or earlier would have to move, which takes a rebuild
+	for (ITickable* Dependent : Tickable->_TickDependents)
+	{
+		if (Dependent->_TickManager == this && IsWaitingOn(Dependent, Tickable) && Dependent->_TickWave <= Wave)
+		{
+			Schedule.bIsDirty = true;
+			return;
+		}
+	}
+
+	PlaceInWave(Schedule, Tickable, Wave);
+}
+
+void FTickManager::PlaceInWave(FTickGroupSchedule& Schedule, ITickable* Tickable, sf::Int32 Wave)
+{
+	check(Wave >= 0);
+	while (Schedule.Waves.size() <= static_cast<size_t>(Wave))
+	{
+		Schedule.Waves.emplace_back();
+	}
+
+	// Waves hold a handful of types, so a walk beats a lookup table
+	std::deque<FTickRun>& Runs = Schedule.Waves[Wave].Runs;
+	size_t RunIndex = 0;
+	while (RunIndex < Runs.size() && Runs[RunIndex].Type != Tickable->_TickType)
+	{
+		++RunIndex;
+	}
+
+	if (RunIndex == Runs.size())
+	{
+		Runs.emplace_back();
+		Runs.back().Type = Tickable->_TickType;
+	}
+
+	std::deque<std::atomic<ITickable*>>& RunTickables = Runs[RunIndex].Tickables;
+	Tickable->_TickWave = Wave;
+	Tickable->_TickRunIndex = static_cast<sf::Int32>(RunIndex);
+	Tickable->_TickRunSlot = static_cast<sf::Int32>(RunTickables.size());
+	RunTickables.emplace_back(Tickable);
+}
+
+void FTickManager::RemoveFromRun(FTickGroupSchedule& Schedule, const FClearedSlot& Slot)
+{
+	std::deque<std::atomic<ITickable*>>& RunTickables = Schedule.Waves[Slot.Wave].Runs[Slot.RunIndex].Tickables;
+	check(static_cast<size_t>(Slot.RunSlot) < RunTickables.size());
+
+	ITickable* MovedTickable = RunTickables.back().load(std::memory_order_relaxed);
+	RunTickables[Slot.RunSlot].store(MovedTickable, std::memory_order_relaxed);
+	if (MovedTickable != nullptr)
+	{
+		MovedTickable->_TickRunSlot = Slot.RunSlot;
+	}
+	RunTickables.pop_back();
+}
+
+void FTickManager::RemoveClearedSlots(FTickGroupSchedule& Schedule)
+{
+	// Highest first, so the entry swapped into a cleared slot is never another cleared one
+	std::sort(Schedule.ClearedSlots.begin(), Schedule.ClearedSlots.end(), [](const FClearedSlot& Lhs, const FClearedSlot& Rhs)
+	{
+		return Lhs.RunSlot > Rhs.RunSlot;
+	});
+
+	for (const FClearedSlot& Slot : Schedule.ClearedSlots)
+	{
+		RemoveFromRun(Schedule, Slot);
+	}
+	Schedule.ClearedSlots.clear();
+}
+
+void FTickManager::RebuildSchedule(ETickGroup TickGroup)
+{
+	FTickGroupSchedule& Schedule = _TickGroups[static_cast<size_t>(TickGroup)];
+
+	for (ITickable* Tickable : Schedule.Registered)
+	{
+		Tickable->_TickWave = k_WaveUnresolved;
+	}
+
+	for (ITickable* Tickable : Schedule.Registered)
+	{
+		if (Tickable->_TickWave == k_WaveUnresolved)
+		{
+			ResolveWave(Tickable);
+		}
+	}
+
+	// Anything cleared from the old runs goes away with them
+	Schedule.Waves.clear();
+	Schedule.ClearedSlots.clear();
+	for (ITickable* Tickable : Schedule.Registered)
+	{
+		PlaceInWave(Schedule, Tickable, Tickable->_TickWave);
+	}
+
+	Schedule.bIsDirty = false;
+}
+
+void FTickManager::ResolveWave(ITickable* Tickable)
+{
+	// Walks prerequisites depth first without recursion, since chains can get long
+	struct FVisit
+	{
+		ITickable* Tickable;
+		size_t NextPrerequisite;
+		sf::Int32 Wave;
+	};
+
+	std::vector<FVisit> VisitStack;
+	VisitStack.push_back(FVisit{ Tickable, 0, 0 });
+	Tickable->_TickWave = k_WaveResolving;
+
+	while (!VisitStack.empty())
+	{
+		FVisit& Visit = VisitStack.back();
+		if (Visit.NextPrerequisite < Visit.Tickable->_TickPrerequisites.size())
+		{
+			ITickable* Prerequisite = Visit.Tickable->_TickPrerequisites[Visit.NextPrerequisite++];
+			if (!IsWaitingOn(Visit.Tickable, Prerequisite))
+			{
+				continue;
+			}
+
+			if (Prerequisite->_TickWave == k_WaveResolving)
+			{
+				GE_LOG(LogTickManager, Warning, "Tick prerequisites of a %s form a cycle, one will be ignored.",
+					   Visit.Tickable->_TickType->GetName().c_str());
+				continue;
+			}
+
+			if (Prerequisite->_TickWave == k_WaveUnresolved)
+			{
+				Prerequisite->_TickWave = k_WaveResolving;
+				VisitStack.push_back(FVisit{ Prerequisite, 0, 0 });
+				continue;
+			}
+
+			Visit.Wave = std::max(Visit.Wave, Prerequisite->_TickWave + 1);
+		}
+		else
+		{
+			const sf::Int32 ResolvedWave = Visit.Wave;
+			Visit.Tickable->_TickWave = ResolvedWave;
+			VisitStack.pop_back();
+
+			if (!VisitStack.empty())
+			{
+				VisitStack.back().Wave = std::max(VisitStack.back().Wave, ResolvedWave + 1);
+			}
+		}
+	}
+}
+
+bool FTickManager::IsWaitingOn(const ITickable* Tickable, const ITickable* Prerequisite) const
+{
+	// Unregistered prerequisites, and ones waiting for next tick, have nothing to wait on
+	if (Prerequisite->_TickManager != this || Prerequisite->_TickSlot < 0)
+	{
+		return false;
+	}
+
+	if (Prerequisite->_TickGroup > Tickable->_TickGroup)
+	{
+		GE_LOG(LogTickManager, Warning, "A %s has a tick prerequisite in a later tick group, it will be ignored.",
+			   Tickable->_TickType->GetName().c_str());
+		return false;
+	}
+
+	return Prerequisite->_TickGroup == Tickable->_TickGroup;
+}
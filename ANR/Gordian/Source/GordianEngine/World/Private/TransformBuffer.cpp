@@ -0,0 +1,132 @@
+// Gordian by Daniel Luna (2019)
+
+#include "GordianEngine/World/Public/TransformBuffer.h"
+
+#include <cmath>
+
+#include "GordianEngine/Debug/Public/Asserts.h"
+
+using namespace Gordian;
+
+namespace
+{
+	// Blends From to To by Alpha. Kept free of branches so the loops below vectorize.
+	void BlendArrays(const float* From, const float* To, float* Out, size_t Count, float Alpha)
+	{
+		for (size_t Index = 0; Index < Count; ++Index)
+		{
+			Out[Index] = From[Index] + (To[Index] - From[Index]) * Alpha;
+		}
+	}
+
+	// Like BlendArrays, but wraps the difference into [-180, 180) degrees first
+	void BlendAngleArrays(const float* From, const float* To, float* Out, size_t Count, float Alpha)
+	{
+		for (size_t Index = 0; Index < Count; ++Index)
+		{
+			float Delta = To[Index] - From[Index];
+			Delta -= 360.f * std::floor(Delta * (1.f / 360.f) + 0.5f);
+			Out[Index] = From[Index] + Delta * Alpha;
+		}
+	}
+}
+
+FTransformBuffer::FTransformBuffer()
+	: _PreviousX()
+	, _PreviousY()
+	, _PreviousRotation()
+	, _CurrentX()
+	, _CurrentY()
+	, _CurrentRotation()
+	, _RenderX()
+	, _RenderY()
+	, _RenderRotation()
+	, _FreeSlots()
+{
+}
+
+sf::Int32 FTransformBuffer::Allocate(const sf::Vector2f& Position, float Rotation)
+{
+	sf::Int32 Slot = -1;
+	if (!_FreeSlots.empty())
+	{
+		Slot = _FreeSlots.back();
+		_FreeSlots.pop_back();
+	}
+	else
+	{
+		Slot = static_cast<sf::Int32>(_CurrentX.size());
+		for (std::vector<float>* Field : { &_PreviousX, &_PreviousY, &_PreviousRotation,
+										   &_CurrentX, &_CurrentY, &_CurrentRotation,
+										   &_RenderX, &_RenderY, &_RenderRotation })
+		{
+			Field->push_back(0.f);
+		}
+	}
+
+	_CurrentX[Slot] = Position.x;
+	_CurrentY[Slot] = Position.y;
+	_CurrentRotation[Slot] = Rotation;
+	Teleport(Slot);
+
+	return Slot;
+}
+
+void FTransformBuffer::Release(sf::Int32 Slot)
+{
+	check(Slot >= 0 && static_cast<size_t>(Slot) < _CurrentX.size());
+
+	// Released slots keep interpolating in place, which is cheaper than skipping them
+	_FreeSlots.push_back(Slot);
+}
+
+void FTransformBuffer::BeginTick()
+{
+	_PreviousX = _CurrentX;
+	_PreviousY = _CurrentY;
+	_PreviousRotation = _CurrentRotation;
+}
+
+void FTransformBuffer::Interpolate(float Alpha)
+{
+	const size_t Count = _CurrentX.size();
+	BlendArrays(_PreviousX.data(), _CurrentX.data(), _RenderX.data(), Count, Alpha);
+	BlendArrays(_PreviousY.data(), _CurrentY.data(), _RenderY.data(), Count, Alpha);
+	BlendAngleArrays(_PreviousRotation.data(), _CurrentRotation.data(), _RenderRotation.data(), Count, Alpha);
+}
+
+void FTransformBuffer::SetPosition(sf::Int32 Slot, const sf::Vector2f& Position)
+{
+	_CurrentX[Slot] = Position.x;
+	_CurrentY[Slot] = Position.y;
+}
+
+sf::Vector2f FTransformBuffer::GetPosition(sf::Int32 Slot) const
+{
+	return sf::Vector2f(_CurrentX[Slot], _CurrentY[Slot]);
+}
+
+void FTransformBuffer::SetRotation(sf::Int32 Slot, float Rotation)
+{
+	_CurrentRotation[Slot] = Rotation;
+}
+
+float FTransformBuffer::GetRotation(sf::Int32 Slot) const
+{
+	return _CurrentRotation[Slot];
+}
+
+void FTransformBuffer::Teleport(sf::Int32 Slot)
+{
+	_PreviousX[Slot] = _RenderX[Slot] = _CurrentX[Slot];
+	_PreviousY[Slot] = _RenderY[Slot] = _CurrentY[Slot];
+	_PreviousRotation[Slot] = _RenderRotation[Slot] = _CurrentRotation[Slot];
+}
+
+sf::Transform FTransformBuffer::GetRenderTransform(sf::Int32 Slot) const
+{
+	sf::Transform RenderTransform;
+	RenderTransform.translate(_RenderX[Slot], _RenderY[Slot]);
+	RenderTransform.rotate(_RenderRotation[Slot]);
+	return RenderTransform;
+}
@@ -4,6 +4,10 @@
 #include "GordianEngine/Core/Public/Gordian.h"
 
 #include "GordianEngine/Actor/Public/Actor.h"
+#include "GordianEngine/Actor/Public/ActorComponent.h"
+#include "GordianEngine/ActorComponents/Public/TransformComponent.h"
+#include "GordianEngine/Debug/Public/Profiler.h"
+#include "GordianEngine/FileIO/Public/ObjectSerializer.h"
 
 using namespace Gordian;
 
@@ -11,11 +15,26 @@ OWorld::OWorld(const std::string& InName, OObject* InOwningObject)
 	: Parent(InName, InOwningObject)
 	, _Actors{}
 	, _CurrentlyLoadedLevel(nullptr)
+	, _TickManager()
+	, _TransformBuffer()
+	, _LastTickDuration(sf::Time::Zero)
+	, _SpriteBatch()
 	, TestActorSpecification(nullptr)
 {
 	GetStaticType()->EnsureInitialization();
 }
 
+OWorld::~OWorld()
+{
+	// Actors are owned by the world, so they go back to their pools with it
+	for (AActor* Actor : _Actors)
+	{
+		FGlobalObjectLibrary::DestroyObject(Actor);
+	}
+
+	_Actors.clear();
+}
+
 const OWorld* OWorld::GetWorld() const
 {
 	return this;
@@ -47,23 +66,31 @@ void OWorld::BeginPlay()
 
 void OWorld::Tick(const sf::Time& DeltaSeconds)
 {
+	GE_PROFILE_SCOPE("OWorld::Tick");
+
 	if (!IsObjectFlagSet(EObjectFlags::HasCompleteBeginPlay))
 	{
 		BeginPlay();
 	}
 
-	for (AActor* Actor : _Actors)
-	{
-		Actor->Tick(DeltaSeconds);
-	}
+	// Whatever moves this tick blends from where it was last tick
+	_TransformBuffer.BeginTick();
+	_LastTickDuration = DeltaSeconds;
+
+	_TickManager.Tick(DeltaSeconds);
 }
 
 void OWorld::Render(sf::Time BlendTime, sf::RenderTarget& Target, sf::RenderStates States) const
 {
+	const float BlendFactor = _LastTickDuration > sf::Time::Zero ? BlendTime / _LastTickDuration : 1.f;
+	_TransformBuffer.Interpolate(BlendFactor < 1.f ? BlendFactor : 1.f);
+
 	for (AActor* Actor : _Actors)
 	{
-		Actor->Render(BlendTime, Target, States);
+		Actor->QueueRender(BlendTime, _SpriteBatch, sf::Transform::Identity);
 	}
+
+	_SpriteBatch.Flush(Target, States);
 }
 
 bool OWorld::LoadLevel(const OLevel* LevelToLoad)
@@ -71,12 +98,71 @@ bool OWorld::LoadLevel(const OLevel* LevelToLoad)
 	return _CurrentlyLoadedLevel == LevelToLoad;
 }
 
+bool OWorld::SaveState(std::vector<char>& OutData) const
+{
+	return FObjectSerializer::Save(this, OutData);
+}
+
+bool OWorld::LoadState(const std::vector<char>& Data)
+{
+	// Loading fills in _Actors, so the current ones are set aside until it succeeds
+	std::vector<AActor*> PreviousActors;
+	PreviousActors.swap(_Actors);
+
+	std::vector<OObject*> LoadedObjects;
+	if (!FObjectSerializer::Load(this, Data.data(), Data.size(), &LoadedObjects))
+	{
+		_Actors.swap(PreviousActors);
+		return false;
+	}
+
+	// Nothing may tick the old actors once they are gone
+	for (AActor* Actor : PreviousActors)
+	{
+		UnregisterActorFromWorld(Actor);
+		FGlobalObjectLibrary::DestroyObject(Actor);
+	}
+
+	// Loaded actors still need to be hooked up to ticking, so register them like new ones
+	std::vector<AActor*> LoadedActors;
+	LoadedActors.swap(_Actors);
+	for (AActor* Actor : LoadedActors)
+	{
+		if (Actor != nullptr)
+		{
+			RegisterActorWithWorld(Actor);
+		}
+	}
+
+	return true;
+}
+
 bool OWorld::RegisterActorWithWorld(AActor* ActorToRegister)
 {
 	check(ActorToRegister != nullptr);
 
 	// todo: add checks to ensure object is already properly initialized before registering successfully
 	_Actors.push_back(ActorToRegister);
+	ActorToRegister->_RegisteredWorld = this;
+
+	if (ActorToRegister->IsTicking())
+	{
+		_TickManager.RegisterActor(ActorToRegister);
+	}
+
+	for (OActorComponent* ActorComponent : ActorToRegister->_ActorComponents)
+	{
+		if (ActorComponent->IsTicking())
+		{
+			_TickManager.RegisterComponent(ActorComponent);
+		}
+
+		OTransformComponent* TransformComponent = Cast<OTransformComponent>(ActorComponent);
+		if (TransformComponent != nullptr)
+		{
+			TransformComponent->RegisterWithBuffer(_TransformBuffer);
+		}
+	}
 
 	if (IsObjectFlagSet(EObjectFlags::HasCompleteBeginPlay) 
 		&& !ActorToRegister->IsObjectFlagSet(EObjectFlags::HasInitiatedBeginPlay))
@@ -87,6 +173,24 @@ bool OWorld::RegisterActorWithWorld(AActor* ActorToRegister)
 	return true;
 }
 
+void OWorld::UnregisterActorFromWorld(AActor* ActorToUnregister)
+{
+	check(ActorToUnregister != nullptr);
+
+	if (ActorToUnregister->_RegisteredWorld != this)
+	{
+		return;
+	}
+
+	_TickManager.UnregisterActor(ActorToUnregister);
+	for (OActorComponent* ActorComponent : ActorToUnregister->_ActorComponents)
+	{
+		_TickManager.UnregisterComponent(ActorComponent);
+	}
+
+	ActorToUnregister->_RegisteredWorld = nullptr;
+}
+
 RCLASS_INITIALIZE(OWorld)
 RCLASS_BEGIN_MEMBER_LIST()
 RCLASS_MEMBER_ADD(_Actors)
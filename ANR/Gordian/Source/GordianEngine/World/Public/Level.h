@@ -13,7 +13,7 @@ namespace Gordian
 class AActor;
 
 // Stores the actors that define a level.
-// Will eventually support serialization to a file 
+// Levels are saved with FObjectSerializer, and loaded by mapping the file and reading it in place.
 class OLevel : public OObject
 {
 	REFLECT_CLASS(OObject)
@@ -22,8 +22,12 @@ class OLevel : public OObject
 
 	bool IsValid() const { return _ErrorCode == 0; }
 
+	// Loads the level saved at InFilePath into this, returning true if successful
 	bool LoadLevel(const std::string& InFilePath);
 
+	// Saves this level to InFilePath, returning true if successful
+	bool SaveLevel(const std::string& InFilePath) const;
+
 private:
 
 	errno_t _ErrorCode;
@@ -0,0 +1,152 @@
+// Gordian by Daniel Luna (2019)
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <deque>
+#include <mutex>
+#include <vector>
+
+#include "SFML/Config.hpp"
+#include "SFML/System/NonCopyable.hpp"
+#include "SFML/System/Time.hpp"
+
+#include "GordianEngine/Core/Public/Tickable.h"
+
+namespace Gordian
+{
+
+class AActor;
+class OActorComponent;
+class OType_Struct;
+
+
+// Keeps track of everything in a world that ticks, and in what order.
+// Groups tick one after another. Inside a group, tickables are sorted into waves
+//	where each wave only depends on earlier waves, and every wave is spread across
+//	the job system's workers. Within a wave, tickables of the same type tick back to back.
+// Registering and unregistering slot straight into or out of the schedule. It is only
+//	rebuilt when a prerequisite is added, or a new tickable has to tick before one already placed.
+class FTickManager : public sf::NonCopyable
+{
+	friend ITickable;
+
+public:
+
+	FTickManager();
+	~FTickManager();
+
+	// Adds an actor to the tick lists. Does nothing if it is already registered.
+	void RegisterActor(AActor* Actor);
+	// Removes an actor from the tick lists. Does nothing if it is not registered.
+	void UnregisterActor(AActor* Actor);
+
+	// Adds a component to the tick lists. Does nothing if it is already registered.
+	void RegisterComponent(OActorComponent* Component);
+	// Removes a component from the tick lists. Does nothing if it is not registered.
+	void UnregisterComponent(OActorComponent* Component);
+
+	// Ticks every group in order.
+	// Tickables registered mid-tick start ticking next tick. Ones unregistered
+	//	mid-tick are skipped if they have not ticked yet.
+	void Tick(const sf::Time& DeltaSeconds);
+
+	// Returns how many tickables are registered, including any waiting for the next tick
+	inline size_t GetNumTickables() const
+	{
+		return _NumTickables;
+	}
+
+	// Returns how many waves the given group ran in last time it ticked
+	size_t GetNumTickWaves(ETickGroup TickGroup) const;
+
+private:
+
+	// Tickables of one type inside of a wave, ticked back to back
+	struct FTickRun
+	{
+		const OType_Struct* Type;
+		// Atomic so entries can be cleared by whoever unregisters them mid-tick.
+		// A deque, so entries stay put while the run grows.
+		std::deque<std::atomic<ITickable*>> Tickables;
+	};
+
+	struct FTickWave
+	{
+		// One run per type, in the order each type first showed up. Runs are never removed.
+		std::deque<FTickRun> Runs;
+	};
+
+	// A run entry cleared mid-tick, removed once the tick finishes
+	struct FClearedSlot
+	{
+		sf::Int32 Wave;
+		sf::Int32 RunIndex;
+		sf::Int32 RunSlot;
+	};
+
+	// Part of a run handed to one worker
+	struct FTickBatch
+	{
+		FTickRun* Run;
+		size_t Begin;
+		size_t End;
+	};
+
+	struct FTickGroupSchedule
+	{
+		// Everything registered to this group, in no particular order
+		std::vector<ITickable*> Registered;
+		// Registered tickables, split by wave and then by type
+		std::deque<FTickWave> Waves;
+		std::vector<FClearedSlot> ClearedSlots;
+		// Set when Waves no longer matches Registered
+		bool bIsDirty;
+	};
+
+	void RegisterTickable(ITickable* Tickable, const OType_Struct* TickType);
+	void UnregisterTickable(ITickable* Tickable);
+	void MarkScheduleDirty(ETickGroup TickGroup);
+
+	// Adds a tickable to its group's registered list, and to the schedule if it is up to date.
+	//	Expects the lock to be held.
+	void AddToGroup(ITickable* Tickable);
+
+	// Appends a tickable to its type's run in the given wave
+	void PlaceInWave(FTickGroupSchedule& Schedule, ITickable* Tickable, sf::Int32 Wave);
+
+	// Swaps the last entry of a run into RunSlot and shrinks the run
+	void RemoveFromRun(FTickGroupSchedule& Schedule, const FClearedSlot& Slot);
+
+	// Removes every run entry cleared while ticking. Expects the lock to be held.
+	void RemoveClearedSlots(FTickGroupSchedule& Schedule);
+
+	// Sorts a group into waves. Expects the lock to be held.
+	void RebuildSchedule(ETickGroup TickGroup);
+
+	// Works out the wave of a tickable and of any prerequisites it waits on
+	void ResolveWave(ITickable* Tickable);
+
+	// Returns true if Tickable must wait on Prerequisite inside of its own group
+	bool IsWaitingOn(const ITickable* Tickable, const ITickable* Prerequisite) const;
+
+	std::array<FTickGroupSchedule, static_cast<size_t>(ETickGroup::Count)> _TickGroups;
+
+	// Registered mid-tick, waiting to be added once the tick finishes
+	std::vector<ITickable*> _PendingRegistrations;
+
+	// Reused for every wave, so ticking does not allocate
+	std::vector<FTickBatch> _TickBatches;
+
+	size_t _NumTickables;
+
+	// Guards registration, since tickables may come and go from worker threads
+	std::mutex _Mutex;
+
+	// True while ticking. Registrations are deferred while this is set.
+	bool _bIsTicking;
+};
+
+
+};	// namespace Gordian
@@ -0,0 +1,75 @@
+// Gordian by Daniel Luna (2019)
+
+#pragma once
+
+#include <vector>
+
+#include "SFML/Config.hpp"
+#include "SFML/Graphics/Transform.hpp"
+#include "SFML/System/NonCopyable.hpp"
+#include "SFML/System/Vector2.hpp"
+
+namespace Gordian
+{
+
+
+// Holds the transforms of everything in a world that moves, so rendering can blend
+//	between the last two fixed ticks instead of snapping to the latest one.
+// Each transform keeps its state from the previous tick and the current tick. Every
+//	field is stored in its own array, so a whole world interpolates in a few tight loops.
+class FTransformBuffer : sf::NonCopyable
+{
+public:
+
+	FTransformBuffer();
+
+	// Reserves a slot, starting at Position and Rotation with no motion to blend
+	sf::Int32 Allocate(const sf::Vector2f& Position, float Rotation);
+	void Release(sf::Int32 Slot);
+
+	// Call at the start of every fixed tick, so the current state becomes the previous one
+	void BeginTick();
+
+	// Blends every transform between the previous and current tick.
+	//	Alpha is how far the render time is through the current tick, from 0 to 1.
+	void Interpolate(float Alpha);
+
+	void SetPosition(sf::Int32 Slot, const sf::Vector2f& Position);
+	sf::Vector2f GetPosition(sf::Int32 Slot) const;
+
+	// Rotations are in degrees, and blend the short way around
+	void SetRotation(sf::Int32 Slot, float Rotation);
+	float GetRotation(sf::Int32 Slot) const;
+
+	// Moves to the current state without blending from the previous one
+	void Teleport(sf::Int32 Slot);
+
+	// The transform worked out by the last Interpolate
+	sf::Transform GetRenderTransform(sf::Int32 Slot) const;
+
+	// Slots in use
+	inline size_t GetNumTransforms() const
+	{
+		return _CurrentX.size() - _FreeSlots.size();
+	}
+
+private:
+
+	std::vector<float> _PreviousX;
+	std::vector<float> _PreviousY;
+	std::vector<float> _PreviousRotation;
+
+	std::vector<float> _CurrentX;
+	std::vector<float> _CurrentY;
+	std::vector<float> _CurrentRotation;
+
+	std::vector<float> _RenderX;
+	std::vector<float> _RenderY;
+	std::vector<float> _RenderRotation;
+
+	// Released slots, reused before the arrays grow
+	std::vector<sf::Int32> _FreeSlots;
+};
+
+
+};
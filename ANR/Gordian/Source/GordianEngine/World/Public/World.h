@@ -13,7 +13,10 @@
 #include "GordianEngine/Core/Public/Object.h"
 #include "GordianEngine/Core/Public/Renderable.h"
 #include "GordianEngine/GlobalLibraries/Public/GlobalObjectLibrary.h"
+#include "GordianEngine/Rendering/Public/SpriteBatch.h"
 #include "GordianEngine/Reflection/Public/TSubtypeOf.h"
+#include "GordianEngine/World/Public/TickManager.h"
+#include "GordianEngine/World/Public/TransformBuffer.h"
 
 namespace Gordian
 {
@@ -28,11 +31,14 @@ public:
 	REFLECT_CLASS(OObject)
 
 	OWorld(const std::string& InName, OObject* InOwningObject);
+	virtual ~OWorld() override;
 
 	virtual const OWorld* GetWorld() const;
 
 	void BeginPlay();
 	void Tick(const sf::Time& DeltaSeconds);
+	// Queues every actor's sprites, then draws them in as few draw calls as possible.
+	//	Transforms are blended BlendTime into the last tick first.
 	virtual void Render(sf::Time BlendTime, sf::RenderTarget& Target, sf::RenderStates States) const;
 
 
@@ -41,6 +47,16 @@ public:
 	// Loads a level into this world, returning true if loading was successful.
 	bool LoadLevel(const OLevel* LevelToLoad);
 
+	// Save State -------------------------------------
+
+	// Saves every actor in this world, along with everything they own, to OutData.
+	//	Returns false if anything reflected could not be saved, leaving OutData as it was.
+	bool SaveState(std::vector<char>& OutData) const;
+
+	// Replaces every actor in this world with the ones saved in Data.
+	//	Returns false if Data could not be loaded, leaving the current actors in place.
+	bool LoadState(const std::vector<char>& Data);
+
 	// Temp Garbage -----------------------------------
 
 	TSubtypeOf<AActor*> TestActorSpecification;
@@ -58,7 +74,6 @@ public:
 		check(ActorType != nullptr);
 		ActorType->EnsureInitialization();
 
-		// todo: this should eventually use pooled objects where possible
 		T* NewActor = FGlobalObjectLibrary::CreateObject<T>(this, ActorType, ActorName);
 
 		if (NewActor != nullptr)
@@ -73,6 +88,27 @@ public:
 	// Returns whether the actor was successfully registered
 	bool RegisterActorWithWorld(AActor* ActorToRegister);
 
+	// Stops the actor and its components ticking in this world. Does not remove it from the actor list.
+	void UnregisterActorFromWorld(AActor* ActorToUnregister);
+
+	// Tracks everything in this world that ticks
+	inline FTickManager& GetTickManager()
+	{
+		return _TickManager;
+	}
+
+	// Holds the transform of every registered transform component
+	inline FTransformBuffer& GetTransformBuffer()
+	{
+		return _TransformBuffer;
+	}
+
+	// Number of draw calls the last render took
+	inline size_t GetNumDrawCalls() const
+	{
+		return _SpriteBatch.GetNumDrawCalls();
+	}
+
 private:
 
 	// A list of all actors managed directly by this world.
@@ -80,6 +116,17 @@ private:
 
 	const OLevel* _CurrentlyLoadedLevel;
 
+	FTickManager _TickManager;
+
+	// Interpolated in place while rendering, hence mutable
+	mutable FTransformBuffer _TransformBuffer;
+
+	// Length of the last tick, used to turn render blend times into blend factors
+	sf::Time _LastTickDuration;
+
+	// Refilled every render, but kept so its buffers are reused
+	mutable FSpriteBatch _SpriteBatch;
+
 };
 
 }
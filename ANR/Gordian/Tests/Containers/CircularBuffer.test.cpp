@@ -15,3 +15,32 @@ TEMPLATE_LIST_TEST_CASE("Circular Buffer can be resized", "[template][containers
 	}
 }
 
+TEMPLATE_LIST_TEST_CASE("Circular Buffer overwrites its oldest values once full", "[template][containers][circular_buffer]", CircularBufferTypeList)
+{
+	GIVEN("a full circular buffer")
+	{
+		const size_t Capacity = 3;
+		Gordian::TCircularBuffer<TestType> CircularBuffer(Capacity);
+		for (int Value = 1; Value <= 3; ++Value)
+		{
+			CircularBuffer.Enqueue(static_cast<TestType>(Value));
+		}
+
+		REQUIRE(CircularBuffer.IsFull());
+		CHECK(*CircularBuffer.Front() == static_cast<TestType>(1));
+		CHECK(*CircularBuffer.Back() == static_cast<TestType>(3));
+
+		WHEN("another value is enqueued")
+		{
+			CircularBuffer.Enqueue(static_cast<TestType>(4));
+
+			THEN("the oldest value is replaced, and the new one is at the back")
+			{
+				CHECK(CircularBuffer.Num() == Capacity);
+				CHECK(*CircularBuffer.Front() == static_cast<TestType>(2));
+				CHECK(*CircularBuffer.Back() == static_cast<TestType>(4));
+				CHECK(CircularBuffer.At(1) == static_cast<TestType>(3));
+			}
+		}
+	}
+}
@@ -2,6 +2,10 @@
 #include "GordianEngine/Containers/Public/TPrefixTree.h"
 #include "GordianEngine/Debug/Public/Exceptions.h"
 
+#include <string>
+#include <utility>
+#include <vector>
+
 using PrefixTreeTypeList = std::tuple<float, int>;
 
 TEMPLATE_LIST_TEST_CASE("Prefix Trees can be resized", "[template][containers][prefix_tree]", PrefixTreeTypeList)
@@ -260,3 +264,150 @@ TEMPLATE_LIST_TEST_CASE("Prefix Trees allow persistent insertion and lookup", "[
 	}
 }
 
+
+TEST_CASE("Prefix Trees keep every key findable as nodes split and the tree grows", "[containers][prefix_tree]")
+{
+	Gordian::TPrefixTree<int> PrefixTree(2);
+
+	// Prefixes, extensions and siblings of each other, inserted out of order
+	const char* const Keys[] = { "profile.export", "profile", "pro", "profile.clear", "stats", "p", "profiles", "stat" };
+	int NextValue = 0;
+	for (const char* Key : Keys)
+	{
+		REQUIRE(PrefixTree.Insert(Key, NextValue++));
+	}
+
+	CHECK(PrefixTree.Num() == NextValue);
+	CHECK_FALSE(PrefixTree.Insert("profile", 100));
+
+	NextValue = 0;
+	for (const char* Key : Keys)
+	{
+		CHECK(PrefixTree.At(Key) == NextValue++);
+	}
+
+	// Split points and partial keys are not words of their own
+	CHECK_FALSE(PrefixTree.Contains("profile."));
+	CHECK_FALSE(PrefixTree.Contains("prof"));
+	CHECK_FALSE(PrefixTree.Contains("statsx"));
+	CHECK_FALSE(PrefixTree.Contains(""));
+}
+
+TEST_CASE("Prefix Trees can be inserted into after being copied or moved", "[containers][prefix_tree]")
+{
+	Gordian::TPrefixTree<int> PrefixTree(16);
+	REQUIRE(PrefixTree.Insert("profile", 1));
+	REQUIRE(PrefixTree.Insert("stats", 2));
+
+	SECTION("copying keeps the reserved capacity")
+	{
+		Gordian::TPrefixTree<int> CopiedTree(PrefixTree);
+		CHECK(CopiedTree.MinCapacity() == PrefixTree.MinCapacity());
+		REQUIRE(CopiedTree.Insert("pro", 3));
+		REQUIRE(CopiedTree.Insert("profiles", 4));
+
+		CHECK(CopiedTree.At("profile") == 1);
+		CHECK(CopiedTree.At("profiles") == 4);
+		CHECK_FALSE(PrefixTree.Contains("pro"));
+
+		Gordian::TPrefixTree<int> AssignedTree;
+		AssignedTree = PrefixTree;
+		REQUIRE(AssignedTree.Insert("stat", 5));
+		CHECK(AssignedTree.At("stats") == 2);
+		CHECK(AssignedTree.Num() == 3);
+	}
+
+	SECTION("moving leaves the source empty, and both trees usable")
+	{
+		const size_t ExpectedMinCapacity = PrefixTree.MinCapacity();
+		Gordian::TPrefixTree<int> MovedTree(std::move(PrefixTree));
+		CHECK(MovedTree.MinCapacity() == ExpectedMinCapacity);
+		REQUIRE(MovedTree.Insert("pro", 3));
+		CHECK(MovedTree.At("profile") == 1);
+		CHECK(MovedTree.Num() == 3);
+
+		CHECK(PrefixTree.Num() == 0);
+		CHECK(PrefixTree.MinCapacity() == 0);
+		CHECK_FALSE(PrefixTree.Contains("profile"));
+		REQUIRE(PrefixTree.Insert("stat", 5));
+		CHECK(PrefixTree.At("stat") == 5);
+
+		Gordian::TPrefixTree<int> AssignedTree;
+		AssignedTree = std::move(MovedTree);
+		REQUIRE(AssignedTree.Insert("profiles", 4));
+		CHECK(AssignedTree.At("pro") == 3);
+		CHECK(MovedTree.Num() == 0);
+	}
+}
+
+TEST_CASE("Prefix Trees stream the words under a prefix", "[containers][prefix_tree]")
+{
+	Gordian::TPrefixTree<int> PrefixTree;
+	const char* const Keys[] = { "stats", "profile.export", "profile", "pause", "profile.clear", "stat" };
+	for (const char* Key : Keys)
+	{
+		REQUIRE(PrefixTree.Insert(Key, 0));
+	}
+
+	std::vector<std::string> Visited;
+	const auto Collect = [&Visited](std::string_view Key, int)
+	{
+		Visited.emplace_back(Key);
+		return true;
+	};
+
+	SECTION("words are visited in key order, including prefixes that end partway through a node")
+	{
+		CHECK(PrefixTree.ForEachWithPrefix("prof", 10, Collect) == 3);
+		CHECK(Visited == std::vector<std::string>{ "profile", "profile.clear", "profile.export" });
+	}
+
+	SECTION("no more than the requested number of words are visited")
+	{
+		CHECK(PrefixTree.ForEachWithPrefix("", 2, Collect) == 2);
+		CHECK(Visited == std::vector<std::string>{ "pause", "profile" });
+	}
+
+	SECTION("prefixes nothing starts with visit nothing")
+	{
+		CHECK(PrefixTree.ForEachWithPrefix("profiles", 10, Collect) == 0);
+		CHECK(PrefixTree.ForEachTopRankedWithPrefix("x", 10, Collect) == 0);
+	}
+
+	SECTION("ranked queries visit the highest ranked words first, ties in key order")
+	{
+		REQUIRE(PrefixTree.AddRank("profile.export", 3));
+		REQUIRE(PrefixTree.AddRank("stat"));
+		REQUIRE(PrefixTree.AddRank("pause"));
+		CHECK_FALSE(PrefixTree.AddRank("missing"));
+
+		CHECK(PrefixTree.ForEachTopRankedWithPrefix("", 4, Collect) == 4);
+		CHECK(Visited == std::vector<std::string>{ "profile.export", "pause", "stat", "profile" });
+	}
+
+	SECTION("visitors can stop a query early")
+	{
+		const auto StopAfterOne = [&Visited](std::string_view Key, int)
+		{
+			Visited.emplace_back(Key);
+			return false;
+		};
+
+		CHECK(PrefixTree.ForEachTopRankedWithPrefix("p", 10, StopAfterOne) == 1);
+		CHECK(Visited == std::vector<std::string>{ "pause" });
+	}
+
+	SECTION("shared prefixes cover every word under a prefix")
+	{
+		CHECK(PrefixTree.FindSharedPrefix("pr") == "profile");
+		CHECK(PrefixTree.FindSharedPrefix("profile.") == "profile.");
+		CHECK(PrefixTree.FindSharedPrefix("s") == "stat");
+		CHECK(PrefixTree.FindSharedPrefix("p") == "p");
+		CHECK(PrefixTree.FindSharedPrefix("x").empty());
+
+		Gordian::TPrefixTree<int> SingleBranchTree;
+		REQUIRE(SingleBranchTree.Insert("profile.clear", 0));
+		REQUIRE(SingleBranchTree.Insert("profile.export", 0));
+		CHECK(SingleBranchTree.FindSharedPrefix("") == "profile.");
+	}
+}
@@ -0,0 +1,131 @@
+#include <Catch.hpp>
+#include "GordianEngine/Actor/Public/Actor.h"
+#include "GordianEngine/Core/Public/EngineLoop.h"
+#include "GordianEngine/GlobalLibraries/Public/GlobalObjectLibrary.h"
+#include "GordianEngine/World/Public/World.h"
+
+#include <vector>
+
+namespace
+{
+	// Step given to every tick, in the order they ticked
+	std::vector<sf::Time> RecordedSteps;
+
+	// Frame length for a 60 Hz display
+	const sf::Time k_FrameTime = sf::microseconds(16667);
+}
+
+class AStepRecordingActor : public Gordian::AActor
+{
+	REFLECT_CLASS(Gordian::AActor)
+
+public:
+
+	AStepRecordingActor(const std::string& InName, Gordian::OObject* InOwningObject)
+		: Parent(InName, InOwningObject)
+	{
+		SetIsTicking(true);
+	}
+
+	virtual void Tick(const sf::Time& DeltaTime) override
+	{
+		RecordedSteps.push_back(DeltaTime);
+	}
+};
+
+RCLASS_INITIALIZE_EMPTY(AStepRecordingActor)
+
+// Runs the fixed step part of the loop without a window, input or rendering
+class FHeadlessStepLoop : public Gordian::FEngineLoop
+{
+public:
+
+	FHeadlessStepLoop()
+	{
+		using namespace Gordian;
+
+		TargetTickRate = 60;
+		MinTickRate = 15;
+		MaxTicksPerFrame = 5;
+		SetTickRate(TargetTickRate);
+
+		GameWorld = FGlobalObjectLibrary::CreateObject<OWorld>(nullptr, OWorld::GetStaticType(), "StepWorld");
+		GameWorld->SpawnActor<AStepRecordingActor>(AStepRecordingActor::GetStaticType(), "Recorder");
+	}
+
+	~FHeadlessStepLoop()
+	{
+		Gordian::FGlobalObjectLibrary::DestroyObject(GameWorld);
+		GameWorld = nullptr;
+	}
+
+	// Runs one frame as if ticks had been taking TickCost, so the rate adapts the same way every run
+	sf::Uint32 RunFrame(const sf::Time& FrameTime, const sf::Time& TickCost)
+	{
+		AverageTickCost = TickCost;
+		return ConsumeFrameTime(FrameTime);
+	}
+};
+
+namespace
+{
+	struct FStepRun
+	{
+		std::vector<sf::Time> Steps;
+		// Rate in use for each step
+		std::vector<sf::Uint32> TickRates;
+	};
+
+	// Ticks are slow for the first half of the run, then fast again
+	FStepRun RunAdaptingSchedule()
+	{
+		RecordedSteps.clear();
+
+		FStepRun Run;
+		FHeadlessStepLoop Loop;
+		for (int Frame = 0; Frame < 800; ++Frame)
+		{
+			const sf::Time TickCost = Frame < 400 ? sf::milliseconds(100) : sf::microseconds(500);
+			const sf::Uint32 NumTicks = Loop.RunFrame(k_FrameTime, TickCost);
+			Run.TickRates.insert(Run.TickRates.end(), NumTicks, Loop.GetTickRate());
+		}
+
+		Run.Steps = RecordedSteps;
+		return Run;
+	}
+}
+
+TEST_CASE("Engine loops tick in fixed steps while the tick rate adapts", "[core][engine_loop]")
+{
+	const FStepRun FirstRun = RunAdaptingSchedule();
+	REQUIRE(FirstRun.Steps.size() == FirstRun.TickRates.size());
+	REQUIRE_FALSE(FirstRun.Steps.empty());
+
+	THEN("every tick gets exactly the step of the rate it ran at")
+	{
+		for (size_t StepIndex = 0; StepIndex < FirstRun.Steps.size(); ++StepIndex)
+		{
+			REQUIRE(FirstRun.Steps[StepIndex] == sf::microseconds(1000000 / FirstRun.TickRates[StepIndex]));
+		}
+	}
+
+	THEN("the rate drops while ticks are slow and recovers once they are fast")
+	{
+		sf::Uint32 SlowestRate = FirstRun.TickRates.front();
+		for (sf::Uint32 TickRate : FirstRun.TickRates)
+		{
+			SlowestRate = TickRate < SlowestRate ? TickRate : SlowestRate;
+		}
+
+		CHECK(FirstRun.TickRates.front() == 60);
+		CHECK(SlowestRate == 15);
+		CHECK(FirstRun.TickRates.back() == 60);
+	}
+
+	THEN("the same frames give the same steps")
+	{
+		const FStepRun SecondRun = RunAdaptingSchedule();
+		REQUIRE(SecondRun.Steps == FirstRun.Steps);
+		REQUIRE(SecondRun.TickRates == FirstRun.TickRates);
+	}
+}
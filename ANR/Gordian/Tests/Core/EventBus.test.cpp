@@ -0,0 +1,139 @@
+#include <Catch.hpp>
+#include "GordianEngine/Core/Public/EventBus.h"
+
+#include <vector>
+
+namespace
+{
+	struct FTestEventA
+	{
+		int Value;
+	};
+
+	struct FTestEventB
+	{
+		int Value;
+	};
+
+	struct FTestSubscriber
+	{
+		// Negative for FTestEventB, so the order both types arrive in can be checked
+		std::vector<int> ReceivedValues;
+		Gordian::FEventBus* EventBus = nullptr;
+
+		void OnEventA(const FTestEventA& Event)
+		{
+			ReceivedValues.push_back(Event.Value);
+
+			// Small values post a follow up, which should wait for the next dispatch
+			if (EventBus != nullptr && Event.Value < 10)
+			{
+				EventBus->Post(FTestEventA{ Event.Value * 10 });
+			}
+		}
+
+		void OnEventB(const FTestEventB& Event)
+		{
+			ReceivedValues.push_back(-Event.Value);
+		}
+	};
+}
+
+TEST_CASE("Event buses dispatch queued events in batches by type", "[core][event_bus]")
+{
+	using namespace Gordian;
+
+	GIVEN("a bus with a subscriber to two event types")
+	{
+		FEventBus EventBus;
+		FTestSubscriber Subscriber;
+		EventBus.Subscribe<FTestEventA, FTestSubscriber, &FTestSubscriber::OnEventA>(&Subscriber);
+		EventBus.Subscribe<FTestEventB, FTestSubscriber, &FTestSubscriber::OnEventB>(&Subscriber);
+
+		WHEN("events of both types are posted interleaved")
+		{
+			EventBus.Post(FTestEventB{ 1 });
+			EventBus.Post(FTestEventA{ 20 });
+			EventBus.Post(FTestEventB{ 2 });
+			EventBus.Post(FTestEventA{ 30 });
+
+			THEN("they wait until the bus dispatches")
+			{
+				CHECK(Subscriber.ReceivedValues.empty());
+				CHECK(EventBus.GetNumQueuedEvents() == 4);
+			}
+
+			EventBus.Dispatch();
+
+			THEN("each type is dispatched together, in the order the types were first posted")
+			{
+				CHECK(Subscriber.ReceivedValues == std::vector<int>{ -1, -2, 20, 30 });
+				CHECK(EventBus.GetNumQueuedEvents() == 0);
+			}
+		}
+
+		WHEN("a type keeps only its last event")
+		{
+			EventBus.SetCoalescing<FTestEventA>(EEventCoalescing::KeepLast);
+			for (int Value = 20; Value < 25; ++Value)
+			{
+				EventBus.Post(FTestEventA{ Value });
+			}
+			EventBus.Post(FTestEventB{ 1 });
+			EventBus.Post(FTestEventB{ 2 });
+			EventBus.Dispatch();
+
+			THEN("only the last of that type is dispatched")
+			{
+				CHECK(Subscriber.ReceivedValues == std::vector<int>{ 24, -1, -2 });
+			}
+		}
+
+		WHEN("a subscriber posts while being dispatched to")
+		{
+			Subscriber.EventBus = &EventBus;
+			EventBus.Post(FTestEventA{ 1 });
+			EventBus.Dispatch();
+
+			THEN("the new event waits for the next dispatch")
+			{
+				CHECK(Subscriber.ReceivedValues == std::vector<int>{ 1 });
+				CHECK(EventBus.GetNumQueuedEvents() == 1);
+
+				EventBus.Dispatch();
+				CHECK(Subscriber.ReceivedValues == std::vector<int>{ 1, 10 });
+			}
+		}
+
+		WHEN("more events are posted than fit in the first queue")
+		{
+			const int NumEvents = 1000;
+			for (int Value = 0; Value < NumEvents; ++Value)
+			{
+				EventBus.Post(FTestEventB{ Value });
+			}
+			EventBus.Dispatch();
+
+			THEN("all of them are dispatched in order")
+			{
+				REQUIRE(Subscriber.ReceivedValues.size() == NumEvents);
+				for (int Value = 0; Value < NumEvents; ++Value)
+				{
+					CHECK(Subscriber.ReceivedValues[Value] == -Value);
+				}
+			}
+		}
+
+		WHEN("the subscriber unsubscribes")
+		{
+			EventBus.Unsubscribe<FTestEventA, FTestSubscriber, &FTestSubscriber::OnEventA>(&Subscriber);
+			EventBus.Post(FTestEventA{ 20 });
+			EventBus.Dispatch();
+
+			THEN("events of that type are no longer queued or received")
+			{
+				CHECK(Subscriber.ReceivedValues.empty());
+			}
+		}
+	}
+}
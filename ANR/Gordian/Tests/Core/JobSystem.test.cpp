@@ -0,0 +1,121 @@
+#include <Catch.hpp>
+#include "GordianEngine/Core/Public/JobSystem.h"
+#include "GordianEngine/Debug/Public/Asserts.h"
+#include "GordianEngine/Debug/Public/Exceptions.h"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+TEST_CASE("Job systems run every index of a parallel for exactly once", "[core][job_system]")
+{
+	GIVEN("a job system with no workers")
+	{
+		Gordian::FJobSystem JobSystem;
+		REQUIRE(JobSystem.GetNumWorkers() == 0);
+
+		WHEN("a parallel for is run")
+		{
+			const std::thread::id CallingThread = std::this_thread::get_id();
+			std::vector<size_t> VisitedIndices;
+			bool bRanOnCallingThread = true;
+
+			JobSystem.ParallelFor(100, 8, [&](size_t Index)
+			{
+				VisitedIndices.push_back(Index);
+				bRanOnCallingThread &= std::this_thread::get_id() == CallingThread;
+			});
+
+			THEN("it runs inline and in order")
+			{
+				REQUIRE(bRanOnCallingThread);
+				REQUIRE(VisitedIndices.size() == 100);
+				for (size_t Index = 0; Index < VisitedIndices.size(); ++Index)
+				{
+					REQUIRE(VisitedIndices[Index] == Index);
+				}
+			}
+		}
+	}
+
+	GIVEN("a job system with workers")
+	{
+		Gordian::FJobSystem JobSystem;
+		JobSystem.Start(3);
+		REQUIRE(JobSystem.GetNumWorkers() == 3);
+
+		WHEN("many parallel fors are run back to back")
+		{
+			const size_t Count = 1000;
+			std::vector<std::atomic<int>> VisitCounts(Count);
+			for (std::atomic<int>& VisitCount : VisitCounts)
+			{
+				VisitCount = 0;
+			}
+
+			for (int Run = 0; Run < 50; ++Run)
+			{
+				JobSystem.ParallelFor(Count, 7, [&VisitCounts](size_t Index)
+				{
+					++VisitCounts[Index];
+				});
+			}
+
+			THEN("every index is visited once per run")
+			{
+				for (const std::atomic<int>& VisitCount : VisitCounts)
+				{
+					REQUIRE(VisitCount == 50);
+				}
+			}
+		}
+
+		WHEN("the job system is stopped and started again")
+		{
+			JobSystem.Stop();
+			REQUIRE(JobSystem.GetNumWorkers() == 0);
+			JobSystem.Start(2);
+
+			std::atomic<size_t> Sum(0);
+			JobSystem.ParallelFor(100, 1, [&Sum](size_t Index)
+			{
+				Sum += Index;
+			});
+
+			THEN("work still completes")
+			{
+				REQUIRE(Sum == 4950);
+			}
+		}
+
+		WHEN("a batch fails a check")
+		{
+			using namespace Gordian;
+
+			std::atomic<size_t> NumVisited(0);
+			auto FailingParallelFor = [&]()
+			{
+				JobSystem.ParallelFor(1000, 8, [&NumVisited](size_t Index)
+				{
+					check(Index != 500);
+					++NumVisited;
+				});
+			};
+
+			THEN("the failure reaches the caller once the other batches finish, and later work still runs")
+			{
+				REQUIRE_THROWS_AS(FailingParallelFor(), Gordian::AssertionFailure);
+				REQUIRE(NumVisited >= 1000 - 8);
+
+				std::atomic<size_t> Sum(0);
+				JobSystem.ParallelFor(100, 1, [&Sum](size_t Index)
+				{
+					Sum += Index;
+				});
+				REQUIRE(Sum == 4950);
+			}
+		}
+
+		JobSystem.Stop();
+	}
+}
@@ -0,0 +1,113 @@
+#include <Catch.hpp>
+#include "GordianEngine/Debug/Public/BinaryLogWriter.h"
+#include "GordianEngine/Debug/Public/Logging.h"
+
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+DECLARE_LOG_CATEGORY_STATIC(LogBinaryLogWriterTest, All, Verbose)
+
+namespace
+{
+	const char* k_TestLogFilepath = "BinaryLogWriterTest.bin";
+
+	std::vector<char> ReadTestLog()
+	{
+		std::vector<char> Data;
+		FILE* File = nullptr;
+		if (fopen_s(&File, k_TestLogFilepath, "rb") == 0)
+		{
+			char Buffer[512];
+			size_t NumRead;
+			while ((NumRead = std::fread(Buffer, 1, sizeof(Buffer), File)) > 0)
+			{
+				Data.insert(Data.end(), Buffer, Buffer + NumRead);
+			}
+			std::fclose(File);
+		}
+		return Data;
+	}
+
+	template <typename T>
+	T ReadValue(const std::vector<char>& Data, size_t& InOutOffset)
+	{
+		T Value;
+		std::memcpy(&Value, Data.data() + InOutOffset, sizeof(T));
+		InOutOffset += sizeof(T);
+		return Value;
+	}
+}
+
+TEST_CASE("Binary log writers record logs without formatting them", "[debug][binary_log]")
+{
+	using namespace Gordian;
+	std::remove(k_TestLogFilepath);
+
+	GIVEN("a binary log writer with a single call site")
+	{
+		{
+			FBinaryLogWriter Writer(k_TestLogFilepath);
+			FBinaryLogSite Site(Writer, "LogTest", ELogVerbosity::Warning, "Test.cpp(1): Test", "%d %s %f");
+
+			WHEN("a log is written and flushed")
+			{
+				Writer.Write(Site, -7, "Hello", 0.5f);
+				Writer.Flush();
+
+				THEN("the file holds a session, the site and the log in order")
+				{
+					const std::vector<char> Data = ReadTestLog();
+					size_t Offset = 0;
+
+					REQUIRE(Data.size() > 3);
+					REQUIRE(ReadValue<EBinaryLogRecord>(Data, Offset) == EBinaryLogRecord::Session);
+					Offset += ReadValue<sf::Uint16>(Data, Offset);
+
+					REQUIRE(ReadValue<EBinaryLogRecord>(Data, Offset) == EBinaryLogRecord::Site);
+					const sf::Uint16 SitePayloadSize = ReadValue<sf::Uint16>(Data, Offset);
+					const size_t SiteEnd = Offset + SitePayloadSize;
+					REQUIRE(ReadValue<sf::Uint32>(Data, Offset) == Site.GetId());
+					REQUIRE(ReadValue<ELogVerbosity>(Data, Offset) == ELogVerbosity::Warning);
+					REQUIRE(ReadValue<sf::Uint16>(Data, Offset) == std::strlen("LogTest"));
+					Offset = SiteEnd;
+
+					REQUIRE(ReadValue<EBinaryLogRecord>(Data, Offset) == EBinaryLogRecord::Log);
+					const sf::Uint16 LogPayloadSize = ReadValue<sf::Uint16>(Data, Offset);
+					REQUIRE(Offset + LogPayloadSize == Data.size());
+					REQUIRE(ReadValue<sf::Uint32>(Data, Offset) == Site.GetId());
+					ReadValue<sf::Int64>(Data, Offset);
+
+					REQUIRE(ReadValue<EBinaryLogArg>(Data, Offset) == EBinaryLogArg::Int32);
+					REQUIRE(ReadValue<sf::Int32>(Data, Offset) == -7);
+
+					REQUIRE(ReadValue<EBinaryLogArg>(Data, Offset) == EBinaryLogArg::String);
+					REQUIRE(ReadValue<sf::Uint16>(Data, Offset) == 5);
+					REQUIRE(std::memcmp(Data.data() + Offset, "Hello", 5) == 0);
+					Offset += 5;
+
+					// Floats are widened to doubles, the same as printf would see them
+					REQUIRE(ReadValue<EBinaryLogArg>(Data, Offset) == EBinaryLogArg::Double);
+					REQUIRE(ReadValue<double>(Data, Offset) == 0.5);
+					REQUIRE(Offset == Data.size());
+				}
+			}
+		}
+
+		std::remove(k_TestLogFilepath);
+	}
+}
+
+TEST_CASE("Logs to both sinks evaluate their arguments once", "[debug][binary_log]")
+{
+	using namespace Gordian;
+
+	const ELogSink PreviousSinks = LogBinaryLogWriterTest.GetLogSinks();
+	LogBinaryLogWriterTest.SetLogSinks(ELogSink::TextAndBinary);
+
+	int NumEvaluations = 0;
+	GE_LOG(LogBinaryLogWriterTest, Log, "Evaluation %d", ++NumEvaluations);
+	REQUIRE(NumEvaluations == 1);
+
+	LogBinaryLogWriterTest.SetLogSinks(PreviousSinks);
+}
@@ -0,0 +1,143 @@
+#include <Catch.hpp>
+#include "GordianEngine/Debug/Public/LogOutputManager.h"
+
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+	const char* k_TestLogFilepath = "LogOutputManagerTest.txt";
+	const char* k_TestLogLocation = "LogOutputManager.test.cpp(1): Test";
+	const char* k_TestLogCategory = "LogOutputTest";
+
+	// Returns the message of every line logged in k_TestLogCategory, in file order
+	std::vector<std::string> ReadTestLogMessages()
+	{
+		std::vector<std::string> Messages;
+		FILE* File = nullptr;
+		if (fopen_s(&File, k_TestLogFilepath, "r") == 0)
+		{
+			const std::string CategoryPrefix = std::string(k_TestLogCategory) + " - ";
+			char Line[2048];
+			while (std::fgets(Line, sizeof(Line), File) != nullptr)
+			{
+				const char* const Message = std::strstr(Line, CategoryPrefix.c_str());
+				if (Message != nullptr)
+				{
+					Messages.emplace_back(Message + CategoryPrefix.size(), std::strcspn(Message + CategoryPrefix.size(), "\n"));
+				}
+			}
+			std::fclose(File);
+		}
+		return Messages;
+	}
+
+	// Logs NumLogs lines of "<Producer> <Index>" from each of NumProducers threads at once
+	void LogFromProducers(const Gordian::FLogOutputManager& Manager, int NumProducers, int NumLogs)
+	{
+		std::vector<std::thread> Producers;
+		for (int Producer = 0; Producer < NumProducers; ++Producer)
+		{
+			Producers.emplace_back([&Manager, Producer, NumLogs]()
+			{
+				for (int Index = 0; Index < NumLogs; ++Index)
+				{
+					Manager.PrintLog(k_TestLogCategory, Gordian::ELogVerbosity::Log, k_TestLogLocation, "%d %d", Producer, Index);
+				}
+			});
+		}
+
+		for (std::thread& Producer : Producers)
+		{
+			Producer.join();
+		}
+	}
+
+	// Checks every producer's logs all arrived, in the order each producer made them
+	void CheckProducerOrder(const std::vector<std::string>& Messages, int NumProducers, int NumLogs)
+	{
+		REQUIRE(Messages.size() == static_cast<size_t>(NumProducers * NumLogs));
+
+		std::vector<int> NextIndices(NumProducers, 0);
+		for (const std::string& Message : Messages)
+		{
+			int Producer = -1;
+			int Index = -1;
+			REQUIRE(std::sscanf(Message.c_str(), "%d %d", &Producer, &Index) == 2);
+			REQUIRE(Producer >= 0);
+			REQUIRE(Producer < NumProducers);
+			REQUIRE(Index == NextIndices[Producer]);
+			++NextIndices[Producer];
+		}
+	}
+}
+
+TEST_CASE("Log output managers write logs on the spot until their writer starts", "[debug][log_output]")
+{
+	using namespace Gordian;
+	std::remove(k_TestLogFilepath);
+
+	{
+		FLogOutputManager Manager(k_TestLogFilepath, 16);
+		Manager.PrintLog(k_TestLogCategory, ELogVerbosity::Log, k_TestLogLocation, "%s", "Before");
+		CHECK(ReadTestLogMessages() == std::vector<std::string>{ "Before" });
+	}
+
+	std::remove(k_TestLogFilepath);
+}
+
+TEST_CASE("Log output managers keep each thread's logs in order", "[debug][log_output]")
+{
+	using namespace Gordian;
+	std::remove(k_TestLogFilepath);
+
+	{
+		FLogOutputManager Manager(k_TestLogFilepath, 1024);
+		Manager.StartWriterThread();
+
+		LogFromProducers(Manager, 4, 50);
+		Manager.Flush();
+
+		CheckProducerOrder(ReadTestLogMessages(), 4, 50);
+	}
+
+	std::remove(k_TestLogFilepath);
+}
+
+TEST_CASE("Log output managers drain a full ring from the logging thread", "[debug][log_output]")
+{
+	using namespace Gordian;
+	std::remove(k_TestLogFilepath);
+
+	{
+		// Far more logs than records, so producers keep finding the ring full
+		FLogOutputManager Manager(k_TestLogFilepath, 2);
+		Manager.StartWriterThread();
+
+		LogFromProducers(Manager, 4, 25);
+		Manager.Flush();
+
+		CheckProducerOrder(ReadTestLogMessages(), 4, 25);
+	}
+
+	std::remove(k_TestLogFilepath);
+}
+
+TEST_CASE("Log output managers write out queued logs when destroyed", "[debug][log_output]")
+{
+	using namespace Gordian;
+	std::remove(k_TestLogFilepath);
+
+	{
+		FLogOutputManager Manager(k_TestLogFilepath, 64);
+		Manager.StartWriterThread();
+		LogFromProducers(Manager, 1, 32);
+	}
+
+	CheckProducerOrder(ReadTestLogMessages(), 1, 32);
+
+	std::remove(k_TestLogFilepath);
+}
@@ -0,0 +1,128 @@
+#include <Catch.hpp>
+#include "GordianEngine/Debug/Public/Profiler.h"
+
+#include <cstdio>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+	const char* k_TestTraceFilepath = "ProfilerTest.json";
+
+	std::string ReadTestTrace()
+	{
+		std::string Trace;
+		FILE* File = nullptr;
+		if (fopen_s(&File, k_TestTraceFilepath, "r") == 0)
+		{
+			char Buffer[512];
+			size_t NumRead;
+			while ((NumRead = std::fread(Buffer, 1, sizeof(Buffer), File)) > 0)
+			{
+				Trace.append(Buffer, NumRead);
+			}
+			std::fclose(File);
+		}
+		return Trace;
+	}
+
+	size_t CountOccurrences(const std::string& Text, const std::string& Pattern)
+	{
+		size_t Count = 0;
+		for (size_t Found = Text.find(Pattern); Found != std::string::npos; Found = Text.find(Pattern, Found + 1))
+		{
+			++Count;
+		}
+		return Count;
+	}
+}
+
+TEST_CASE("Profilers export scopes from every thread as a Chrome trace", "[debug][profiler]")
+{
+	using namespace Gordian;
+	FProfiler& Profiler = FProfiler::Get();
+	Profiler.Clear();
+	std::remove(k_TestTraceFilepath);
+
+	GIVEN("events recorded on the main thread and on other threads")
+	{
+		const size_t k_NumThreads = 4;
+		const size_t k_EventsPerWorker = 100;
+
+		{
+			FProfileScope Scope("MainThread \"Scope\"");
+		}
+
+		std::vector<std::thread> Threads;
+		for (size_t ThreadIndex = 0; ThreadIndex < k_NumThreads; ++ThreadIndex)
+		{
+			Threads.emplace_back([&Profiler, k_EventsPerWorker]()
+			{
+				for (size_t EventIndex = 0; EventIndex < k_EventsPerWorker; ++EventIndex)
+				{
+					Profiler.RecordEvent("WorkerEvent", Profiler.GetTimestamp(), 1);
+				}
+			});
+		}
+		for (std::thread& Thread : Threads)
+		{
+			Thread.join();
+		}
+
+		WHEN("the trace is exported")
+		{
+			REQUIRE(Profiler.ExportChromeTrace(k_TestTraceFilepath));
+			const std::string Trace = ReadTestTrace();
+
+			THEN("every event is written as a complete event")
+			{
+				CHECK(Trace.find("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[") == 0);
+				CHECK(CountOccurrences(Trace, "\"name\":\"WorkerEvent\"") == k_NumThreads * k_EventsPerWorker);
+				CHECK(CountOccurrences(Trace, "\"ph\":\"X\"") == k_NumThreads * k_EventsPerWorker + 1);
+				CHECK(Trace.rfind("]}") != std::string::npos);
+			}
+
+			THEN("names are escaped")
+			{
+				CHECK(Trace.find("\"name\":\"MainThread \\\"Scope\\\"\"") != std::string::npos);
+			}
+		}
+
+		WHEN("the profiler is cleared before exporting")
+		{
+			Profiler.Clear();
+			REQUIRE(Profiler.ExportChromeTrace(k_TestTraceFilepath));
+
+			THEN("no events are written")
+			{
+				CHECK(CountOccurrences(ReadTestTrace(), "\"ph\":\"X\"") == 0);
+			}
+		}
+	}
+
+	GIVEN("more events than a thread keeps")
+	{
+		for (size_t EventIndex = 0; EventIndex < FProfiler::k_EventsPerThread + 10; ++EventIndex)
+		{
+			Profiler.RecordEvent("Overflow", static_cast<sf::Int64>(EventIndex), 1);
+		}
+
+		WHEN("the trace is exported")
+		{
+			REQUIRE(Profiler.ExportChromeTrace(k_TestTraceFilepath));
+
+			THEN("only the most recent events are written")
+			{
+				// The oldest kept slot is the next to be written, so it is never exported
+				const std::string Trace = ReadTestTrace();
+				CHECK(CountOccurrences(Trace, "\"name\":\"Overflow\"") == FProfiler::k_EventsPerThread - 1);
+				CHECK(Trace.find("\"ts\":10,") == std::string::npos);
+				CHECK(Trace.find("\"ts\":11,") != std::string::npos);
+			}
+		}
+	}
+
+	Profiler.Clear();
+	std::remove(k_TestTraceFilepath);
+}
@@ -0,0 +1,138 @@
+#include <Catch.hpp>
+#include "GordianEngine/Delegates/ConcurrentMulticastDelegate.h"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+namespace
+{
+	struct FCounter
+	{
+		std::atomic<int> Total{ 0 };
+
+		void Add(int Value)
+		{
+			Total += Value;
+		}
+	};
+}
+
+TEST_CASE("Concurrent multicast delegates call every subscriber", "[delegates][concurrent_multicast_delegate]")
+{
+	using namespace Gordian;
+	using FIntDelegate = delegate<void(int)>;
+
+	concurrent_multicast_delegate<void(int)> Broadcaster;
+	FCounter First;
+	FCounter Second;
+
+	CHECK(Broadcaster.isNull());
+	Broadcaster(1);
+
+	GIVEN("two subscribers")
+	{
+		Broadcaster += FIntDelegate::create<FCounter, &FCounter::Add>(&First);
+		Broadcaster += FIntDelegate::create<FCounter, &FCounter::Add>(&Second);
+		REQUIRE(Broadcaster.size() == 2);
+
+		WHEN("it is broadcast")
+		{
+			Broadcaster(3);
+
+			THEN("both are called")
+			{
+				CHECK(First.Total == 3);
+				CHECK(Second.Total == 3);
+			}
+		}
+
+		WHEN("one unsubscribes")
+		{
+			Broadcaster -= FIntDelegate::create<FCounter, &FCounter::Add>(&First);
+			Broadcaster(3);
+
+			THEN("only the other is called")
+			{
+				CHECK(Broadcaster.size() == 1);
+				CHECK(First.Total == 0);
+				CHECK(Second.Total == 3);
+			}
+		}
+
+		WHEN("it is cleared")
+		{
+			Broadcaster.clear();
+			Broadcaster(3);
+
+			THEN("neither is called")
+			{
+				CHECK(Broadcaster.isNull());
+				CHECK(First.Total == 0);
+				CHECK(Second.Total == 0);
+			}
+		}
+	}
+}
+
+TEST_CASE("Concurrent multicast delegates survive many threads broadcasting and subscribing at once", "[delegates][concurrent_multicast_delegate]")
+{
+	using namespace Gordian;
+	using FIntDelegate = delegate<void(int)>;
+
+	const int k_NumProducers = 6;
+	const int k_BroadcastsPerProducer = 5000;
+	const int k_NumSubscribers = 2;
+	const int k_SubscriptionsPerSubscriber = 2000;
+
+	concurrent_multicast_delegate<void(int)> Broadcaster;
+
+	// Subscribed throughout, so it must see every broadcast exactly once
+	FCounter Permanent;
+	Broadcaster += FIntDelegate::create<FCounter, &FCounter::Add>(&Permanent);
+
+	// Come and go while the producers broadcast
+	std::vector<FCounter> Transient(k_NumSubscribers);
+
+	std::atomic<bool> bStart{ false };
+	std::vector<std::thread> Threads;
+
+	for (int Producer = 0; Producer < k_NumProducers; ++Producer)
+	{
+		Threads.emplace_back([&Broadcaster, &bStart, k_BroadcastsPerProducer]()
+		{
+			while (!bStart) {}
+			for (int Broadcast = 0; Broadcast < k_BroadcastsPerProducer; ++Broadcast)
+			{
+				Broadcaster(1);
+			}
+		});
+	}
+
+	for (int Subscriber = 0; Subscriber < k_NumSubscribers; ++Subscriber)
+	{
+		FCounter* Counter = &Transient[Subscriber];
+		Threads.emplace_back([&Broadcaster, &bStart, Counter, k_SubscriptionsPerSubscriber]()
+		{
+			while (!bStart) {}
+			for (int Subscription = 0; Subscription < k_SubscriptionsPerSubscriber; ++Subscription)
+			{
+				Broadcaster += FIntDelegate::create<FCounter, &FCounter::Add>(Counter);
+				Broadcaster -= FIntDelegate::create<FCounter, &FCounter::Add>(Counter);
+			}
+		});
+	}
+
+	bStart = true;
+	for (std::thread& Thread : Threads)
+	{
+		Thread.join();
+	}
+
+	CHECK(Permanent.Total == k_NumProducers * k_BroadcastsPerProducer);
+	CHECK(Broadcaster.size() == 1);
+	for (const FCounter& Counter : Transient)
+	{
+		CHECK(Counter.Total <= k_NumProducers * k_BroadcastsPerProducer);
+	}
+}
@@ -0,0 +1,258 @@
+#define CATCH_CONFIG_ENABLE_BENCHMARKING
+#include <Catch.hpp>
+#include "GordianEngine/Delegates/MulticastDelegate.h"
+
+#include <list>
+#include <vector>
+
+namespace
+{
+	struct FCallRecorder
+	{
+		std::vector<int> Calls;
+		Gordian::multicast_delegate<void(int)>* Broadcaster = nullptr;
+
+		void RecordOne(int Value) { Calls.push_back(Value + 1); }
+		void RecordTwo(int Value) { Calls.push_back(Value + 2); }
+		void RecordThree(int Value) { Calls.push_back(Value + 3); }
+
+		// Removes RecordThree from the broadcaster currently calling it
+		void RemoveThree(int Value)
+		{
+			Calls.push_back(Value);
+			*Broadcaster -= Gordian::delegate<void(int)>::create<FCallRecorder, &FCallRecorder::RecordThree>(this);
+		}
+
+		// Subscribes RecordOne to the broadcaster currently calling it
+		void AddOne(int Value)
+		{
+			Calls.push_back(Value);
+			*Broadcaster += Gordian::delegate<void(int)>::create<FCallRecorder, &FCallRecorder::RecordOne>(this);
+		}
+	};
+
+	int BenchmarkCounter = 0;
+
+	void IncrementBenchmarkCounter()
+	{
+		++BenchmarkCounter;
+	}
+
+	// How multicast_delegate stored subscribers before, kept to benchmark against
+	class FListMulticastDelegate
+	{
+	public:
+
+		using FStub = void(*)(void*);
+
+		~FListMulticastDelegate()
+		{
+			for (FElement* Element : InvocationList)
+			{
+				delete Element;
+			}
+		}
+
+		void Add(void* Object, FStub Stub)
+		{
+			InvocationList.push_back(new FElement{ Object, Stub });
+		}
+
+		void Broadcast() const
+		{
+			for (const FElement* Element : InvocationList)
+			{
+				Element->Stub(Element->Object);
+			}
+		}
+
+	private:
+
+		struct FElement
+		{
+			void* Object;
+			FStub Stub;
+		};
+
+		std::list<FElement*> InvocationList;
+	};
+
+	void IncrementBenchmarkCounterStub(void*)
+	{
+		++BenchmarkCounter;
+	}
+}
+
+TEST_CASE("Multicast delegates call every subscriber in order", "[delegates][multicast_delegate]")
+{
+	using namespace Gordian;
+	using FIntDelegate = delegate<void(int)>;
+
+	FCallRecorder Recorder;
+	multicast_delegate<void(int)> Broadcaster;
+	Recorder.Broadcaster = &Broadcaster;
+
+	GIVEN("more subscribers than are stored inline")
+	{
+		const int k_NumSubscribers = static_cast<int>(multicast_delegate<void(int)>::inlineCapacity) * 2 + 1;
+		for (int Subscriber = 0; Subscriber < k_NumSubscribers; ++Subscriber)
+		{
+			Broadcaster += FIntDelegate::create<FCallRecorder, &FCallRecorder::RecordOne>(&Recorder);
+		}
+		Broadcaster += FIntDelegate::create<FCallRecorder, &FCallRecorder::RecordTwo>(&Recorder);
+
+		REQUIRE(Broadcaster.size() == k_NumSubscribers + 1);
+
+		WHEN("it is broadcast")
+		{
+			Broadcaster(10);
+
+			THEN("every subscriber is called in the order it subscribed")
+			{
+				REQUIRE(Recorder.Calls.size() == k_NumSubscribers + 1);
+				CHECK(Recorder.Calls.front() == 11);
+				CHECK(Recorder.Calls.back() == 12);
+			}
+		}
+
+		WHEN("it is moved")
+		{
+			multicast_delegate<void(int)> MovedBroadcaster(std::move(Broadcaster));
+			MovedBroadcaster(0);
+
+			THEN("the subscribers move with it")
+			{
+				CHECK(MovedBroadcaster.size() == k_NumSubscribers + 1);
+				CHECK(Broadcaster.isNull());
+				CHECK(Recorder.Calls.size() == k_NumSubscribers + 1);
+			}
+		}
+
+		WHEN("it is cleared")
+		{
+			Broadcaster.clear();
+			Broadcaster(0);
+
+			THEN("nothing is called")
+			{
+				CHECK(Broadcaster.isNull());
+				CHECK(Recorder.Calls.empty());
+			}
+		}
+	}
+
+	GIVEN("a few subscribers")
+	{
+		Broadcaster += FIntDelegate::create<FCallRecorder, &FCallRecorder::RecordOne>(&Recorder);
+		Broadcaster += FIntDelegate::create<FCallRecorder, &FCallRecorder::RecordTwo>(&Recorder);
+		Broadcaster += FIntDelegate::create<FCallRecorder, &FCallRecorder::RecordThree>(&Recorder);
+
+		WHEN("one is removed")
+		{
+			Broadcaster -= FIntDelegate::create<FCallRecorder, &FCallRecorder::RecordTwo>(&Recorder);
+			Broadcaster(0);
+
+			THEN("the rest are still called in order")
+			{
+				CHECK(Broadcaster.size() == 2);
+				CHECK(Recorder.Calls == std::vector<int>{ 1, 3 });
+			}
+		}
+	}
+
+	GIVEN("a subscriber that removes a later subscriber while being broadcast")
+	{
+		Broadcaster += FIntDelegate::create<FCallRecorder, &FCallRecorder::RecordOne>(&Recorder);
+		Broadcaster += FIntDelegate::create<FCallRecorder, &FCallRecorder::RemoveThree>(&Recorder);
+		Broadcaster += FIntDelegate::create<FCallRecorder, &FCallRecorder::RecordThree>(&Recorder);
+
+		WHEN("it is broadcast twice")
+		{
+			Broadcaster(0);
+			Broadcaster(10);
+
+			THEN("the removed subscriber is skipped from the first broadcast on")
+			{
+				CHECK(Recorder.Calls == std::vector<int>{ 1, 0, 11, 10 });
+				CHECK(Broadcaster.size() == 2);
+			}
+		}
+	}
+
+	GIVEN("a subscriber that adds subscribers while being broadcast")
+	{
+		// Enough adds to move the subscribers out of inline storage partway through a broadcast
+		Broadcaster += FIntDelegate::create<FCallRecorder, &FCallRecorder::AddOne>(&Recorder);
+		Broadcaster += FIntDelegate::create<FCallRecorder, &FCallRecorder::AddOne>(&Recorder);
+		Broadcaster += FIntDelegate::create<FCallRecorder, &FCallRecorder::AddOne>(&Recorder);
+		Broadcaster += FIntDelegate::create<FCallRecorder, &FCallRecorder::AddOne>(&Recorder);
+
+		WHEN("it is broadcast")
+		{
+			Broadcaster(0);
+
+			THEN("the new subscribers are only called from the next broadcast")
+			{
+				CHECK(Recorder.Calls == std::vector<int>{ 0, 0, 0, 0 });
+				CHECK(Broadcaster.size() == 8);
+			}
+		}
+	}
+}
+
+TEST_CASE("Inline multicast delegates against the previous list of heap nodes", "[.][benchmark][delegates][multicast_delegate]")
+{
+	using namespace Gordian;
+	const int k_NumSubscribers = 3;
+	const int k_NumBroadcasts = 1000;
+
+	BENCHMARK("List: subscribe and broadcast")
+	{
+		FListMulticastDelegate Broadcaster;
+		for (int Subscriber = 0; Subscriber < k_NumSubscribers; ++Subscriber)
+		{
+			Broadcaster.Add(nullptr, &IncrementBenchmarkCounterStub);
+		}
+		for (int Broadcast = 0; Broadcast < k_NumBroadcasts; ++Broadcast)
+		{
+			Broadcaster.Broadcast();
+		}
+		return BenchmarkCounter;
+	};
+
+	BENCHMARK("Inline: subscribe and broadcast")
+	{
+		multicast_delegate<void()> Broadcaster;
+		for (int Subscriber = 0; Subscriber < k_NumSubscribers; ++Subscriber)
+		{
+			Broadcaster += delegate<void()>::create<&IncrementBenchmarkCounter>();
+		}
+		for (int Broadcast = 0; Broadcast < k_NumBroadcasts; ++Broadcast)
+		{
+			Broadcaster();
+		}
+		return BenchmarkCounter;
+	};
+
+	BENCHMARK("List: subscribe only")
+	{
+		FListMulticastDelegate Broadcaster;
+		for (int Subscriber = 0; Subscriber < k_NumSubscribers; ++Subscriber)
+		{
+			Broadcaster.Add(nullptr, &IncrementBenchmarkCounterStub);
+		}
+		return BenchmarkCounter;
+	};
+
+	BENCHMARK("Inline: subscribe only")
+	{
+		multicast_delegate<void()> Broadcaster;
+		for (int Subscriber = 0; Subscriber < k_NumSubscribers; ++Subscriber)
+		{
+			Broadcaster += delegate<void()>::create<&IncrementBenchmarkCounter>();
+		}
+		return BenchmarkCounter;
+	};
+
+	REQUIRE(BenchmarkCounter > 0);
+}
@@ -0,0 +1,55 @@
+#include <Catch.hpp>
+#include "GordianEngine/FileIO/Public/MappedFile.h"
+
+#include <cstdio>
+#include <cstring>
+#include <string>
+
+TEST_CASE("Mapped files can be read in place", "[FileIO][MappedFile]")
+{
+	using namespace Gordian;
+
+	const std::string FilePath = "MappedFileTest.bin";
+	const char k_Contents[] = "Mapped file contents";
+
+	std::FILE* File = std::fopen(FilePath.c_str(), "wb");
+	REQUIRE(File != nullptr);
+	std::fwrite(k_Contents, 1, sizeof(k_Contents), File);
+	std::fclose(File);
+
+	FMappedFile MappedFile;
+	CHECK_FALSE(MappedFile.IsOpen());
+
+	SECTION("Files are mapped whole")
+	{
+		REQUIRE(MappedFile.Open(FilePath));
+		CHECK(MappedFile.IsOpen());
+		REQUIRE(MappedFile.GetSize() == sizeof(k_Contents));
+		CHECK(std::memcmp(MappedFile.GetData(), k_Contents, sizeof(k_Contents)) == 0);
+
+		MappedFile.Close();
+		CHECK_FALSE(MappedFile.IsOpen());
+		CHECK(MappedFile.GetData() == nullptr);
+		CHECK(MappedFile.GetSize() == 0);
+	}
+
+	SECTION("Empty files open without any data")
+	{
+		File = std::fopen(FilePath.c_str(), "wb");
+		REQUIRE(File != nullptr);
+		std::fclose(File);
+
+		REQUIRE(MappedFile.Open(FilePath));
+		CHECK(MappedFile.IsOpen());
+		CHECK(MappedFile.GetSize() == 0);
+	}
+
+	SECTION("Missing files fail to open")
+	{
+		CHECK_FALSE(MappedFile.Open("MappedFileTest.missing"));
+		CHECK_FALSE(MappedFile.IsOpen());
+	}
+
+	MappedFile.Close();
+	std::remove(FilePath.c_str());
+}
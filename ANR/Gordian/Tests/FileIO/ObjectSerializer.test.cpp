@@ -0,0 +1,416 @@
+#define CATCH_CONFIG_ENABLE_BENCHMARKING
+#include <Catch.hpp>
+#include "GordianEngine/Core/Public/Object.h"
+#include "GordianEngine/FileIO/Public/ObjectSerializer.h"
+#include "GordianEngine/GlobalLibraries/Public/GlobalObjectLibrary.h"
+#include "GordianEngine/Reflection/Public/Type_Struct.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+class OSerializeTestChild : public Gordian::OObject
+{
+	REFLECT_CLASS(Gordian::OObject)
+
+public:
+
+	OSerializeTestChild(const std::string& InName, Gordian::OObject* InOwningObject)
+		: Parent(InName, InOwningObject)
+		, Value(0)
+		, Sibling(nullptr)
+		, NumTimesInitialized(0)
+	{
+	}
+
+	virtual void Initialize() override
+	{
+		++NumTimesInitialized;
+	}
+
+	int Value;
+	OSerializeTestChild* Sibling;
+
+	int NumTimesInitialized;
+};
+
+class OSerializeTestRoot : public Gordian::OObject
+{
+	REFLECT_CLASS(Gordian::OObject)
+
+public:
+
+	OSerializeTestRoot(const std::string& InName, Gordian::OObject* InOwningObject)
+		: Parent(InName, InOwningObject)
+		, Count(0)
+		, bFlag(false)
+		, Speed(0.f)
+		, Distance(0.0)
+		, ExternalObject(nullptr)
+		, ChildType(nullptr)
+	{
+	}
+
+	virtual ~OSerializeTestRoot() override
+	{
+		for (OSerializeTestChild* Child : Children)
+		{
+			Gordian::FGlobalObjectLibrary::DestroyObject(Child);
+		}
+	}
+
+	int Count;
+	bool bFlag;
+	float Speed;
+	double Distance;
+	std::string Label;
+	std::vector<int> Values;
+	std::vector<float> Samples;
+	std::vector<double> Weights;
+	std::vector<OSerializeTestChild*> Children;
+	Gordian::OObject* ExternalObject;
+	const Gordian::OType_Struct* ChildType;
+};
+
+// Both versions share a name length, so a save of one can be patched into a save of the other
+class OSerializeTestV1 : public Gordian::OObject
+{
+	REFLECT_CLASS(Gordian::OObject)
+
+public:
+
+	OSerializeTestV1(const std::string& InName, Gordian::OObject* InOwningObject)
+		: Parent(InName, InOwningObject)
+		, Kept(0)
+		, Removed(0)
+		, Retyped(0)
+	{
+	}
+
+	int Kept;
+	int Removed;
+	std::string Text;
+	int Retyped;
+};
+
+class OSerializeTestV2 : public Gordian::OObject
+{
+	REFLECT_CLASS(Gordian::OObject)
+
+public:
+
+	OSerializeTestV2(const std::string& InName, Gordian::OObject* InOwningObject)
+		: Parent(InName, InOwningObject)
+		, Added(7)
+		, Kept(0)
+		, Retyped("Default")
+	{
+	}
+
+	std::string Text;
+	int Added;
+	int Kept;
+	std::string Retyped;
+};
+
+// Raw pointers to primitives can't be saved
+class OSerializeTestUnsupported : public Gordian::OObject
+{
+	REFLECT_CLASS(Gordian::OObject)
+
+public:
+
+	OSerializeTestUnsupported(const std::string& InName, Gordian::OObject* InOwningObject)
+		: Parent(InName, InOwningObject)
+		, Count(0)
+		, CountPointer(&Count)
+	{
+	}
+
+	int Count;
+	int* CountPointer;
+};
+
+RCLASS_INITIALIZE(OSerializeTestChild)
+RCLASS_BEGIN_MEMBER_LIST()
+RCLASS_MEMBER_ADD(Value)
+RCLASS_MEMBER_ADD(Sibling)
+RCLASS_END_INIT()
+
+RCLASS_INITIALIZE(OSerializeTestRoot)
+RCLASS_BEGIN_MEMBER_LIST()
+RCLASS_MEMBER_ADD(Count)
+RCLASS_MEMBER_ADD(bFlag)
+RCLASS_MEMBER_ADD(Speed)
+RCLASS_MEMBER_ADD(Distance)
+RCLASS_MEMBER_ADD(Label)
+RCLASS_MEMBER_ADD(Values)
+RCLASS_MEMBER_ADD(Samples)
+RCLASS_MEMBER_ADD(Weights)
+RCLASS_MEMBER_ADD(Children)
+RCLASS_MEMBER_ADD(ExternalObject)
+RCLASS_MEMBER_ADD(ChildType)
+RCLASS_END_INIT()
+
+RCLASS_INITIALIZE(OSerializeTestUnsupported)
+RCLASS_BEGIN_MEMBER_LIST()
+RCLASS_MEMBER_ADD(Count)
+RCLASS_MEMBER_ADD(CountPointer)
+RCLASS_END_INIT()
+
+RCLASS_INITIALIZE(OSerializeTestV1)
+RCLASS_BEGIN_MEMBER_LIST()
+RCLASS_MEMBER_ADD(Kept)
+RCLASS_MEMBER_ADD(Removed)
+RCLASS_MEMBER_ADD(Text)
+RCLASS_MEMBER_ADD(Retyped)
+RCLASS_END_INIT()
+
+RCLASS_INITIALIZE(OSerializeTestV2)
+RCLASS_BEGIN_MEMBER_LIST()
+RCLASS_MEMBER_ADD(Text)
+RCLASS_MEMBER_ADD(Added)
+RCLASS_MEMBER_ADD(Kept)
+RCLASS_MEMBER_ADD(Retyped)
+RCLASS_END_INIT()
+
+
+TEST_CASE("Object graphs survive a save and load", "[FileIO][ObjectSerializer]")
+{
+	using namespace Gordian;
+
+	OSerializeTestRoot* External = FGlobalObjectLibrary::CreateObject<OSerializeTestRoot>(nullptr, OSerializeTestRoot::GetStaticType());
+	OSerializeTestRoot* Source = FGlobalObjectLibrary::CreateObject<OSerializeTestRoot>(nullptr, OSerializeTestRoot::GetStaticType(), "SavedRoot");
+	Source->Count = -42;
+	Source->bFlag = true;
+	Source->Speed = -2.5f;
+	Source->Distance = 1.0 / 3.0;
+	Source->Label = "Saved Label";
+	Source->Values = { 1, 2, 3, 5, 8 };
+	Source->Samples = { 0.25f, -1.5f, 1e-20f };
+	Source->Weights = { 0.1, 1e300 };
+	Source->ExternalObject = External;
+	Source->ChildType = OSerializeTestChild::GetStaticType();
+
+	for (int ChildIndex = 0; ChildIndex < 3; ++ChildIndex)
+	{
+		OSerializeTestChild* Child = FGlobalObjectLibrary::CreateObject<OSerializeTestChild>(Source, OSerializeTestChild::GetStaticType(), "Child" + std::to_string(ChildIndex));
+		Child->Value = ChildIndex * 10;
+		Source->Children.push_back(Child);
+	}
+	Source->Children[0]->Sibling = Source->Children[2];
+	Source->Children[2]->Sibling = Source->Children[0];
+
+	std::vector<char> SaveData;
+	REQUIRE(FObjectSerializer::Save(Source, SaveData));
+
+	OSerializeTestRoot* Loaded = FGlobalObjectLibrary::CreateObject<OSerializeTestRoot>(nullptr, OSerializeTestRoot::GetStaticType(), "LoadedRoot");
+	Loaded->ExternalObject = Loaded;
+
+	std::vector<OObject*> LoadedObjects;
+	REQUIRE(FObjectSerializer::Load(Loaded, SaveData.data(), SaveData.size(), &LoadedObjects));
+
+	CHECK(Loaded->Count == -42);
+	CHECK(Loaded->bFlag);
+	CHECK(Loaded->Speed == Source->Speed);
+	CHECK(Loaded->Distance == Source->Distance);
+	CHECK(Loaded->Label == "Saved Label");
+	CHECK(Loaded->Values == Source->Values);
+	CHECK(Loaded->Samples == Source->Samples);
+	CHECK(Loaded->Weights == Source->Weights);
+	CHECK(Loaded->ChildType == OSerializeTestChild::GetStaticType());
+
+	SECTION("Objects the root did not own are left alone")
+	{
+		CHECK(Loaded->ExternalObject == Loaded);
+	}
+
+	SECTION("The root keeps its own name")
+	{
+		CHECK(Loaded->GetName() == "LoadedRoot");
+	}
+
+	SECTION("Owned objects are recreated and linked back up")
+	{
+		REQUIRE(Loaded->Children.size() == 3);
+		CHECK(LoadedObjects.size() == 3);
+
+		for (int ChildIndex = 0; ChildIndex < 3; ++ChildIndex)
+		{
+			const OSerializeTestChild* Child = Loaded->Children[ChildIndex];
+			REQUIRE(Child != nullptr);
+			CHECK(Child != Source->Children[ChildIndex]);
+			CHECK(Child->GetName() == Source->Children[ChildIndex]->GetName());
+			CHECK(Child->GetType() == OSerializeTestChild::GetStaticType());
+			CHECK(Child->GetOwningObject() == Loaded);
+			CHECK(Child->Value == ChildIndex * 10);
+			CHECK(Child->NumTimesInitialized == 1);
+			CHECK(std::find(LoadedObjects.begin(), LoadedObjects.end(), Child) != LoadedObjects.end());
+		}
+
+		CHECK(Loaded->Children[0]->Sibling == Loaded->Children[2]);
+		CHECK(Loaded->Children[1]->Sibling == nullptr);
+		CHECK(Loaded->Children[2]->Sibling == Loaded->Children[0]);
+	}
+
+	SECTION("Bad data is rejected without changing anything")
+	{
+		OSerializeTestRoot* Untouched = FGlobalObjectLibrary::CreateObject<OSerializeTestRoot>(nullptr, OSerializeTestRoot::GetStaticType());
+		Untouched->Count = 5;
+
+		for (size_t CutSize = 0; CutSize < SaveData.size(); CutSize += 7)
+		{
+			CHECK_FALSE(FObjectSerializer::Load(Untouched, SaveData.data(), CutSize));
+		}
+		CHECK(Untouched->Count == 5);
+		CHECK(Untouched->Children.empty());
+
+		// Saves only load into the class they were made from
+		OSerializeTestChild* WrongRoot = FGlobalObjectLibrary::CreateObject<OSerializeTestChild>(nullptr, OSerializeTestChild::GetStaticType());
+		CHECK_FALSE(FObjectSerializer::Load(WrongRoot, SaveData.data(), SaveData.size()));
+
+		FGlobalObjectLibrary::DestroyObject(WrongRoot);
+		FGlobalObjectLibrary::DestroyObject(Untouched);
+	}
+
+	FGlobalObjectLibrary::DestroyObject(Loaded);
+	FGlobalObjectLibrary::DestroyObject(Source);
+	FGlobalObjectLibrary::DestroyObject(External);
+}
+
+TEST_CASE("Members that can't be saved fail the save", "[FileIO][ObjectSerializer]")
+{
+	using namespace Gordian;
+
+	OSerializeTestUnsupported* Source = FGlobalObjectLibrary::CreateObject<OSerializeTestUnsupported>(nullptr, OSerializeTestUnsupported::GetStaticType());
+	Source->Count = 3;
+
+	std::vector<char> SaveData = { 'a', 'b' };
+	CHECK_FALSE(FObjectSerializer::Save(Source, SaveData));
+	CHECK(SaveData == std::vector<char>({ 'a', 'b' }));
+
+	// The same goes for any owned object the root points at
+	OSerializeTestRoot* Root = FGlobalObjectLibrary::CreateObject<OSerializeTestRoot>(nullptr, OSerializeTestRoot::GetStaticType());
+	CHECK(FObjectSerializer::Save(Root, SaveData));
+
+	Root->ExternalObject = FGlobalObjectLibrary::CreateObject<OSerializeTestUnsupported>(Root, OSerializeTestUnsupported::GetStaticType());
+	std::vector<char> OwnedSaveData;
+	CHECK_FALSE(FObjectSerializer::Save(Root, OwnedSaveData));
+	CHECK(OwnedSaveData.empty());
+
+	CHECK_FALSE(FObjectSerializer::SaveToFile(Source, "ObjectSerializerTest.unsupported"));
+
+	FGlobalObjectLibrary::DestroyObject(Root->ExternalObject);
+	FGlobalObjectLibrary::DestroyObject(Root);
+	FGlobalObjectLibrary::DestroyObject(Source);
+}
+
+TEST_CASE("Saves load into newer versions of a class", "[FileIO][ObjectSerializer]")
+{
+	using namespace Gordian;
+
+	OSerializeTestV1* OldVersion = FGlobalObjectLibrary::CreateObject<OSerializeTestV1>(nullptr, OSerializeTestV1::GetStaticType());
+	OldVersion->Kept = 12;
+	OldVersion->Removed = 34;
+	OldVersion->Text = "Still here";
+	OldVersion->Retyped = 56;
+
+	std::vector<char> SaveData;
+	FObjectSerializer::Save(OldVersion, SaveData);
+
+	// Pretend the save was made back when OSerializeTestV2 looked like OSerializeTestV1
+	const std::string OldName = "OSerializeTestV1";
+	const std::string NewName = "OSerializeTestV2";
+	auto NameIt = std::search(SaveData.begin(), SaveData.end(), OldName.begin(), OldName.end());
+	REQUIRE(NameIt != SaveData.end());
+	std::copy(NewName.begin(), NewName.end(), NameIt);
+
+	// Saved classes are found again through the library, which knows every class by name from the start
+	REQUIRE(FGlobalObjectLibrary::FetchTypeByName(NewName) == OSerializeTestV2::GetStaticType());
+
+	OSerializeTestV2* NewVersion = FGlobalObjectLibrary::CreateObject<OSerializeTestV2>(nullptr, OSerializeTestV2::GetStaticType());
+	REQUIRE(FObjectSerializer::Load(NewVersion, SaveData.data(), SaveData.size()));
+
+	// Members are matched by name, wherever they moved to
+	CHECK(NewVersion->Kept == 12);
+	CHECK(NewVersion->Text == "Still here");
+
+	// Members that are new or changed type keep their defaults
+	CHECK(NewVersion->Added == 7);
+	CHECK(NewVersion->Retyped == "Default");
+
+	FGlobalObjectLibrary::DestroyObject(NewVersion);
+	FGlobalObjectLibrary::DestroyObject(OldVersion);
+}
+
+TEST_CASE("Saves can be loaded straight from a file", "[FileIO][ObjectSerializer]")
+{
+	using namespace Gordian;
+
+	const std::string FilePath = "ObjectSerializerTest.sav";
+
+	OSerializeTestRoot* Source = FGlobalObjectLibrary::CreateObject<OSerializeTestRoot>(nullptr, OSerializeTestRoot::GetStaticType());
+	Source->Count = 99;
+	Source->Label = "From a file";
+	OSerializeTestChild* Child = FGlobalObjectLibrary::CreateObject<OSerializeTestChild>(Source, OSerializeTestChild::GetStaticType());
+	Child->Value = 3;
+	Source->Children.push_back(Child);
+
+	REQUIRE(FObjectSerializer::SaveToFile(Source, FilePath));
+
+	OSerializeTestRoot* Loaded = FGlobalObjectLibrary::CreateObject<OSerializeTestRoot>(nullptr, OSerializeTestRoot::GetStaticType());
+	REQUIRE(FObjectSerializer::LoadFromFile(Loaded, FilePath));
+
+	CHECK(Loaded->Count == 99);
+	CHECK(Loaded->Label == "From a file");
+	REQUIRE(Loaded->Children.size() == 1);
+	CHECK(Loaded->Children[0]->Value == 3);
+
+	CHECK_FALSE(FObjectSerializer::LoadFromFile(Loaded, "ObjectSerializerTest.missing"));
+
+	std::remove(FilePath.c_str());
+	FGlobalObjectLibrary::DestroyObject(Loaded);
+	FGlobalObjectLibrary::DestroyObject(Source);
+}
+
+TEST_CASE("Benchmark loading large saves", "[.][benchmark][FileIO][ObjectSerializer]")
+{
+	using namespace Gordian;
+
+	const int k_NumChildren = 10000;
+
+	OSerializeTestRoot* Source = FGlobalObjectLibrary::CreateObject<OSerializeTestRoot>(nullptr, OSerializeTestRoot::GetStaticType());
+	Source->Values.resize(k_NumChildren * 10, 1);
+	for (int ChildIndex = 0; ChildIndex < k_NumChildren; ++ChildIndex)
+	{
+		OSerializeTestChild* Child = FGlobalObjectLibrary::CreateObject<OSerializeTestChild>(Source, OSerializeTestChild::GetStaticType());
+		Child->Value = ChildIndex;
+		Source->Children.push_back(Child);
+	}
+
+	std::vector<char> SaveData;
+	FObjectSerializer::Save(Source, SaveData);
+
+	BENCHMARK_ADVANCED("Load 10000 objects")(Catch::Benchmark::Chronometer Meter)
+	{
+		std::vector<OSerializeTestRoot*> Roots(Meter.runs());
+		for (OSerializeTestRoot*& Root : Roots)
+		{
+			Root = FGlobalObjectLibrary::CreateObject<OSerializeTestRoot>(nullptr, OSerializeTestRoot::GetStaticType());
+		}
+
+		Meter.measure([&Roots, &SaveData](int RunIndex)
+		{
+			return FObjectSerializer::Load(Roots[RunIndex], SaveData.data(), SaveData.size());
+		});
+
+		for (OSerializeTestRoot* Root : Roots)
+		{
+			FGlobalObjectLibrary::DestroyObject(Root);
+		}
+	};
+
+	FGlobalObjectLibrary::DestroyObject(Source);
+}
@@ -0,0 +1,45 @@
+#include <Catch.hpp>
+#include "GordianEngine/GlobalLibraries/Public/FrameArena.h"
+
+#include <cstdint>
+
+TEST_CASE("Frame arenas hand out aligned memory until reset", "[global_libraries][frame_arena]")
+{
+	using namespace Gordian;
+
+	FFrameArena Arena(256);
+
+	void* const First = Arena.Allocate(3, 1);
+	void* const Aligned = Arena.Allocate(sizeof(double), alignof(double));
+	CHECK(reinterpret_cast<uintptr_t>(Aligned) % alignof(double) == 0);
+	CHECK(Aligned != First);
+
+	// Too big for a block, so it gets one of its own
+	Arena.Allocate(1024, 16);
+	CHECK(Arena.GetNumBytesAllocated() == 3 + sizeof(double) + 1024);
+	const size_t NumBytesReserved = Arena.GetNumBytesReserved();
+
+	Arena.Reset();
+	CHECK(Arena.GetNumBytesAllocated() == 0);
+	CHECK(Arena.Allocate(3, 1) == First);
+	CHECK(Arena.GetNumBytesReserved() == NumBytesReserved);
+}
+
+TEST_CASE("Frame arenas align past the alignment of their blocks", "[global_libraries][frame_arena]")
+{
+	using namespace Gordian;
+
+	struct alignas(64) FCacheLine
+	{
+		char Bytes[64];
+	};
+
+	FFrameArena Arena(256);
+
+	for (int AllocationIndex = 0; AllocationIndex < 8; ++AllocationIndex)
+	{
+		Arena.Allocate(1, 1);
+		void* const CacheLine = Arena.Allocate(sizeof(FCacheLine), alignof(FCacheLine));
+		CHECK(reinterpret_cast<uintptr_t>(CacheLine) % alignof(FCacheLine) == 0);
+	}
+}
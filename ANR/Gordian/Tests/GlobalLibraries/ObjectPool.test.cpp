@@ -0,0 +1,96 @@
+#include <Catch.hpp>
+#include "GordianEngine/GlobalLibraries/Public/ObjectPool.h"
+#include "GordianEngine/Debug/Public/Exceptions.h"
+
+#include <cstdint>
+#include <set>
+#include <vector>
+
+TEST_CASE("Object pools hand out aligned, reusable slots", "[global_libraries][object_pool]")
+{
+	GIVEN("an empty object pool")
+	{
+		const size_t RequestedSlotSize = 37;
+		Gordian::FObjectPool ObjectPool(RequestedSlotSize);
+
+		REQUIRE(ObjectPool.GetStats().SlotSize >= RequestedSlotSize);
+		REQUIRE(ObjectPool.GetStats().SlotSize % alignof(std::max_align_t) == 0);
+		REQUIRE(ObjectPool.GetStats().SlabCount == 0);
+		REQUIRE(ObjectPool.GetStats().LiveSlots == 0);
+
+		WHEN("more slots are allocated than fit in a single slab")
+		{
+			const size_t SlotsToAllocate = ObjectPool.GetStats().SlotsPerSlab + 1;
+			std::vector<void*> Slots;
+			for (size_t i = 0; i < SlotsToAllocate; ++i)
+			{
+				Slots.push_back(ObjectPool.Allocate());
+			}
+
+			THEN("every slot is unique, aligned and owned by the pool")
+			{
+				std::set<void*> UniqueSlots(Slots.begin(), Slots.end());
+				REQUIRE(UniqueSlots.size() == SlotsToAllocate);
+
+				for (void* Slot : Slots)
+				{
+					REQUIRE(reinterpret_cast<std::uintptr_t>(Slot) % alignof(std::max_align_t) == 0);
+					REQUIRE(ObjectPool.Owns(Slot));
+				}
+			}
+
+			THEN("a second slab is made and counters match")
+			{
+				const Gordian::FObjectPoolStats& Stats = ObjectPool.GetStats();
+				REQUIRE(Stats.SlabCount == 2);
+				REQUIRE(Stats.LiveSlots == SlotsToAllocate);
+				REQUIRE(Stats.PeakLiveSlots == SlotsToAllocate);
+				REQUIRE(Stats.LiveSlots + Stats.FreeSlots == Stats.SlabCount * Stats.SlotsPerSlab);
+			}
+
+			THEN("slots from the same slab are contiguous")
+			{
+				const size_t SlotSize = ObjectPool.GetStats().SlotSize;
+				REQUIRE(static_cast<char*>(Slots[1]) - static_cast<char*>(Slots[0]) == (std::ptrdiff_t)SlotSize);
+			}
+
+			AND_WHEN("a slot is freed and another is allocated")
+			{
+				void* FreedSlot = Slots.back();
+				ObjectPool.Free(FreedSlot);
+
+				REQUIRE(ObjectPool.GetStats().LiveSlots == SlotsToAllocate - 1);
+
+				void* ReusedSlot = ObjectPool.Allocate();
+
+				THEN("the freed slot is reused and the peak is unchanged")
+				{
+					REQUIRE(ReusedSlot == FreedSlot);
+					REQUIRE(ObjectPool.GetStats().SlabCount == 2);
+					REQUIRE(ObjectPool.GetStats().PeakLiveSlots == SlotsToAllocate);
+				}
+			}
+
+			for (void* Slot : Slots)
+			{
+				ObjectPool.Free(Slot);
+			}
+		}
+
+		WHEN("freeing memory the pool does not own")
+		{
+			// A live slot, so only the ownership check can fail
+			void* LiveSlot = ObjectPool.Allocate();
+			int NotPooled = 0;
+
+			THEN("an assertion is raised and the live slot is untouched")
+			{
+				REQUIRE_FALSE(ObjectPool.Owns(&NotPooled));
+				REQUIRE_THROWS_AS(ObjectPool.Free(&NotPooled), Gordian::AssertionFailure);
+				REQUIRE(ObjectPool.GetStats().LiveSlots == 1);
+			}
+
+			ObjectPool.Free(LiveSlot);
+		}
+	}
+}
@@ -0,0 +1,212 @@
+#include <Catch.hpp>
+#include "GordianEngine/Core/Public/EventBus.h"
+#include "GordianEngine/Input/Public/InputManager.h"
+
+namespace
+{
+	int NumTestCommandPresses = 0;
+	int NumTestCommandReleases = 0;
+
+	void OnTestCommandPressed()
+	{
+		++NumTestCommandPresses;
+	}
+
+	void OnTestCommandReleased()
+	{
+		++NumTestCommandReleases;
+	}
+
+	int NumMouseXBroadcasts = 0;
+	float LastMouseXValue = 0.f;
+	float LastMouseXDelta = 0.f;
+
+	void OnMouseXMoved(float Value, float Delta)
+	{
+		++NumMouseXBroadcasts;
+		LastMouseXValue = Value;
+		LastMouseXDelta = Delta;
+	}
+
+	sf::Event MakeMouseMoveEvent(int X, int Y)
+	{
+		sf::Event Event;
+		Event.type = sf::Event::MouseMoved;
+		Event.mouseMove.x = X;
+		Event.mouseMove.y = Y;
+		return Event;
+	}
+
+	sf::Event MakeKeyEvent(sf::Event::EventType EventType, sf::Keyboard::Key Key, bool bIsShiftHeld = false)
+	{
+		sf::Event Event;
+		Event.type = EventType;
+		Event.key.code = Key;
+		Event.key.alt = false;
+		Event.key.control = false;
+		Event.key.shift = bIsShiftHeld;
+		Event.key.system = false;
+		return Event;
+	}
+}
+
+TEST_CASE("Input managers dispatch key events to bound commands", "[input]")
+{
+	using namespace Gordian;
+	NumTestCommandPresses = 0;
+	NumTestCommandReleases = 0;
+
+	GIVEN("an input manager with handlers bound to the default test command")
+	{
+		FInputManager InputManager;
+		REQUIRE(InputManager.BindToDigitalCommand<&OnTestCommandPressed>("TestCommand", EDigitalEventType::Pressed));
+		REQUIRE(InputManager.BindToDigitalCommand<&OnTestCommandReleased>("TestCommand", EDigitalEventType::Released));
+
+		THEN("commands without bindings cannot be bound to")
+		{
+			CHECK_FALSE(InputManager.BindToDigitalCommand<&OnTestCommandPressed>("MissingCommand", EDigitalEventType::Pressed));
+		}
+
+		WHEN("the bound key is pressed and released")
+		{
+			sf::Event Event = MakeKeyEvent(sf::Event::KeyPressed, sf::Keyboard::T);
+			InputManager.HandleWindowEvent(Event);
+			Event = MakeKeyEvent(sf::Event::KeyReleased, sf::Keyboard::T);
+			InputManager.HandleWindowEvent(Event);
+
+			THEN("nothing is broadcast until the event bus dispatches")
+			{
+				CHECK(NumTestCommandPresses == 0);
+				CHECK(NumTestCommandReleases == 0);
+			}
+
+			FEventBus::Get().Dispatch();
+
+			THEN("the command is pressed then released once each")
+			{
+				CHECK(NumTestCommandPresses == 1);
+				CHECK(NumTestCommandReleases == 1);
+			}
+		}
+
+		WHEN("other keys are pressed")
+		{
+			sf::Event Event = MakeKeyEvent(sf::Event::KeyPressed, sf::Keyboard::Y);
+			InputManager.HandleWindowEvent(Event);
+			FEventBus::Get().Dispatch();
+
+			THEN("the command is not triggered")
+			{
+				CHECK(NumTestCommandPresses == 0);
+			}
+		}
+
+		WHEN("a combo key changes while the bound key is held")
+		{
+			sf::Event Event = MakeKeyEvent(sf::Event::KeyPressed, sf::Keyboard::T);
+			InputManager.HandleWindowEvent(Event);
+			Event = MakeKeyEvent(sf::Event::KeyPressed, sf::Keyboard::LShift, true);
+			InputManager.HandleWindowEvent(Event);
+			Event = MakeKeyEvent(sf::Event::KeyReleased, sf::Keyboard::T, true);
+			InputManager.HandleWindowEvent(Event);
+			FEventBus::Get().Dispatch();
+
+			THEN("the release still reaches the command that was pressed")
+			{
+				CHECK(NumTestCommandPresses == 1);
+				CHECK(NumTestCommandReleases == 1);
+			}
+		}
+	}
+}
+
+TEST_CASE("Input managers aggregate analog input until it is broadcast", "[input]")
+{
+	using namespace Gordian;
+	NumMouseXBroadcasts = 0;
+
+	GIVEN("an input manager with a handler bound to the mouse's x axis")
+	{
+		FInputManager InputManager;
+		InputManager.BindToAnalogAxis<&OnMouseXMoved>(EAnalogAxis::MouseX);
+
+		WHEN("the mouse moves several times before a broadcast")
+		{
+			for (int X = 10; X <= 50; X += 10)
+			{
+				sf::Event Event = MakeMouseMoveEvent(X, 5);
+				InputManager.HandleWindowEvent(Event);
+			}
+
+			THEN("nothing is broadcast yet, but the latest position is known")
+			{
+				CHECK(NumMouseXBroadcasts == 0);
+				CHECK(InputManager.GetAxisValue(EAnalogAxis::MouseX) == 50.f);
+			}
+
+			InputManager.BroadcastAnalogInput();
+
+			THEN("the axis is broadcast once with the latest position and the summed change")
+			{
+				// The first event only places the cursor, so the change is counted from there
+				CHECK(NumMouseXBroadcasts == 1);
+				CHECK(LastMouseXValue == 50.f);
+				CHECK(LastMouseXDelta == 40.f);
+			}
+
+			AND_WHEN("it is broadcast again without moving")
+			{
+				InputManager.BroadcastAnalogInput();
+
+				THEN("the axis is not broadcast again")
+				{
+					CHECK(NumMouseXBroadcasts == 1);
+				}
+			}
+		}
+
+		WHEN("the first position the mouse reports is far from the corner")
+		{
+			sf::Event Event = MakeMouseMoveEvent(300, 200);
+			InputManager.HandleWindowEvent(Event);
+			InputManager.BroadcastAnalogInput();
+
+			THEN("the position is broadcast without counting it as movement")
+			{
+				CHECK(NumMouseXBroadcasts == 1);
+				CHECK(LastMouseXValue == 300.f);
+				CHECK(LastMouseXDelta == 0.f);
+			}
+
+			AND_WHEN("it moves from there")
+			{
+				Event = MakeMouseMoveEvent(290, 200);
+				InputManager.HandleWindowEvent(Event);
+				InputManager.BroadcastAnalogInput();
+
+				THEN("only the movement is counted")
+				{
+					CHECK(NumMouseXBroadcasts == 2);
+					CHECK(LastMouseXDelta == -10.f);
+				}
+			}
+		}
+
+		WHEN("the mouse wheel scrolls")
+		{
+			sf::Event Event;
+			Event.type = sf::Event::MouseWheelScrolled;
+			Event.mouseWheelScroll.wheel = sf::Mouse::VerticalWheel;
+			Event.mouseWheelScroll.delta = 1.f;
+			InputManager.HandleWindowEvent(Event);
+			InputManager.HandleWindowEvent(Event);
+			InputManager.BroadcastAnalogInput();
+
+			THEN("the wheel counts the notches, and the mouse's x axis is untouched")
+			{
+				CHECK(InputManager.GetAxisValue(EAnalogAxis::MouseWheel) == 2.f);
+				CHECK(NumMouseXBroadcasts == 0);
+			}
+		}
+	}
+}
@@ -0,0 +1,114 @@
+#include <Catch.hpp>
+#include "GordianEngine/Input/Public/InputRecording.h"
+
+#include <cstdio>
+
+namespace
+{
+	const char* k_TestRecordingFilepath = "InputRecordingTest.bin";
+	const sf::Uint32 k_TestRecordingTickRate = 45;
+
+	sf::Event MakeKeyEvent(sf::Event::EventType EventType, sf::Keyboard::Key Key)
+	{
+		sf::Event Event;
+		Event.type = EventType;
+		Event.key.code = Key;
+		Event.key.alt = false;
+		Event.key.control = true;
+		Event.key.shift = false;
+		Event.key.system = false;
+		return Event;
+	}
+}
+
+TEST_CASE("Input recordings replay events before the ticks they were recorded at", "[input][input_recording]")
+{
+	using namespace Gordian;
+	std::remove(k_TestRecordingFilepath);
+
+	GIVEN("a recording of events spread over several ticks")
+	{
+		{
+			FInputRecorder Recorder;
+			REQUIRE(Recorder.Start(k_TestRecordingFilepath, k_TestRecordingTickRate));
+
+			sf::Event MoveEvent;
+			MoveEvent.type = sf::Event::MouseMoved;
+			MoveEvent.mouseMove.x = 320;
+			MoveEvent.mouseMove.y = -12;
+
+			sf::Event FocusEvent;
+			FocusEvent.type = sf::Event::LostFocus;
+
+			Recorder.RecordEvent(MakeKeyEvent(sf::Event::KeyPressed, sf::Keyboard::T), 0);
+			Recorder.RecordEvent(MoveEvent, 0);
+			Recorder.RecordEvent(MakeKeyEvent(sf::Event::KeyReleased, sf::Keyboard::T), 3);
+			Recorder.RecordEvent(FocusEvent, 1000);
+
+			CHECK(Recorder.GetNumRecordedEvents() == 4);
+		}
+
+		WHEN("it is replayed")
+		{
+			FInputReplayer Replayer;
+			REQUIRE(Replayer.Open(k_TestRecordingFilepath));
+			REQUIRE(Replayer.IsReplaying());
+			CHECK(Replayer.GetTickRate() == k_TestRecordingTickRate);
+
+			sf::Event Event;
+
+			THEN("each event is handed out on the tick it was recorded at, in order")
+			{
+				REQUIRE(Replayer.PollEvent(0, Event));
+				CHECK(Event.type == sf::Event::KeyPressed);
+				CHECK(Event.key.code == sf::Keyboard::T);
+				CHECK(Event.key.control);
+
+				REQUIRE(Replayer.PollEvent(0, Event));
+				CHECK(Event.type == sf::Event::MouseMoved);
+				CHECK(Event.mouseMove.x == 320);
+				CHECK(Event.mouseMove.y == -12);
+
+				CHECK_FALSE(Replayer.PollEvent(0, Event));
+				CHECK_FALSE(Replayer.PollEvent(2, Event));
+
+				REQUIRE(Replayer.PollEvent(3, Event));
+				CHECK(Event.type == sf::Event::KeyReleased);
+
+				REQUIRE(Replayer.PollEvent(1000, Event));
+				CHECK(Event.type == sf::Event::LostFocus);
+
+				CHECK_FALSE(Replayer.PollEvent(1000, Event));
+				CHECK_FALSE(Replayer.IsReplaying());
+			}
+
+			THEN("late polls hand out every event that has come due")
+			{
+				size_t NumEvents = 0;
+				while (Replayer.PollEvent(5, Event))
+				{
+					++NumEvents;
+				}
+				CHECK(NumEvents == 3);
+				CHECK(Replayer.IsReplaying());
+			}
+		}
+	}
+
+	GIVEN("a file that is not a recording")
+	{
+		FILE* File = nullptr;
+		REQUIRE(fopen_s(&File, k_TestRecordingFilepath, "wb") == 0);
+		std::fputs("not a recording", File);
+		std::fclose(File);
+
+		THEN("it cannot be replayed")
+		{
+			FInputReplayer Replayer;
+			CHECK_FALSE(Replayer.Open(k_TestRecordingFilepath));
+			CHECK_FALSE(Replayer.IsReplaying());
+		}
+	}
+
+	std::remove(k_TestRecordingFilepath);
+}
@@ -0,0 +1,183 @@
+#define CATCH_CONFIG_ENABLE_BENCHMARKING
+#include <Catch.hpp>
+#include "GordianEngine/Core/Public/Object.h"
+#include "GordianEngine/Reflection/Public/Type_Struct.h"
+
+#include <cstring>
+#include <string>
+
+class OMemberIndexTestParent : public Gordian::OObject
+{
+	REFLECT_CLASS(Gordian::OObject)
+
+public:
+
+	int ParentValue;
+	int SharedValue;
+};
+
+class OMemberIndexTestChild : public OMemberIndexTestParent
+{
+	REFLECT_CLASS(OMemberIndexTestParent)
+
+public:
+
+	std::string ChildValue;
+	bool bChildFlag;
+	// Shadows the parent member of the same name
+	int SharedValue;
+};
+
+RCLASS_INITIALIZE(OMemberIndexTestParent)
+RCLASS_BEGIN_MEMBER_LIST()
+RCLASS_MEMBER_ADD(ParentValue)
+RCLASS_MEMBER_ADD(SharedValue)
+RCLASS_END_INIT()
+
+RCLASS_INITIALIZE(OMemberIndexTestChild)
+RCLASS_BEGIN_MEMBER_LIST()
+RCLASS_MEMBER_ADD(ChildValue)
+RCLASS_MEMBER_ADD(bChildFlag)
+RCLASS_MEMBER_ADD(SharedValue)
+RCLASS_END_INIT()
+
+// Builds a long single-inheritance chain, for comparing class checks on deep hierarchies
+#define DECLARE_DEPTH_TEST_CLASS(CLASS, PARENT)	\
+	class CLASS : public PARENT					\
+	{											\
+		REFLECT_CLASS(PARENT)					\
+	};											\
+	RCLASS_INITIALIZE_EMPTY(CLASS)
+
+DECLARE_DEPTH_TEST_CLASS(ODepthTest01, Gordian::OObject)
+DECLARE_DEPTH_TEST_CLASS(ODepthTest02, ODepthTest01)
+DECLARE_DEPTH_TEST_CLASS(ODepthTest03, ODepthTest02)
+DECLARE_DEPTH_TEST_CLASS(ODepthTest04, ODepthTest03)
+DECLARE_DEPTH_TEST_CLASS(ODepthTest05, ODepthTest04)
+DECLARE_DEPTH_TEST_CLASS(ODepthTest06, ODepthTest05)
+DECLARE_DEPTH_TEST_CLASS(ODepthTest07, ODepthTest06)
+DECLARE_DEPTH_TEST_CLASS(ODepthTest08, ODepthTest07)
+DECLARE_DEPTH_TEST_CLASS(ODepthTest09, ODepthTest08)
+DECLARE_DEPTH_TEST_CLASS(ODepthTest10, ODepthTest09)
+DECLARE_DEPTH_TEST_CLASS(ODepthTest11, ODepthTest10)
+DECLARE_DEPTH_TEST_CLASS(ODepthTest12, ODepthTest11)
+// Branches off partway down the chain
+DECLARE_DEPTH_TEST_CLASS(ODepthTestBranch, ODepthTest06)
+
+TEST_CASE("Struct types index their members by name", "[reflection][type_struct]")
+{
+	GIVEN("a reflected class with a reflected parent")
+	{
+		const Gordian::OType_Struct* ChildType = OMemberIndexTestChild::GetStaticType();
+		ChildType->EnsureInitialization();
+
+		THEN("every member, including inherited ones, can be found by name")
+		{
+			for (const Gordian::FStructMember& Member : ChildType->GetMembers())
+			{
+				REQUIRE(ChildType->DoesMemberExist(Member.Name));
+				REQUIRE(std::strcmp(ChildType->GetMember(Member.Name)->Name, Member.Name) == 0);
+			}
+
+			REQUIRE(ChildType->GetMember("ChildValue")->Offset == offsetof(OMemberIndexTestChild, ChildValue));
+			REQUIRE(ChildType->GetMember("ParentValue")->Offset == offsetof(OMemberIndexTestParent, ParentValue));
+		}
+
+		THEN("names shared with the parent find the first member, as before")
+		{
+			const Gordian::FStructMember* SharedMember = ChildType->GetMember("SharedValue");
+			REQUIRE(SharedMember != nullptr);
+			REQUIRE(SharedMember->Offset == offsetof(OMemberIndexTestParent, SharedValue));
+		}
+
+		THEN("unknown names are not found")
+		{
+			REQUIRE(ChildType->GetMember("MissingValue") == nullptr);
+			REQUIRE_FALSE(ChildType->DoesMemberExist(""));
+		}
+
+		THEN("the layout matches the member list")
+		{
+			const std::vector<Gordian::FStructMember>& Members = ChildType->GetMembers();
+			const std::vector<Gordian::FMemberLayout>& Layout = ChildType->GetMemberLayout();
+			REQUIRE(Layout.size() == Members.size());
+
+			for (size_t MemberIndex = 0; MemberIndex < Members.size(); ++MemberIndex)
+			{
+				REQUIRE(Layout[MemberIndex].Offset == Members[MemberIndex].Offset);
+				REQUIRE(Layout[MemberIndex].Type == Members[MemberIndex].Type);
+				REQUIRE(Layout[MemberIndex].Size == Members[MemberIndex].Type->GetSize());
+			}
+		}
+	}
+}
+
+TEST_CASE("Struct types answer parent checks with class ids", "[reflection][type_struct]")
+{
+	GIVEN("a deep class hierarchy with a branch")
+	{
+		ODepthTest12::GetStaticType()->EnsureInitialization();
+		ODepthTestBranch::GetStaticType()->EnsureInitialization();
+		OMemberIndexTestChild::GetStaticType()->EnsureInitialization();
+
+		const std::vector<const Gordian::OType_Struct*> Types = {
+			Gordian::OObject::GetStaticType(),
+			ODepthTest01::GetStaticType(),
+			ODepthTest06::GetStaticType(),
+			ODepthTest07::GetStaticType(),
+			ODepthTest12::GetStaticType(),
+			ODepthTestBranch::GetStaticType(),
+			OMemberIndexTestParent::GetStaticType(),
+			OMemberIndexTestChild::GetStaticType(),
+		};
+
+		THEN("every pair agrees with walking parents")
+		{
+			for (const Gordian::OType_Struct* Class : Types)
+			{
+				for (const Gordian::OType_Struct* PossibleParent : Types)
+				{
+					REQUIRE(Class->IsChildClassOf(PossibleParent) == Class->IsChildClassOfByParentWalk(PossibleParent));
+				}
+			}
+		}
+
+		THEN("siblings are not children of each other")
+		{
+			REQUIRE(ODepthTestBranch::GetStaticType()->IsChildClassOf(ODepthTest06::GetStaticType()));
+			REQUIRE_FALSE(ODepthTestBranch::GetStaticType()->IsChildClassOf(ODepthTest07::GetStaticType()));
+			REQUIRE_FALSE(ODepthTest12::GetStaticType()->IsChildClassOf(ODepthTestBranch::GetStaticType()));
+		}
+	}
+}
+
+TEST_CASE("Class id checks against parent walks on deep hierarchies", "[.][benchmark][reflection][type_struct]")
+{
+	ODepthTest12::GetStaticType()->EnsureInitialization();
+	OMemberIndexTestParent::GetStaticType()->EnsureInitialization();
+
+	const Gordian::OType_Struct* DeepestType = ODepthTest12::GetStaticType();
+	// Worst case for a parent walk, which stops at the depth of the possible parent.
+	//	An unrelated class just under the root makes it walk nearly the whole chain.
+	const Gordian::OType_Struct* UnrelatedType = OMemberIndexTestParent::GetStaticType();
+	const int k_NumChecks = 10000;
+	int NumMatches = 0;
+
+	BENCHMARK("Parent walk")
+	{
+		for (int Check = 0; Check < k_NumChecks; ++Check)
+		{
+			NumMatches += DeepestType->IsChildClassOfByParentWalk(UnrelatedType) ? 1 : 0;
+		}
+	};
+
+	BENCHMARK("Class ids")
+	{
+		for (int Check = 0; Check < k_NumChecks; ++Check)
+		{
+			NumMatches += DeepestType->IsChildClassOf(UnrelatedType) ? 1 : 0;
+		}
+	};
+
+	REQUIRE(NumMatches == 0);
+}
@@ -0,0 +1,102 @@
+#include <Catch.hpp>
+#include "GordianEngine/Rendering/Public/AssetLoader.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <iterator>
+#include <string>
+#include <vector>
+
+TEST_CASE("Asset loader decodes in the background and delivers on request", "[Rendering][AssetLoader]")
+{
+	using namespace Gordian;
+
+	const std::string FilePaths[] = { "AssetLoaderTest0.png", "AssetLoaderTest1.png", "AssetLoaderTest2.png" };
+	const std::string MissingFilePath = "AssetLoaderTestMissing.png";
+
+	sf::Image Image;
+	Image.create(32, 16, sf::Color::White);
+	for (const std::string& FilePath : FilePaths)
+	{
+		REQUIRE(Image.saveToFile(FilePath));
+	}
+
+	FAssetLoader AssetLoader;
+
+	std::vector<std::string> DeliveredFilePaths;
+	size_t NumFailed = 0;
+	const FAssetLoader::FOnImageDecoded OnDecoded = [&DeliveredFilePaths, &NumFailed](const std::string& FilePath, const sf::Image* DecodedImage)
+	{
+		DeliveredFilePaths.push_back(FilePath);
+		if (DecodedImage == nullptr)
+		{
+			++NumFailed;
+		}
+		else
+		{
+			CHECK(DecodedImage->getSize() == sf::Vector2u(32, 16));
+		}
+	};
+
+	SECTION("Inline without loader threads")
+	{
+		AssetLoader.RequestImage(FilePaths[0], OnDecoded);
+		CHECK(AssetLoader.GetNumPendingRequests() == 1);
+		CHECK(DeliveredFilePaths.empty());
+
+		CHECK(AssetLoader.DeliverDecodedImages(4) == 1);
+		CHECK(DeliveredFilePaths.size() == 1);
+		CHECK(AssetLoader.GetNumPendingRequests() == 0);
+	}
+
+	SECTION("Delivery is limited per call")
+	{
+		AssetLoader.Start(2);
+		for (const std::string& FilePath : FilePaths)
+		{
+			AssetLoader.RequestImage(FilePath, OnDecoded);
+		}
+		AssetLoader.RequestImage(MissingFilePath, OnDecoded);
+
+		AssetLoader.WaitForDecoding();
+		CHECK(DeliveredFilePaths.empty());
+		CHECK(AssetLoader.GetNumPendingRequests() == 4);
+
+		CHECK(AssetLoader.DeliverDecodedImages(3) == 3);
+		CHECK(AssetLoader.DeliverDecodedImages(3) == 1);
+		CHECK(AssetLoader.DeliverDecodedImages(3) == 0);
+		CHECK(DeliveredFilePaths.size() == 4);
+		CHECK(NumFailed == 1);
+	}
+
+	SECTION("Stopping drops undelivered images")
+	{
+		std::vector<std::string> DroppedFilePaths;
+		const FAssetLoader::FOnRequestDropped OnDropped = [&DroppedFilePaths](const std::string& FilePath)
+		{
+			DroppedFilePaths.push_back(FilePath);
+		};
+
+		AssetLoader.Start(1);
+		AssetLoader.RequestImage(FilePaths[0], OnDecoded, OnDropped);
+		AssetLoader.WaitForDecoding();
+		// Likely still queued when the loader stops
+		AssetLoader.RequestImage(FilePaths[1], OnDecoded, OnDropped);
+		AssetLoader.RequestImage(FilePaths[2], OnDecoded, OnDropped);
+
+		AssetLoader.Stop();
+		CHECK(AssetLoader.GetNumPendingRequests() == 0);
+		CHECK(AssetLoader.DeliverDecodedImages(4) == 0);
+		CHECK(DeliveredFilePaths.empty());
+
+		// Every request hears it was dropped, whether it was decoded yet or not
+		std::sort(DroppedFilePaths.begin(), DroppedFilePaths.end());
+		CHECK(DroppedFilePaths == std::vector<std::string>(std::begin(FilePaths), std::end(FilePaths)));
+	}
+
+	AssetLoader.Stop();
+	for (const std::string& FilePath : FilePaths)
+	{
+		std::remove(FilePath.c_str());
+	}
+}
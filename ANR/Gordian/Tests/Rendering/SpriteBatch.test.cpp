@@ -0,0 +1,58 @@
+#include <Catch.hpp>
+#include "GordianEngine/Rendering/Public/SpriteBatch.h"
+
+#include "SFML/Graphics/RenderTexture.hpp"
+#include "SFML/Graphics/Texture.hpp"
+
+TEST_CASE("Sprite batches draw once per texture", "[Rendering][SpriteBatch]")
+{
+	using namespace Gordian;
+
+	sf::RenderTexture Target;
+	REQUIRE(Target.create(64, 64));
+
+	sf::Texture FirstTexture;
+	sf::Texture SecondTexture;
+	REQUIRE(FirstTexture.create(16, 16));
+	REQUIRE(SecondTexture.create(16, 16));
+
+	sf::Sprite FirstSprite;
+	FirstSprite.setTexture(FirstTexture);
+	sf::Sprite SecondSprite;
+	SecondSprite.setTexture(SecondTexture);
+
+	FSpriteBatch SpriteBatch;
+
+	SECTION("Sprites in a layer are grouped by texture")
+	{
+		for (int SpriteIndex = 0; SpriteIndex < 4; ++SpriteIndex)
+		{
+			SpriteBatch.Submit(FirstSprite, sf::Transform::Identity);
+			SpriteBatch.Submit(SecondSprite, sf::Transform::Identity);
+		}
+		CHECK(SpriteBatch.GetNumQueuedSprites() == 8);
+
+		SpriteBatch.Flush(Target);
+		CHECK(SpriteBatch.GetNumDrawCalls() == 2);
+		CHECK(SpriteBatch.GetNumQueuedSprites() == 0);
+	}
+
+	SECTION("Layers are drawn in order")
+	{
+		SpriteBatch.Submit(FirstSprite, sf::Transform::Identity, 0);
+		SpriteBatch.Submit(SecondSprite, sf::Transform::Identity, 1);
+		SpriteBatch.Submit(FirstSprite, sf::Transform::Identity, 2);
+
+		SpriteBatch.Flush(Target);
+		CHECK(SpriteBatch.GetNumDrawCalls() == 3);
+	}
+
+	SECTION("Sprites without a texture are skipped")
+	{
+		SpriteBatch.Submit(sf::Sprite(), sf::Transform::Identity);
+		CHECK(SpriteBatch.GetNumQueuedSprites() == 0);
+
+		SpriteBatch.Flush(Target);
+		CHECK(SpriteBatch.GetNumDrawCalls() == 0);
+	}
+}
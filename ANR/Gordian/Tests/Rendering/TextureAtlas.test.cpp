@@ -0,0 +1,61 @@
+#include <Catch.hpp>
+#include "GordianEngine/Rendering/Public/TextureAtlas.h"
+
+TEST_CASE("Shelf packer places card sized images in rows", "[Rendering][TextureAtlas]")
+{
+	using namespace Gordian;
+
+	// A 1024 page fits three padded 300x419 cards per row, and two rows
+	FShelfPacker Packer(1024, 1024, 1);
+	sf::Vector2u Position;
+
+	SECTION("Rows fill left to right, then top to bottom")
+	{
+		REQUIRE(Packer.Insert(300, 419, Position));
+		CHECK(Position == sf::Vector2u(0, 0));
+		REQUIRE(Packer.Insert(300, 419, Position));
+		CHECK(Position == sf::Vector2u(301, 0));
+		REQUIRE(Packer.Insert(300, 419, Position));
+		CHECK(Position == sf::Vector2u(602, 0));
+
+		REQUIRE(Packer.Insert(300, 419, Position));
+		CHECK(Position == sf::Vector2u(0, 420));
+	}
+
+	SECTION("Full pages reject more images")
+	{
+		for (int Card = 0; Card < 6; ++Card)
+		{
+			REQUIRE(Packer.Insert(300, 419, Position));
+		}
+		CHECK_FALSE(Packer.Insert(300, 419, Position));
+
+		// Smaller images can still use the gaps left after each row, and below the last one
+		REQUIRE(Packer.Insert(64, 64, Position));
+		CHECK(Position == sf::Vector2u(903, 0));
+		REQUIRE(Packer.Insert(200, 64, Position));
+		CHECK(Position == sf::Vector2u(0, 840));
+
+		Packer.Reset();
+		REQUIRE(Packer.Insert(300, 419, Position));
+		CHECK(Position == sf::Vector2u(0, 0));
+	}
+
+	SECTION("Short images prefer the shortest shelf they fit on")
+	{
+		REQUIRE(Packer.Insert(300, 419, Position));
+		REQUIRE(Packer.Insert(64, 64, Position));
+		CHECK(Position == sf::Vector2u(301, 0));
+		REQUIRE(Packer.Insert(1000, 32, Position));
+		CHECK(Position == sf::Vector2u(0, 420));
+		REQUIRE(Packer.Insert(16, 16, Position));
+		CHECK(Position == sf::Vector2u(1001, 420));
+	}
+
+	SECTION("Images larger than the page never fit")
+	{
+		CHECK_FALSE(Packer.Insert(1025, 16, Position));
+		CHECK_FALSE(Packer.Insert(16, 1025, Position));
+		CHECK_FALSE(Packer.Insert(0, 16, Position));
+	}
+}
@@ -0,0 +1,136 @@
+#include <Catch.hpp>
+#include "GordianEngine/Rendering/Public/TextureCache.h"
+#include "GordianEngine/Rendering/Public/AssetLoader.h"
+
+#include <cstdio>
+#include <string>
+
+#include "SFML/Graphics/Image.hpp"
+
+TEST_CASE("Texture cache shares textures and evicts unused ones", "[Rendering][TextureCache]")
+{
+	using namespace Gordian;
+
+	// Each texture takes 64x64 texels at 4 bytes each
+	const size_t k_TextureBytes = 64 * 64 * 4;
+	const std::string FilePaths[] = { "TextureCacheTest0.png", "TextureCacheTest1.png", "TextureCacheTest2.png" };
+
+	sf::Image Image;
+	Image.create(64, 64, sf::Color::White);
+	for (const std::string& FilePath : FilePaths)
+	{
+		REQUIRE(Image.saveToFile(FilePath));
+	}
+
+	FTextureCache TextureCache(2 * k_TextureBytes);
+
+	SECTION("Each file is loaded once")
+	{
+		FTextureHandle FirstHandle = TextureCache.Load(FilePaths[0]);
+		FTextureHandle SecondHandle = TextureCache.Load(FilePaths[0]);
+		REQUIRE(FirstHandle != nullptr);
+		CHECK(FirstHandle == SecondHandle);
+
+		CHECK(TextureCache.GetStats().Hits == 1);
+		CHECK(TextureCache.GetStats().Misses == 1);
+		CHECK(TextureCache.GetStats().NumTextures == 1);
+		CHECK(TextureCache.GetStats().ResidentBytes == k_TextureBytes);
+	}
+
+	SECTION("Least recently used textures are evicted first")
+	{
+		TextureCache.Load(FilePaths[0]);
+		TextureCache.Load(FilePaths[1]);
+		TextureCache.Load(FilePaths[0]);
+		TextureCache.Load(FilePaths[2]);
+
+		CHECK(TextureCache.IsCached(FilePaths[0]));
+		CHECK_FALSE(TextureCache.IsCached(FilePaths[1]));
+		CHECK(TextureCache.IsCached(FilePaths[2]));
+		CHECK(TextureCache.GetStats().Evictions == 1);
+		CHECK(TextureCache.GetStats().ResidentBytes == 2 * k_TextureBytes);
+	}
+
+	SECTION("Textures in use are never evicted")
+	{
+		FTextureHandle HeldHandles[] = { TextureCache.Load(FilePaths[0]),
+										 TextureCache.Load(FilePaths[1]),
+										 TextureCache.Load(FilePaths[2]) };
+
+		CHECK(TextureCache.GetStats().NumTextures == 3);
+		CHECK(TextureCache.GetStats().Evictions == 0);
+
+		// Once released, lowering the budget evicts them oldest first
+		HeldHandles[0].reset();
+		HeldHandles[1].reset();
+		TextureCache.SetMemoryBudget(k_TextureBytes);
+		CHECK_FALSE(TextureCache.IsCached(FilePaths[0]));
+		CHECK_FALSE(TextureCache.IsCached(FilePaths[1]));
+		CHECK(TextureCache.IsCached(FilePaths[2]));
+
+		TextureCache.Clear();
+		CHECK(TextureCache.IsCached(FilePaths[2]));
+		HeldHandles[2].reset();
+		TextureCache.Clear();
+		CHECK(TextureCache.GetStats().NumTextures == 0);
+		CHECK(TextureCache.GetStats().ResidentBytes == 0);
+	}
+
+	SECTION("Streamed textures show a placeholder until delivered")
+	{
+		FAssetLoader AssetLoader;
+		AssetLoader.Start(1);
+
+		FTextureHandle StreamedHandle = TextureCache.LoadAsync(FilePaths[0], AssetLoader);
+		REQUIRE(StreamedHandle != nullptr);
+		CHECK(StreamedHandle->getSize() == sf::Vector2u(1, 1));
+		CHECK(TextureCache.IsStreaming(FilePaths[0]));
+		CHECK(TextureCache.LoadAsync(FilePaths[0], AssetLoader) == StreamedHandle);
+
+		AssetLoader.WaitForDecoding();
+		CHECK(AssetLoader.DeliverDecodedImages(1) == 1);
+
+		// The same texture is updated, so anything drawing it picks up the real image
+		CHECK(StreamedHandle->getSize() == sf::Vector2u(64, 64));
+		CHECK_FALSE(TextureCache.IsStreaming(FilePaths[0]));
+		CHECK(TextureCache.GetStats().NumStreaming == 0);
+		CHECK(TextureCache.GetStats().ResidentBytes == k_TextureBytes);
+
+		// Missing files keep their placeholder and leave the cache
+		FTextureHandle MissingHandle = TextureCache.LoadAsync("TextureCacheTestMissing.png", AssetLoader);
+		AssetLoader.WaitForDecoding();
+		CHECK(AssetLoader.DeliverDecodedImages(1) == 1);
+		CHECK(MissingHandle->getSize() == sf::Vector2u(1, 1));
+		CHECK_FALSE(TextureCache.IsCached("TextureCacheTestMissing.png"));
+	}
+
+	SECTION("Streamed textures are requested again after their loader stops")
+	{
+		FAssetLoader AssetLoader;
+		AssetLoader.Start(1);
+
+		FTextureHandle StreamedHandle = TextureCache.LoadAsync(FilePaths[0], AssetLoader);
+		AssetLoader.Stop();
+		CHECK(TextureCache.IsStreaming(FilePaths[0]));
+
+		AssetLoader.Start(1);
+		CHECK(TextureCache.LoadAsync(FilePaths[0], AssetLoader) == StreamedHandle);
+		AssetLoader.WaitForDecoding();
+		CHECK(AssetLoader.DeliverDecodedImages(1) == 1);
+
+		CHECK(StreamedHandle->getSize() == sf::Vector2u(64, 64));
+		CHECK_FALSE(TextureCache.IsStreaming(FilePaths[0]));
+	}
+
+	SECTION("Missing files are not cached")
+	{
+		CHECK(TextureCache.Load("TextureCacheTestMissing.png") == nullptr);
+		CHECK_FALSE(TextureCache.IsCached("TextureCacheTestMissing.png"));
+		CHECK(TextureCache.GetStats().Misses == 1);
+	}
+
+	for (const std::string& FilePath : FilePaths)
+	{
+		std::remove(FilePath.c_str());
+	}
+}
@@ -0,0 +1,294 @@
+#include <Catch.hpp>
+#include "GordianEngine/Actor/Public/Actor.h"
+#include "GordianEngine/Core/Public/JobSystem.h"
+#include "GordianEngine/Debug/Public/Profiler.h"
+#include "GordianEngine/GlobalLibraries/Public/GlobalObjectLibrary.h"
+#include "GordianEngine/World/Public/TickManager.h"
+
+#include <atomic>
+#include <cstdio>
+#include <functional>
+#include <string>
+#include <vector>
+
+class ATickOrderActor : public Gordian::AActor
+{
+	REFLECT_CLASS(Gordian::AActor)
+
+public:
+
+	ATickOrderActor(const std::string& InName, Gordian::OObject* InOwningObject)
+		: Parent(InName, InOwningObject)
+	{
+	}
+
+	virtual void Tick(const sf::Time& DeltaTime) override
+	{
+		TickedAt = NextTickSequence++;
+		++NumTicks;
+		if (OnTick)
+		{
+			OnTick();
+		}
+	}
+
+	static std::atomic<int> NextTickSequence;
+
+	int TickedAt = -1;
+	int NumTicks = 0;
+	std::function<void()> OnTick;
+};
+
+/*static*/ std::atomic<int> ATickOrderActor::NextTickSequence(0);
+
+RCLASS_INITIALIZE_EMPTY(ATickOrderActor)
+
+namespace
+{
+	// More than a batch per wave, so every wave is really split across workers
+	const size_t k_NumActorsPerWave = 64;
+
+	const char* k_TestTraceFilepath = "TickManagerTest.json";
+
+	size_t CountTraceEvents(const std::string& EventName)
+	{
+		std::string Trace;
+		FILE* File = nullptr;
+		if (fopen_s(&File, k_TestTraceFilepath, "r") == 0)
+		{
+			char Buffer[512];
+			size_t NumRead;
+			while ((NumRead = std::fread(Buffer, 1, sizeof(Buffer), File)) > 0)
+			{
+				Trace.append(Buffer, NumRead);
+			}
+			std::fclose(File);
+		}
+
+		const std::string Pattern = "\"name\":\"" + EventName + "\"";
+		size_t Count = 0;
+		for (size_t Found = Trace.find(Pattern); Found != std::string::npos; Found = Trace.find(Pattern, Found + 1))
+		{
+			++Count;
+		}
+		return Count;
+	}
+
+	ATickOrderActor* CreateTickOrderActor(const std::string& Name)
+	{
+		return Gordian::FGlobalObjectLibrary::CreateObject<ATickOrderActor>(nullptr, ATickOrderActor::GetStaticType(), Name);
+	}
+
+	// Ticks on the shared job system with workers, and always stops them again
+	struct FScopedJobWorkers
+	{
+		FScopedJobWorkers()
+		{
+			Gordian::FJobSystem::Get().Start(3);
+		}
+
+		~FScopedJobWorkers()
+		{
+			Gordian::FJobSystem::Get().Stop();
+		}
+	};
+}
+
+TEST_CASE("Tick managers tick prerequisites in earlier waves across worker threads", "[world][tick_manager]")
+{
+	using namespace Gordian;
+
+	FScopedJobWorkers JobWorkers;
+	FTickManager TickManager;
+	ATickOrderActor::NextTickSequence = 0;
+
+	// Roots wait on nothing, middles wait on a root, and leaves wait on a middle and a different root
+	std::vector<ATickOrderActor*> Roots, Middles, Leaves;
+	for (size_t ActorIndex = 0; ActorIndex < k_NumActorsPerWave; ++ActorIndex)
+	{
+		Roots.push_back(CreateTickOrderActor("Root" + std::to_string(ActorIndex)));
+		Middles.push_back(CreateTickOrderActor("Middle" + std::to_string(ActorIndex)));
+		Leaves.push_back(CreateTickOrderActor("Leaf" + std::to_string(ActorIndex)));
+	}
+
+	for (size_t ActorIndex = 0; ActorIndex < k_NumActorsPerWave; ++ActorIndex)
+	{
+		Middles[ActorIndex]->AddTickPrerequisite(Roots[ActorIndex]);
+		Leaves[ActorIndex]->AddTickPrerequisite(Middles[ActorIndex]);
+		Leaves[ActorIndex]->AddTickPrerequisite(Roots[(ActorIndex + 1) % k_NumActorsPerWave]);
+	}
+
+	// Registered backwards, so the order only comes from the prerequisites
+	for (size_t ActorIndex = 0; ActorIndex < k_NumActorsPerWave; ++ActorIndex)
+	{
+		TickManager.RegisterActor(Leaves[ActorIndex]);
+		TickManager.RegisterActor(Middles[ActorIndex]);
+		TickManager.RegisterActor(Roots[ActorIndex]);
+	}
+	REQUIRE(TickManager.GetNumTickables() == 3 * k_NumActorsPerWave);
+
+	TickManager.Tick(sf::milliseconds(16));
+	CHECK(TickManager.GetNumTickWaves(Leaves[0]->GetTickGroup()) == 3);
+
+	for (size_t ActorIndex = 0; ActorIndex < k_NumActorsPerWave; ++ActorIndex)
+	{
+		REQUIRE(Roots[ActorIndex]->NumTicks == 1);
+		REQUIRE(Middles[ActorIndex]->NumTicks == 1);
+		REQUIRE(Leaves[ActorIndex]->NumTicks == 1);
+
+		CHECK(Middles[ActorIndex]->TickedAt > Roots[ActorIndex]->TickedAt);
+		CHECK(Leaves[ActorIndex]->TickedAt > Middles[ActorIndex]->TickedAt);
+		CHECK(Leaves[ActorIndex]->TickedAt > Roots[(ActorIndex + 1) % k_NumActorsPerWave]->TickedAt);
+	}
+
+	for (ATickOrderActor* Actor : Roots) { FGlobalObjectLibrary::DestroyObject(Actor); }
+	for (ATickOrderActor* Actor : Middles) { FGlobalObjectLibrary::DestroyObject(Actor); }
+	for (ATickOrderActor* Actor : Leaves) { FGlobalObjectLibrary::DestroyObject(Actor); }
+}
+
+TEST_CASE("Tick managers handle tickables leaving and joining mid-tick", "[world][tick_manager]")
+{
+	using namespace Gordian;
+
+	FScopedJobWorkers JobWorkers;
+	FTickManager TickManager;
+	ATickOrderActor::NextTickSequence = 0;
+
+	std::vector<ATickOrderActor*> Roots, Dependents;
+	for (size_t ActorIndex = 0; ActorIndex < k_NumActorsPerWave; ++ActorIndex)
+	{
+		Roots.push_back(CreateTickOrderActor("Root" + std::to_string(ActorIndex)));
+		Dependents.push_back(CreateTickOrderActor("Dependent" + std::to_string(ActorIndex)));
+		Dependents[ActorIndex]->AddTickPrerequisite(Roots[ActorIndex]);
+
+		TickManager.RegisterActor(Roots[ActorIndex]);
+		TickManager.RegisterActor(Dependents[ActorIndex]);
+	}
+
+	ATickOrderActor* LateActor = CreateTickOrderActor("Late");
+
+	// Every root pulls its dependent out of a later wave, and the last one also brings in a new actor
+	for (size_t ActorIndex = 0; ActorIndex < k_NumActorsPerWave; ++ActorIndex)
+	{
+		ATickOrderActor* Dependent = Dependents[ActorIndex];
+		Roots[ActorIndex]->OnTick = [&TickManager, Dependent]() { TickManager.UnregisterActor(Dependent); };
+	}
+	Roots.back()->OnTick = [&TickManager, Dependent = Dependents.back(), LateActor]()
+	{
+		TickManager.UnregisterActor(Dependent);
+		TickManager.RegisterActor(LateActor);
+	};
+
+	TickManager.Tick(sf::milliseconds(16));
+
+	THEN("unregistered tickables are skipped, and new ones wait for the next tick")
+	{
+		for (size_t ActorIndex = 0; ActorIndex < k_NumActorsPerWave; ++ActorIndex)
+		{
+			REQUIRE(Roots[ActorIndex]->NumTicks == 1);
+			REQUIRE(Dependents[ActorIndex]->NumTicks == 0);
+		}
+		CHECK(LateActor->NumTicks == 0);
+		CHECK(TickManager.GetNumTickables() == k_NumActorsPerWave + 1);
+
+		for (ATickOrderActor* Root : Roots)
+		{
+			Root->OnTick = nullptr;
+		}
+		TickManager.Tick(sf::milliseconds(16));
+
+		CHECK(LateActor->NumTicks == 1);
+		CHECK(Roots[0]->NumTicks == 2);
+		CHECK(Dependents[0]->NumTicks == 0);
+	}
+
+	for (ATickOrderActor* Actor : Roots) { FGlobalObjectLibrary::DestroyObject(Actor); }
+	for (ATickOrderActor* Actor : Dependents) { FGlobalObjectLibrary::DestroyObject(Actor); }
+	FGlobalObjectLibrary::DestroyObject(LateActor);
+}
+
+TEST_CASE("Tick managers slot tickables in and out without losing their order", "[world][tick_manager]")
+{
+	using namespace Gordian;
+
+	FTickManager TickManager;
+	ATickOrderActor::NextTickSequence = 0;
+
+	ATickOrderActor* Prerequisite = CreateTickOrderActor("Prerequisite");
+	ATickOrderActor* Dependent = CreateTickOrderActor("Dependent");
+	ATickOrderActor* Toggled = CreateTickOrderActor("Toggled");
+	Dependent->AddTickPrerequisite(Prerequisite);
+
+	// The dependent is placed on its own first, so its prerequisite has to go in ahead of it later
+	TickManager.RegisterActor(Dependent);
+	TickManager.RegisterActor(Toggled);
+	TickManager.Tick(sf::milliseconds(16));
+	REQUIRE(Dependent->NumTicks == 1);
+
+	TickManager.RegisterActor(Prerequisite);
+
+	// Toggling ticking on and off should leave everything else where it was
+	for (int Toggle = 0; Toggle < 10; ++Toggle)
+	{
+		TickManager.UnregisterActor(Toggled);
+		TickManager.RegisterActor(Toggled);
+	}
+	REQUIRE(TickManager.GetNumTickables() == 3);
+
+	TickManager.Tick(sf::milliseconds(16));
+
+	CHECK(Prerequisite->NumTicks == 1);
+	CHECK(Dependent->NumTicks == 2);
+	CHECK(Toggled->NumTicks == 2);
+	CHECK(Dependent->TickedAt > Prerequisite->TickedAt);
+
+	FGlobalObjectLibrary::DestroyObject(Prerequisite);
+	TickManager.Tick(sf::milliseconds(16));
+
+	CHECK(Dependent->NumTicks == 3);
+	CHECK(Toggled->NumTicks == 3);
+	CHECK(TickManager.GetNumTickables() == 2);
+
+	FGlobalObjectLibrary::DestroyObject(Dependent);
+	FGlobalObjectLibrary::DestroyObject(Toggled);
+}
+
+TEST_CASE("Tick managers time each run of a type rather than each tickable", "[world][tick_manager]")
+{
+	using namespace Gordian;
+
+	FTickManager TickManager;
+	std::vector<ATickOrderActor*> Actors;
+	for (size_t ActorIndex = 0; ActorIndex < k_NumActorsPerWave; ++ActorIndex)
+	{
+		Actors.push_back(CreateTickOrderActor("Actor" + std::to_string(ActorIndex)));
+		TickManager.RegisterActor(Actors.back());
+	}
+
+	const std::string TypeName = ATickOrderActor::GetStaticType()->GetName();
+	std::remove(k_TestTraceFilepath);
+
+	SECTION("on the main thread, a whole run is one marker")
+	{
+		FProfiler::Get().Clear();
+		TickManager.Tick(sf::milliseconds(16));
+		REQUIRE(FProfiler::Get().ExportChromeTrace(k_TestTraceFilepath));
+
+		CHECK(CountTraceEvents(TypeName) == 1);
+	}
+
+	SECTION("with workers, a run gets one marker per batch")
+	{
+		FScopedJobWorkers JobWorkers;
+		FProfiler::Get().Clear();
+		TickManager.Tick(sf::milliseconds(16));
+		REQUIRE(FProfiler::Get().ExportChromeTrace(k_TestTraceFilepath));
+
+		const size_t NumMarkers = CountTraceEvents(TypeName);
+		CHECK(NumMarkers > 1);
+		CHECK(NumMarkers < k_NumActorsPerWave / 2);
+	}
+
+	std::remove(k_TestTraceFilepath);
+	for (ATickOrderActor* Actor : Actors) { FGlobalObjectLibrary::DestroyObject(Actor); }
+}
@@ -0,0 +1,77 @@
+#include <Catch.hpp>
+#include "GordianEngine/World/Public/TransformBuffer.h"
+
+TEST_CASE("Transform buffers blend between ticks", "[World][TransformBuffer]")
+{
+	using namespace Gordian;
+
+	FTransformBuffer TransformBuffer;
+	const sf::Int32 Slot = TransformBuffer.Allocate(sf::Vector2f(0.f, 10.f), 0.f);
+	CHECK(TransformBuffer.GetNumTransforms() == 1);
+
+	// Render transforms are checked by where they put the origin
+	auto GetRenderPosition = [&TransformBuffer](sf::Int32 InSlot)
+	{
+		return TransformBuffer.GetRenderTransform(InSlot).transformPoint(0.f, 0.f);
+	};
+
+	SECTION("New transforms start without motion")
+	{
+		TransformBuffer.Interpolate(0.5f);
+		CHECK(GetRenderPosition(Slot).x == Approx(0.f));
+		CHECK(GetRenderPosition(Slot).y == Approx(10.f));
+	}
+
+	SECTION("Positions blend from the previous tick to the current one")
+	{
+		TransformBuffer.BeginTick();
+		TransformBuffer.SetPosition(Slot, sf::Vector2f(100.f, 10.f));
+
+		TransformBuffer.Interpolate(0.f);
+		CHECK(GetRenderPosition(Slot).x == Approx(0.f));
+		TransformBuffer.Interpolate(0.25f);
+		CHECK(GetRenderPosition(Slot).x == Approx(25.f));
+		TransformBuffer.Interpolate(1.f);
+		CHECK(GetRenderPosition(Slot).x == Approx(100.f));
+
+		// Next tick, the blend starts from where this one ended
+		TransformBuffer.BeginTick();
+		TransformBuffer.Interpolate(0.5f);
+		CHECK(GetRenderPosition(Slot).x == Approx(100.f));
+	}
+
+	SECTION("Rotations blend the short way around")
+	{
+		TransformBuffer.SetRotation(Slot, 350.f);
+		TransformBuffer.Teleport(Slot);
+		TransformBuffer.BeginTick();
+		TransformBuffer.SetRotation(Slot, 10.f);
+
+		// Halfway from 350 to 10 degrees is 0, so a point on the x axis stays there
+		TransformBuffer.Interpolate(0.5f);
+		const sf::Vector2f RotatedPoint = TransformBuffer.GetRenderTransform(Slot).transformPoint(1.f, 0.f);
+		CHECK(RotatedPoint.x == Approx(1.f));
+		CHECK(RotatedPoint.y == Approx(10.f));
+	}
+
+	SECTION("Teleporting skips the blend")
+	{
+		TransformBuffer.BeginTick();
+		TransformBuffer.SetPosition(Slot, sf::Vector2f(500.f, 10.f));
+		TransformBuffer.Teleport(Slot);
+
+		TransformBuffer.Interpolate(0.f);
+		CHECK(GetRenderPosition(Slot).x == Approx(500.f));
+	}
+
+	SECTION("Released slots are reused")
+	{
+		const sf::Int32 OtherSlot = TransformBuffer.Allocate(sf::Vector2f(), 0.f);
+		CHECK(OtherSlot != Slot);
+
+		TransformBuffer.Release(OtherSlot);
+		CHECK(TransformBuffer.GetNumTransforms() == 1);
+		CHECK(TransformBuffer.Allocate(sf::Vector2f(7.f, 7.f), 0.f) == OtherSlot);
+		CHECK(TransformBuffer.GetPosition(OtherSlot) == sf::Vector2f(7.f, 7.f));
+	}
+}
@@ -0,0 +1,195 @@
+#include <Catch.hpp>
+#include "GordianEngine/Actor/Public/Actor.h"
+#include "GordianEngine/Actor/Public/ActorComponent.h"
+#include "GordianEngine/ActorComponents/Public/TransformComponent.h"
+#include "GordianEngine/GlobalLibraries/Public/GlobalObjectLibrary.h"
+#include "GordianEngine/World/Public/World.h"
+
+#include <algorithm>
+#include <vector>
+
+namespace
+{
+	int NumActorTicks = 0;
+
+	// Everything that ticked, in the order it ticked
+	std::vector<const void*> TickLog;
+
+	// Loaded actors can't be found through the world, so they report in here
+	const Gordian::AActor* LastInitializedActor = nullptr;
+}
+
+class ATickCountingActor : public Gordian::AActor
+{
+	REFLECT_CLASS(Gordian::AActor)
+
+public:
+
+	ATickCountingActor(const std::string& InName, Gordian::OObject* InOwningObject)
+		: Parent(InName, InOwningObject)
+	{
+		SetIsTicking(true);
+	}
+
+	virtual void Tick(const sf::Time& DeltaTime) override
+	{
+		++NumActorTicks;
+		TickLog.push_back(this);
+	}
+};
+
+RCLASS_INITIALIZE_EMPTY(ATickCountingActor)
+
+class OTickLoggingComponent : public Gordian::OActorComponent
+{
+	REFLECT_CLASS(Gordian::OActorComponent)
+
+public:
+
+	OTickLoggingComponent(const std::string& InName, Gordian::OObject* InOwningObject)
+		: Parent(InName, InOwningObject)
+	{
+	}
+
+	virtual void Tick(const sf::Time& DeltaTime) override
+	{
+		TickLog.push_back(this);
+	}
+};
+
+RCLASS_INITIALIZE_EMPTY(OTickLoggingComponent)
+
+class AInitializeReportingActor : public Gordian::AActor
+{
+	REFLECT_CLASS(Gordian::AActor)
+
+public:
+
+	AInitializeReportingActor(const std::string& InName, Gordian::OObject* InOwningObject)
+		: Parent(InName, InOwningObject)
+	{
+	}
+
+	virtual void Initialize() override
+	{
+		Parent::Initialize();
+		LastInitializedActor = this;
+	}
+};
+
+RCLASS_INITIALIZE_EMPTY(AInitializeReportingActor)
+
+TEST_CASE("Worlds only tick ticking actors, and tick them before their components", "[world]")
+{
+	using namespace Gordian;
+	TickLog.clear();
+
+	OWorld* World = FGlobalObjectLibrary::CreateObject<OWorld>(nullptr, OWorld::GetStaticType(), "TestWorld");
+	REQUIRE(World != nullptr);
+
+	const sf::Time DeltaSeconds = sf::milliseconds(16);
+	World->Tick(DeltaSeconds);
+
+	ATickCountingActor* TickingActor = World->SpawnActor<ATickCountingActor>(ATickCountingActor::GetStaticType(), "Ticking");
+	OTickLoggingComponent* Component = FGlobalObjectLibrary::CreateObject<OTickLoggingComponent>(TickingActor, OTickLoggingComponent::GetStaticType(), "Component");
+	REQUIRE(TickingActor->AddComponent(Component));
+	CHECK_FALSE(Component->IsTicking());
+	Component->SetIsTicking(true);
+
+	ATickCountingActor* StoppedActor = World->SpawnActor<ATickCountingActor>(ATickCountingActor::GetStaticType(), "Stopped");
+	StoppedActor->SetIsTicking(false);
+
+	// Actors do not tick unless they ask to
+	AActor* PlainActor = World->SpawnActor<AActor>(AActor::GetStaticType(), "Plain");
+	CHECK_FALSE(PlainActor->IsTicking());
+
+	TickLog.clear();
+	World->Tick(DeltaSeconds);
+
+	const auto ActorTick = std::find(TickLog.begin(), TickLog.end(), TickingActor);
+	const auto ComponentTick = std::find(TickLog.begin(), TickLog.end(), Component);
+	REQUIRE(ActorTick != TickLog.end());
+	REQUIRE(ComponentTick != TickLog.end());
+	CHECK(ActorTick < ComponentTick);
+	CHECK(std::find(TickLog.begin(), TickLog.end(), StoppedActor) == TickLog.end());
+
+	FGlobalObjectLibrary::DestroyObject(World);
+}
+
+TEST_CASE("Worlds keep ticking actors across a save and load", "[world]")
+{
+	using namespace Gordian;
+	NumActorTicks = 0;
+
+	OWorld* World = FGlobalObjectLibrary::CreateObject<OWorld>(nullptr, OWorld::GetStaticType(), "TestWorld");
+	REQUIRE(World != nullptr);
+
+	const sf::Time DeltaSeconds = sf::milliseconds(16);
+	World->Tick(DeltaSeconds);
+
+	World->SpawnActor<ATickCountingActor>(ATickCountingActor::GetStaticType(), "First");
+	World->SpawnActor<ATickCountingActor>(ATickCountingActor::GetStaticType(), "Second");
+	World->Tick(DeltaSeconds);
+	REQUIRE(NumActorTicks == 2);
+
+	std::vector<char> SavedState;
+	REQUIRE(World->SaveState(SavedState));
+	const size_t NumTickables = World->GetTickManager().GetNumTickables();
+
+	WHEN("the saved state is loaded back in and the world ticks")
+	{
+		REQUIRE(World->LoadState(SavedState));
+		NumActorTicks = 0;
+		World->Tick(DeltaSeconds);
+
+		THEN("only the loaded actors tick, and the replaced ones are gone from the tick lists")
+		{
+			CHECK(NumActorTicks == 2);
+			CHECK(World->GetTickManager().GetNumTickables() == NumTickables);
+		}
+	}
+
+	FGlobalObjectLibrary::DestroyObject(World);
+}
+
+TEST_CASE("Transforms are saved and load without blending from stale values", "[world]")
+{
+	using namespace Gordian;
+
+	OWorld* World = FGlobalObjectLibrary::CreateObject<OWorld>(nullptr, OWorld::GetStaticType(), "TestWorld");
+	REQUIRE(World != nullptr);
+
+	const sf::Time DeltaSeconds = sf::milliseconds(16);
+	AActor* Mover = World->SpawnActor<AInitializeReportingActor>(AInitializeReportingActor::GetStaticType(), "Mover");
+	OTransformComponent* Transform = FGlobalObjectLibrary::CreateObject<OTransformComponent>(Mover, OTransformComponent::GetStaticType(), "Transform");
+	REQUIRE(Mover->AddComponent(Transform));
+
+	// Leaves the buffer with motion to blend, from the first position to the second
+	Transform->SetPosition(sf::Vector2f(10.f, 20.f));
+	World->Tick(DeltaSeconds);
+	Transform->SetPosition(sf::Vector2f(30.f, 40.f));
+	Transform->SetRotation(45.f);
+
+	std::vector<char> SavedState;
+	REQUIRE(World->SaveState(SavedState));
+
+	Transform->SetPosition(sf::Vector2f(-100.f, -100.f));
+	Transform->SetRotation(0.f);
+
+	LastInitializedActor = nullptr;
+	REQUIRE(World->LoadState(SavedState));
+	REQUIRE(LastInitializedActor != nullptr);
+	REQUIRE(LastInitializedActor != Mover);
+
+	const OTransformComponent* LoadedTransform = LastInitializedActor->GetTransformComponent();
+	REQUIRE(LoadedTransform != nullptr);
+	CHECK(LoadedTransform->GetPosition() == sf::Vector2f(30.f, 40.f));
+	CHECK(LoadedTransform->GetRotation() == 45.f);
+
+	// Renders right where it was saved, rather than partway from where the buffer last had it
+	const sf::Vector2f RenderedOrigin = LoadedTransform->GetRenderTransform().transformPoint(0.f, 0.f);
+	CHECK(RenderedOrigin.x == Approx(30.f));
+	CHECK(RenderedOrigin.y == Approx(40.f));
+
+	FGlobalObjectLibrary::DestroyObject(World);
+}
@@ -0,0 +1,165 @@
+# Decodes binary logs written by FBinaryLogWriter back into Log.txt style text
+#
+# Usage: DecodeBinaryLog.py <Log.bin> [Output.txt]
+
+import re
+import struct
+import sys
+import time
+
+# Must match EBinaryLogRecord
+SessionRecord = 0
+SiteRecord = 1
+LogRecord = 2
+
+# Must match EBinaryLogArg, mapped to struct formats
+ArgFormats = {
+	1: "<i",	# Int32
+	2: "<I",	# UInt32
+	3: "<q",	# Int64
+	4: "<Q",	# UInt64
+	5: "<d",	# Double
+	7: "<Q",	# Pointer
+}
+StringArg = 6
+
+BinaryLogMagic = 0x474F4C47
+BinaryLogVersion = 1
+
+# Matches a single printf conversion
+ConversionPattern = re.compile(r"%(?P<Flags>[-+ #0]*)(?P<Width>\*|\d+)?(?:\.(?P<Precision>\*|\d+))?"
+							   r"(?P<Length>hh|h|ll|l|j|z|t|L|I64|I32|I)?(?P<Conversion>[diouxXeEfFgGaAcspn%])")
+
+
+class FLogSite:
+	def __init__(self, Verbosity, Category, Location, Format):
+		self.Verbosity = Verbosity
+		self.Category = Category
+		self.Location = Location
+		self.Format = Format
+
+
+def ReadString(Payload, Offset):
+	(Length,) = struct.unpack_from("<H", Payload, Offset)
+	Offset += 2
+	return Payload[Offset:Offset + Length].decode("utf8", errors="replace"), Offset + Length
+
+
+def ReadArgs(Payload, Offset):
+	# Returns a list of (tag, value) pairs
+	Args = []
+	while Offset < len(Payload):
+		Tag = Payload[Offset]
+		Offset += 1
+		if Tag == StringArg:
+			Value, Offset = ReadString(Payload, Offset)
+		elif Tag in ArgFormats:
+			(Value,) = struct.unpack_from(ArgFormats[Tag], Payload, Offset)
+			Offset += struct.calcsize(ArgFormats[Tag])
+		else:
+			raise ValueError("Unknown argument tag " + str(Tag))
+		Args.append((Tag, Value))
+	return Args
+
+
+def FormatConversion(Match, Args):
+	# Rebuilds a single printf conversion using python's % formatting
+	Conversion = Match.group("Conversion")
+	if Conversion == "%":
+		return "%"
+
+	Width = Match.group("Width") or ""
+	if Width == "*":
+		Width = str(Args.pop(0)[1]) if Args else ""
+	Precision = Match.group("Precision")
+	if Precision == "*":
+		Precision = str(Args.pop(0)[1]) if Args else None
+
+	if not Args:
+		return "<missing>"
+	Tag, Value = Args.pop(0)
+
+	if Conversion == "n":
+		return ""
+	if Conversion == "p":
+		return "0x%016X" % Value
+	if Conversion == "c":
+		Conversion, Value = "s", chr(Value)
+	elif Conversion in "di":
+		Conversion = "d"
+	elif Conversion in "ouxX":
+		# Match C's view of negative numbers as unsigned
+		if Value < 0:
+			Value += 1 << (32 if Tag == 1 else 64)
+		if Conversion == "u":
+			Conversion = "d"
+	elif Conversion in "aA":
+		Conversion, Value = "s", float(Value).hex()
+
+	Spec = "%" + Match.group("Flags") + Width
+	if Precision is not None:
+		Spec += "." + Precision
+	try:
+		return (Spec + Conversion) % Value
+	except (TypeError, ValueError):
+		return str(Value)
+
+
+def FormatLog(Format, Args):
+	return ConversionPattern.sub(lambda Match: FormatConversion(Match, Args), Format)
+
+
+def FormatTimestamp(Microseconds):
+	return time.strftime("[%Y.%m.%d %H:%M:%S %z] ", time.localtime(Microseconds / 1000000))
+
+
+def DecodeBinaryLog(InputPath, OutputFile):
+	with open(InputPath, "rb") as File:
+		Data = File.read()
+
+	Sites = {}
+	Offset = 0
+	while Offset + 3 <= len(Data):
+		RecordType, PayloadSize = struct.unpack_from("<BH", Data, Offset)
+		Offset += 3
+		Payload = Data[Offset:Offset + PayloadSize]
+		Offset += PayloadSize
+
+		if len(Payload) < PayloadSize:
+			print("Log ends with a partial record, it will be skipped.", file=sys.stderr)
+			break
+
+		if RecordType == SessionRecord:
+			Magic, Version, StartTime = struct.unpack_from("<IHq", Payload, 0)
+			if Magic != BinaryLogMagic or Version != BinaryLogVersion:
+				raise ValueError("Not a binary log, or an unsupported version")
+			# Each run hands out its own site ids
+			Sites = {}
+		elif RecordType == SiteRecord:
+			SiteId, Verbosity = struct.unpack_from("<IB", Payload, 0)
+			Category, StringOffset = ReadString(Payload, 5)
+			Location, StringOffset = ReadString(Payload, StringOffset)
+			Format, StringOffset = ReadString(Payload, StringOffset)
+			Sites[SiteId] = FLogSite(Verbosity, Category, Location, Format)
+		elif RecordType == LogRecord:
+			SiteId, Timestamp = struct.unpack_from("<Iq", Payload, 0)
+			Site = Sites.get(SiteId)
+			if Site is None:
+				print("Log refers to unknown site " + str(SiteId) + ", it will be skipped.", file=sys.stderr)
+				continue
+			Message = FormatLog(Site.Format, ReadArgs(Payload, 12))
+			OutputFile.write(Site.Location + "\n")
+			OutputFile.write(FormatTimestamp(Timestamp) + Site.Category + " - " + Message + "\n")
+		# Unknown records are skipped, so older decoders can still read newer logs
+
+
+if __name__ == "__main__":
+	if len(sys.argv) < 2:
+		print("Usage: DecodeBinaryLog.py <Log.bin> [Output.txt]")
+		sys.exit(1)
+
+	if len(sys.argv) > 2:
+		with open(sys.argv[2], "w", encoding="utf8") as OutputFile:
+			DecodeBinaryLog(sys.argv[1], OutputFile)
+	else:
+		DecodeBinaryLog(sys.argv[1], sys.stdout)
@@ -20,11 +20,8 @@ OTestCardSpriteComponent::OTestCardSpriteComponent(const std::string& InName, OO
 
 void OTestCardSpriteComponent::Initialize(AActor* ActorInitializingFrom)
 {
-	_FileToLoadTextureFrom = "../NDB_Scraper/Output/06041.png";
-	_TextureToRender.loadFromFile(_FileToLoadTextureFrom);
-	_SpriteToRender.setTexture(_TextureToRender);
 	sf::IntRect DefaultCardRect(0, 0, 300, 419);
-	_SpriteToRender.setTextureRect(DefaultCardRect);
+	StreamTexture("../NDB_Scraper/Output/06041.png", DefaultCardRect);
 	FInputManager::Get()->BindToDigitalCommand<OTestCardSpriteComponent, &OTestCardSpriteComponent::TestFunction>("TestCommand", EDigitalEventType::Pressed, this);
 }
 